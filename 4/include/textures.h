@@ -1,730 +0,0 @@
-namespace textures
-{
-	// 'barrel', 64x64px
-	const unsigned int barrel[] = {
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00626262, 0x00626262, 0x00626263, 0x00626262, 0x00626262, 0x00626262, 0x00626262, 0x00626262, 0x00626262, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x007a7a7a, 0x007a7a7a, 0x007a7a7a, 0x007a7a7a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x006c6c6c, 0x00626262, 0x00494949, 0x00494949, 0x00494949, 0x00484949, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x00575757, 0x00575757, 0x00575757, 0x00575757, 0x00575757, 0x00626262, 0x00626262, 0x00626262, 0x007a7a7a, 0x006c6c6c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x006c6c6c, 0x007a7a7a, 0x00494949, 0x00313131, 0x001c1c1c, 0x001c1c1c, 0x001c1c1c, 0x001c1c1c, 0x00262626, 0x00272626, 0x00262626, 0x00262626, 0x00262626, 0x00262626, 0x00262626, 0x00313131, 0x00313131, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x00494949, 0x00636262, 0x00494949, 0x00626262, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x006c6c6c, 0x006c6c6c, 0x007a7a7a, 0x00858585, 0x00858585, 0x007a7a7a, 0x007a7a7a, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x00626262, 0x00636262, 0x00626262, 0x00626262, 0x00575757, 0x00575757, 0x00575757, 0x00575757, 0x00494949, 0x00494949, 0x003f3f3f, 0x00313131, 0x00313131, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00885431, 0x00885431, 0x006c6c6c, 0x006c6c6c, 0x007a7a7a, 0x007a7a7a, 0x006c6c6c, 0x006c6c6c, 0x00626262, 0x00626262, 0x00626262, 0x00575757, 0x00575757, 0x00575757, 0x00575757, 0x00494949, 0x00494949, 0x00494949, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x00313131, 0x00313131, 0x00313131, 0x00313131, 0x003f3115, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00774d2a, 0x008c5734, 0x007e502d, 0x00885431, 0x00885531, 0x00774d2a, 0x00704626, 0x00704626, 0x00704626, 0x00654223, 0x00654223, 0x00654223, 0x00654223, 0x005e3f1f, 0x005e3f1f, 0x005e3f1f, 0x0050381c, 0x0050381c, 0x0050381c, 0x003f3115, 0x003f3115, 0x003f3115, 0x003f3115, 0x003f3015, 0x003f3115, 0x0050381c, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00885431, 0x00774d2a, 0x008c5735, 0x008c5734, 0x009d623b, 0x00a4693f, 0x00885431, 0x00a4693f, 0x009d623b, 0x009d623b, 0x008c5734, 0x007e502d, 0x00935b38, 0x00935b38, 0x008c5734, 0x00885431, 0x007e502d, 0x00654223, 0x005e3f1f, 0x00704626, 0x00654223, 0x00654223, 0x00493418, 0x00654223, 0x005e3f1f, 0x003f3115, 0x003f3115, 0x0050381c, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00774d2a, 0x008c5734, 0x00774d2a, 0x009d623b, 0x00a4693f, 0x008c5734, 0x00935b38, 0x00a4693f, 0x009d623b, 0x009d623b, 0x007e502d, 0x00774d2a, 0x00935b38, 0x00935b38, 0x008c5734, 0x00885531, 0x007f502d, 0x00654223, 0x005e3f1f, 0x00704626, 0x00704627, 0x00654223, 0x005e3f1f, 0x0050381c, 0x00654223, 0x005e3f1f, 0x003f3115, 0x0050381c, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00774d2a, 0x008c5734, 0x00774d2a, 0x009d623b, 0x00a4693f, 0x00885431, 0x00a4683f, 0x009d623b, 0x009d623b, 0x009d623b, 0x007e502d, 0x007e502d, 0x00935b38, 0x00935b38, 0x008c5734, 0x00885431, 0x007e502d, 0x00704626, 0x0050381c, 0x00704626, 0x00704626, 0x00704626, 0x00654223, 0x00493418, 0x00654223, 0x005e3f1f, 0x003f3115, 0x0050381c, 0x003f3f3f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00494949, 0x00575757, 0x006c6c6c, 0x007a7a7a, 0x00626262, 0x00a4693f, 0x00885431, 0x00a4693f, 0x009d623b, 0x009d623b, 0x00935b38, 0x007e502d, 0x00935b38, 0x00935b38, 0x008c5734, 0x00885431, 0x007e502d, 0x00774d2a, 0x00704626, 0x0050381d, 0x00704626, 0x00714626, 0x00704626, 0x00654223, 0x00493418, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x00313131, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00494949, 0x00626262, 0x006c6c6c, 0x006c6c6c, 0x007a7a7a, 0x007a7a7a, 0x00858485, 0x007a7a7b, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x00626262, 0x00626262, 0x00626262, 0x00626262, 0x00626262, 0x00575757, 0x00575757, 0x00575757, 0x00575757, 0x00575757, 0x00494949, 0x00494948, 0x00494949, 0x00494949, 0x00313131, 0x00313131, 0x00313131, 0x00313131, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00494948, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x006d6c6c, 0x006c6c6c, 0x007a7a7a, 0x00626262, 0x00626262, 0x00626262, 0x00626262, 0x00575757, 0x00565757, 0x00575757, 0x00575757, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x00494849, 0x00494949, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x00313131, 0x00313131, 0x00313131, 0x00313131, 0x00313131, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00774d2a, 0x00654223, 0x00494949, 0x00575757, 0x00626262, 0x006c6c6c, 0x006c6c6c, 0x00626262, 0x00626262, 0x00626262, 0x00626262, 0x00575757, 0x00575757, 0x00575757, 0x00575757, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x003f3f3e, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x003e3f3f, 0x00313131, 0x00313131, 0x00313131, 0x0050381c, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00764d2a, 0x008c5734, 0x00774d2a, 0x009d623b, 0x008c5734, 0x008c5734, 0x0050381c, 0x00885431, 0x007e502d, 0x00774d2a, 0x00704626, 0x003f3115, 0x00654223, 0x00654223, 0x00654223, 0x005e3f1f, 0x005e3f1f, 0x005e3f1f, 0x005e3f1f, 0x00231c0a, 0x0050381c, 0x003f3115, 0x003f3115, 0x003f3115, 0x003f3115, 0x00493418, 0x0050381c, 0x0050381c, 0x003f3115, 0x0050381c, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00774d2a, 0x008c5734, 0x00774d2a, 0x009d623b, 0x00a4693f, 0x00a4693f, 0x008c5734, 0x00a4693f, 0x009d623b, 0x009d623b, 0x009d623b, 0x007e502d, 0x00935b38, 0x008c5734, 0x00885431, 0x00885431, 0x007e502d, 0x00774d2a, 0x00704626, 0x0050381c, 0x00704626, 0x00704626, 0x00704626, 0x00654223, 0x005e3f1f, 0x00493418, 0x0050381c, 0x0050381c, 0x003f3115, 0x0050381c, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00774d2a, 0x008c5734, 0x00774d2a, 0x009d623b, 0x00a4693f, 0x00a4693f, 0x008c5734, 0x00a4693f, 0x009d623b, 0x009d623b, 0x009d623a, 0x007e502d, 0x00935b38, 0x008c5734, 0x00885431, 0x00885431, 0x007e502d, 0x00774d2a, 0x00704626, 0x0050381c, 0x00704626, 0x00704626, 0x00704726, 0x00654223, 0x005e3f1f, 0x00493419, 0x0050381c, 0x0050381c, 0x003f3115, 0x0050381c, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00774d2a, 0x008c5734, 0x00774d2a, 0x009d623b, 0x00a4693f, 0x00a4693f, 0x008c5734, 0x00a4693f, 0x009d623b, 0x009d623b, 0x009d623b, 0x00774d2a, 0x00935b38, 0x008c5734, 0x00885431, 0x00885431, 0x007e502d, 0x00774d2a, 0x00704626, 0x0050381c, 0x00704626, 0x00704626, 0x00704626, 0x00654223, 0x005e3f1f, 0x00493418, 0x0050381c, 0x0050381c, 0x003f3115, 0x0050381c, 0x003e3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00774d2a, 0x008c5734, 0x00774d2a, 0x009d623b, 0x00a4693f, 0x00a4693f, 0x008c5734, 0x00a4693f, 0x009d623b, 0x009d623b, 0x009d623b, 0x00774d2a, 0x00935b38, 0x008c5734, 0x00885430, 0x00885431, 0x007e502d, 0x00774d2a, 0x00704626, 0x0050381c, 0x00704626, 0x00704626, 0x00704626, 0x00654223, 0x005e3f1f, 0x00493418, 0x0050381c, 0x0050381c, 0x003f3115, 0x0050381c, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00774d2a, 0x008c5734, 0x00774d2a, 0x009d623b, 0x00a4693f, 0x00a4693f, 0x008c5734, 0x00a4693f, 0x009d623b, 0x009d623b, 0x009c623a, 0x00774d2a, 0x00935b38, 0x008c5734, 0x00885431, 0x00885431, 0x007e502d, 0x00774d2a, 0x00714626, 0x0050381c, 0x00704626, 0x00704626, 0x00704626, 0x00654223, 0x005e3f1f, 0x00493418, 0x0050381c, 0x0050381c, 0x003f3115, 0x0050381c, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00774d2a, 0x008c5734, 0x00774d2a, 0x009d623b, 0x00a4693f, 0x00a4693f, 0x008c5734, 0x00a4693f, 0x009d623b, 0x009d623b, 0x009d623b, 0x00774d2a, 0x00935b38, 0x008c5734, 0x00885431, 0x00885431, 0x007e502d, 0x00774d2a, 0x00704626, 0x0050381c, 0x00704626, 0x00704626, 0x00704626, 0x00654223, 0x005e3f1f, 0x00493418, 0x0050381c, 0x0050381c, 0x003f3115, 0x0050381c, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x006c6c6c, 0x008c5734, 0x00774d2a, 0x009d623b, 0x00a4693f, 0x00a4693f, 0x00885431, 0x00a4693f, 0x009c623b, 0x009d623b, 0x009d623b, 0x00704626, 0x00935b38, 0x008c5734, 0x00885431, 0x00885431, 0x007e502d, 0x00774d2a, 0x00704626, 0x0050381c, 0x00704626, 0x00704626, 0x00704626, 0x00654223, 0x005e3f1f, 0x00493418, 0x0050381c, 0x0050381c, 0x003f3115, 0x003f3f3f, 0x003f3f3f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00626262, 0x007b7a7a, 0x007a7a7a, 0x007a7a7a, 0x006c6c6c, 0x00a4693f, 0x00885431, 0x00a4693f, 0x009d623b, 0x009d623b, 0x009d623b, 0x00704626, 0x00935b38, 0x008c5734, 0x00895431, 0x00885431, 0x007e502d, 0x00774d2a, 0x00704626, 0x0050381c, 0x00704626, 0x00704626, 0x00704626, 0x00654223, 0x005e3f1f, 0x00493418, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x00313131, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00575757, 0x006c6d6c, 0x006c6c6c, 0x006c6c6c, 0x007a7a7a, 0x00858585, 0x007a7a7a, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x00626262, 0x00626262, 0x00626262, 0x00626262, 0x00626262, 0x00575757, 0x00575757, 0x00575757, 0x00575757, 0x00575757, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x003f3f3f, 0x00313131, 0x00313131, 0x00313131, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00494949, 0x00575757, 0x00626262, 0x006c6c6c, 0x006c6c6c, 0x007a7a7a, 0x006c6c6c, 0x00626262, 0x00626262, 0x00626262, 0x00626262, 0x00575757, 0x00575757, 0x00575757, 0x00575757, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x00313131, 0x00313131, 0x00313131, 0x00313131, 0x00382a15, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00654223, 0x00484949, 0x00575757, 0x00575757, 0x00575757, 0x00626262, 0x00626262, 0x00626262, 0x00626262, 0x00626262, 0x00575757, 0x00575757, 0x00575757, 0x00575757, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x00382a15, 0x00382a15, 0x00382a15, 0x00493418, 0x0050381c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00774d2a, 0x00774d2a, 0x00704626, 0x00704626, 0x00704626, 0x00704626, 0x00704626, 0x00704626, 0x005e3f1f, 0x005e3f1f, 0x00312611, 0x005e3f1f, 0x005e3f1f, 0x0050381c, 0x0050381c, 0x0050381c, 0x0050381c, 0x0050381c, 0x00231c0a, 0x0050381c, 0x0050381c, 0x0050381c, 0x0050381c, 0x00382a15, 0x00382a15, 0x0050381c, 0x003f3115, 0x0050381c, 0x003f3115, 0x0050381c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00774d2a, 0x008c5734, 0x00774d2a, 0x00935b38, 0x00a4693f, 0x00885431, 0x00a4693f, 0x00935b38, 0x00935b38, 0x00885531, 0x00654223, 0x00885431, 0x007e502d, 0x007e502d, 0x007e502d, 0x007e502d, 0x00774d2a, 0x00704626, 0x0050381c, 0x00704626, 0x00704626, 0x00654223, 0x005e3f1f, 0x003f3115, 0x0050381c, 0x0050381d, 0x003f3115, 0x0050381c, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00774d2a, 0x008c5734, 0x008c5734, 0x009d623b, 0x00774d2a, 0x00935b38, 0x00935b38, 0x00935a38, 0x00885431, 0x00654223, 0x00774d2a, 0x007e502d, 0x007e502d, 0x007e512d, 0x007e502d, 0x00774d2a, 0x005e3f1f, 0x0050381c, 0x00704626, 0x00704626, 0x00654223, 0x005e3f1f, 0x003f3115, 0x0050381c, 0x0050381c, 0x003f3115, 0x0050381c, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00626262, 0x008c5734, 0x00774d2a, 0x008c5734, 0x008c5734, 0x00774d2a, 0x00935b38, 0x00935b38, 0x00885431, 0x00654223, 0x00704626, 0x007e502d, 0x007e502d, 0x007e502d, 0x00774d2a, 0x00704626, 0x0050381c, 0x0050381c, 0x00704626, 0x00704626, 0x00654223, 0x0050381c, 0x003f3115, 0x0050381c, 0x003f3115, 0x0050381c, 0x003f3115, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00626262, 0x007a7a7a, 0x00858585, 0x007b7a7a, 0x008c5734, 0x00774d2a, 0x00885431, 0x00885431, 0x00885431, 0x00704626, 0x00654223, 0x00774d2a, 0x00774d2a, 0x00774d2a, 0x00774d2a, 0x00704627, 0x0050381c, 0x005e3f1f, 0x00704626, 0x00654223, 0x005e3f1f, 0x003f3115, 0x0050381c, 0x003f3115, 0x003f3115, 0x003f3115, 0x00313130, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x007a7a7a, 0x007a7a7a, 0x007a7a7a, 0x007a7a7a, 0x006c6c6c, 0x006c6c6c, 0x006c6c6c, 0x00626262, 0x00626262, 0x00575757, 0x00575757, 0x00575757, 0x00494949, 0x00494949, 0x00494949, 0x003f3f3e, 0x003f3e3f, 0x003f3f3f, 0x00313131, 0x00313131, 0x00262626, 0x001c1c1c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x006c6c6c, 0x00626262, 0x006c6c6c, 0x006c6c6c, 0x00626262, 0x00626262, 0x00626262, 0x00575757, 0x00575757, 0x00575757, 0x00575757, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x00313131, 0x00313131, 0x00313131, 0x00262626, 0x00262626, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x00313131, 0x00313131, 0x00313131, 0x00313131, 0x00262626, 0x00262626, 0x00262626, 0x00262626, 0x00262627, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000};
-	// 'bluestone', 64x64px
-	const unsigned int bluestone[] = {
-		0x00383838, 0x00000070, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000070, 0x00383838, 0x00383838, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00383838, 0x00383838, 0x00000070, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000070, 0x002c2c2c,
-		0x00202020, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x00202020, 0x00202020, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bd, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000100bc, 0x000000bc, 0x00202020, 0x00202020, 0x000000b0, 0x000000b0, 0x000100b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x00202020,
-		0x00000000, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000089, 0x000000a4, 0x0000007c, 0x000000a4, 0x000000a4, 0x00000099, 0x0000007c, 0x00000098, 0x00000098, 0x0000007c, 0x00000098, 0x00010098, 0x0000007c, 0x000000a4, 0x0000007c, 0x00000070, 0x00000070, 0x00000058, 0x00000000, 0x00202020, 0x000000bc, 0x000000a4, 0x000000bc, 0x000000b0, 0x0000007c, 0x000000a4, 0x000000bc, 0x00000098, 0x00000070, 0x00000070, 0x00000098, 0x00000088, 0x000000a4, 0x000000a4, 0x00000088, 0x00000070, 0x00000088, 0x000000a4, 0x000000bc, 0x000000a4, 0x00000088, 0x00000098, 0x000000a4, 0x000000bc, 0x000000bc, 0x000000a4, 0x00000098, 0x00000070, 0x00000000, 0x00202120, 0x000000b0, 0x000000bc, 0x000000a4, 0x00000098, 0x000000a4, 0x000000b0, 0x000000b0, 0x00000098, 0x0000007c, 0x00000000,
-		0x00000000, 0x000000a4, 0x00000098, 0x0000007c, 0x00000088, 0x00000099, 0x00000098, 0x00000098, 0x0000007c, 0x0000007c, 0x000000a4, 0x00000098, 0x000000a4, 0x00000064, 0x00000098, 0x00000098, 0x0000007c, 0x00000070, 0x0000007c, 0x0000007c, 0x00000070, 0x00000064, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x000000a4, 0x00000098, 0x00000098, 0x00000098, 0x00000070, 0x00000098, 0x00000058, 0x00000070, 0x00000058, 0x00000058, 0x0000007c, 0x000100a4, 0x000000a4, 0x00000064, 0x00000070, 0x00000070, 0x00000064, 0x00000070, 0x00000070, 0x00000058, 0x00000070, 0x00010088, 0x00010088, 0x00000070, 0x00000064, 0x00000070, 0x00000000, 0x00212020, 0x000000b0, 0x000000b0, 0x000000a4, 0x000000a4, 0x0000007c, 0x00000098, 0x000000a4, 0x000100a4, 0x00000058, 0x00000000,
-		0x00000000, 0x000000a4, 0x00000088, 0x000000a4, 0x00000070, 0x000000c8, 0x000000c8, 0x00010098, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000098, 0x00000088, 0x00000088, 0x0000007c, 0x00000064, 0x00000058, 0x0000007c, 0x00000070, 0x00000058, 0x00000058, 0x00000064, 0x00000000, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00202020, 0x000000b0, 0x000000a4, 0x000000b0, 0x000000bc, 0x000000bc, 0x000000b0, 0x000000a4, 0x0000007c, 0x0000007c, 0x00000000,
-		0x00000000, 0x000000a4, 0x00000088, 0x0000007c, 0x000000a4, 0x000000c8, 0x000000c8, 0x00000064, 0x0000007c, 0x0000007c, 0x0000007c, 0x000000a4, 0x00000098, 0x00000098, 0x00000098, 0x00000088, 0x00000070, 0x00000170, 0x0000007c, 0x00000058, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000001a4, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00212020, 0x000000b0, 0x000000bc, 0x000000a4, 0x000000b0, 0x000000a4, 0x0000007c, 0x0000007c, 0x00000064, 0x00000058, 0x00000000,
-		0x00000000, 0x000000a4, 0x00000098, 0x00000098, 0x000000b0, 0x000001b0, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000098, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000098, 0x00000098, 0x00000070, 0x00000070, 0x00010064, 0x00000058, 0x00000064, 0x00000070, 0x00000064, 0x00000000, 0x00202020, 0x000000a4, 0x000000bd, 0x000000bc, 0x000100bc, 0x000000b0, 0x000000a4, 0x00000098, 0x00000098, 0x000000bc, 0x00000098, 0x00000098, 0x000000b0, 0x00000098, 0x00000098, 0x000000b0, 0x000000bc, 0x000000bc, 0x000000a4, 0x000000a4, 0x00000000, 0x00202020, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000098, 0x00000099, 0x00000064, 0x00202020, 0x00202020, 0x000000b0, 0x00000098, 0x00000098, 0x000000a4, 0x0000007c, 0x00000088, 0x00000088, 0x00000064, 0x00000064, 0x00000000,
-		0x00000000, 0x000000a4, 0x000000a4, 0x00000098, 0x000000a4, 0x000001b0, 0x000000b0, 0x000001a4, 0x00000098, 0x0000007c, 0x00000064, 0x000000a4, 0x000000a4, 0x00000098, 0x00000088, 0x00000088, 0x0000007c, 0x00000064, 0x00000064, 0x00000058, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x000000a4, 0x000000b0, 0x000000bc, 0x000000e0, 0x000000c8, 0x000000b0, 0x000000a4, 0x000001bc, 0x000000a4, 0x00000098, 0x00000098, 0x00000098, 0x000000b0, 0x000000b0, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000098, 0x000000a4, 0x00000000, 0x00202020, 0x000000a4, 0x00000098, 0x00000098, 0x00000088, 0x00000098, 0x0000007c, 0x00000064, 0x00000000, 0x00202020, 0x000000b0, 0x00000098, 0x00000098, 0x000000a4, 0x00000070, 0x00000088, 0x00000088, 0x00000088, 0x00000064, 0x00000000,
-		0x00000000, 0x000000a4, 0x00000098, 0x0000007c, 0x00000098, 0x000000a4, 0x000000a4, 0x00000088, 0x00000098, 0x0000007c, 0x00000098, 0x00000070, 0x00000070, 0x00000088, 0x00000088, 0x00000188, 0x00000071, 0x0001007c, 0x0000007c, 0x00000064, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x000000a4, 0x000000b0, 0x000000c8, 0x000000bc, 0x000000c8, 0x00000098, 0x000000b0, 0x000000a4, 0x000000a4, 0x000000bc, 0x00000098, 0x00000099, 0x000000a5, 0x0000007d, 0x000000a4, 0x0000007c, 0x00000098, 0x000000a4, 0x0000007c, 0x00000000, 0x00202020, 0x000000a4, 0x00000098, 0x00000098, 0x00000098, 0x0000007c, 0x0000007c, 0x00000064, 0x00000000, 0x00202020, 0x000000b0, 0x000000bc, 0x000000a4, 0x00000098, 0x000000a4, 0x000000a4, 0x00000089, 0x00000088, 0x00000040, 0x00000000,
-		0x00000000, 0x000000a4, 0x00010088, 0x00000088, 0x00000088, 0x000000a4, 0x0000007c, 0x0000007c, 0x0000007c, 0x000000a4, 0x000000a4, 0x00000070, 0x00000058, 0x00000064, 0x00000064, 0x00000170, 0x00000064, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x000000a4, 0x000000b0, 0x000000b0, 0x000000b0, 0x00000098, 0x00000098, 0x00000098, 0x000000b0, 0x000000a4, 0x000100a4, 0x000000a4, 0x000000a4, 0x00000098, 0x00000088, 0x00000064, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000064, 0x00000000, 0x00202020, 0x000000a4, 0x000000a4, 0x00000098, 0x0000007c, 0x0000007c, 0x00000058, 0x00000058, 0x00000000, 0x00202020, 0x000000bc, 0x0000007c, 0x0000007c, 0x00000098, 0x000000a4, 0x000000a4, 0x00000098, 0x00000058, 0x00000040, 0x00000000,
-		0x00000000, 0x00000098, 0x0000007c, 0x00000088, 0x000000a4, 0x00000088, 0x00000088, 0x00000070, 0x00000099, 0x000000a4, 0x000000a4, 0x00000070, 0x00000070, 0x00000064, 0x00000058, 0x00000064, 0x00000064, 0x00000064, 0x0000007c, 0x0000007c, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x000000a4, 0x000000bc, 0x000000b0, 0x000000b0, 0x000000b0, 0x00000098, 0x00000098, 0x000000b0, 0x000000bc, 0x000000bc, 0x000000a4, 0x000000a5, 0x00000064, 0x00000064, 0x00000088, 0x0000007c, 0x0000007c, 0x00000064, 0x00000058, 0x00000000, 0x00202020, 0x000001a4, 0x000000a4, 0x00000098, 0x0000007c, 0x000000a4, 0x0000007c, 0x00000058, 0x00000000, 0x00202020, 0x000000bc, 0x0000007c, 0x000000bc, 0x000000a4, 0x0000007c, 0x00000098, 0x00000098, 0x00010058, 0x00000040, 0x00000000,
-		0x00000000, 0x00000098, 0x00000088, 0x00000098, 0x0000007c, 0x0000007c, 0x000000a4, 0x00000088, 0x00000064, 0x0000007c, 0x00000058, 0x0000007c, 0x00000064, 0x00000058, 0x00000064, 0x0000007c, 0x00000040, 0x00000058, 0x00000040, 0x00000040, 0x00000064, 0x00000040, 0x00000000, 0x00202020, 0x000000a4, 0x000000bc, 0x000000a4, 0x000000a4, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000bc, 0x000000b0, 0x000000b0, 0x000000a4, 0x00000064, 0x00000064, 0x00000070, 0x000000a4, 0x00000064, 0x00000064, 0x00000040, 0x00000000, 0x00202020, 0x000000a4, 0x0000007c, 0x00000088, 0x00000098, 0x0000007c, 0x00000058, 0x00000058, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x0000007c, 0x0000007c, 0x00000064, 0x00000064, 0x0000007c, 0x0000007c, 0x00010040, 0x00000000,
-		0x00000000, 0x00000098, 0x0000007c, 0x00000098, 0x0000007c, 0x00000064, 0x00000088, 0x00000088, 0x0000007c, 0x00000164, 0x0000007c, 0x00000065, 0x0000007c, 0x00000064, 0x00000040, 0x00000070, 0x00000070, 0x00000040, 0x00000040, 0x00000040, 0x00000064, 0x00010040, 0x00000000, 0x00202020, 0x000000a5, 0x000000b1, 0x000000a4, 0x000000a4, 0x00000098, 0x000000bc, 0x00000098, 0x00000098, 0x000000a4, 0x000000b0, 0x000000b0, 0x000000a4, 0x00000098, 0x00000098, 0x0000007c, 0x0000007c, 0x00000058, 0x00000058, 0x00000064, 0x00000000, 0x00202021, 0x000000a4, 0x00000088, 0x00000088, 0x00000088, 0x00000070, 0x00010070, 0x00000064, 0x00000000, 0x00202020, 0x000100bc, 0x0000007c, 0x00000070, 0x00000064, 0x0000007c, 0x00000064, 0x0000007c, 0x0000007c, 0x00000040, 0x00000000,
-		0x00000000, 0x00000098, 0x00000098, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000070, 0x00000064, 0x00000058, 0x00000058, 0x00000064, 0x0000007c, 0x00000064, 0x00000070, 0x00000064, 0x00000040, 0x00000040, 0x00000070, 0x00000040, 0x00000064, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x000000a4, 0x000000b0, 0x000000e0, 0x000000c8, 0x00000088, 0x00000088, 0x00000098, 0x00000098, 0x00000088, 0x0000007c, 0x0000007c, 0x0000007c, 0x00010088, 0x00000098, 0x00000089, 0x0000007c, 0x00000064, 0x00000064, 0x00000040, 0x00000000, 0x00202021, 0x000000a4, 0x000000a4, 0x00000088, 0x00000088, 0x00000070, 0x00000070, 0x00000064, 0x00000000, 0x00202020, 0x000000bc, 0x0000007c, 0x0000007c, 0x00000070, 0x00000058, 0x00000058, 0x00000058, 0x00000058, 0x00000040, 0x00000000,
-		0x00000000, 0x00000098, 0x0000007c, 0x00000098, 0x00000064, 0x00000064, 0x00000070, 0x00000064, 0x0000007c, 0x00000064, 0x00000140, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00010040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000140, 0x00000000, 0x00202020, 0x000000a4, 0x000000bc, 0x000000c8, 0x000000c8, 0x00000088, 0x00000088, 0x00000088, 0x000000a4, 0x000000a4, 0x0000007c, 0x00000088, 0x00000088, 0x0000007c, 0x00000088, 0x00000070, 0x0000007c, 0x00000064, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x000000a4, 0x0000007c, 0x00000098, 0x000000a4, 0x00000058, 0x00000058, 0x00000058, 0x00000000, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00202120, 0x000000a4, 0x000000bc, 0x000000a4, 0x000000a4, 0x00000098, 0x00000088, 0x00000088, 0x000000a4, 0x000100a4, 0x000000a4, 0x00000088, 0x00000088, 0x00000098, 0x00000064, 0x00000064, 0x0000007c, 0x00000064, 0x00000058, 0x00000140, 0x00000000, 0x00202020, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000098, 0x000000a4, 0x00000058, 0x00000064, 0x00000000, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020,
-		0x000000a4, 0x000000bc, 0x000000b0, 0x000000a4, 0x000000b0, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000b0, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000000, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000a4, 0x000000a4, 0x00000098, 0x00010098, 0x00000000, 0x000000a4, 0x000000b0, 0x00000098, 0x000000a4, 0x00000089, 0x00000098, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a5, 0x0000007c, 0x00000098, 0x00000098, 0x0000007c, 0x0000007c, 0x00000058, 0x00000058, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x00000098, 0x000000a4, 0x00000098, 0x000000a4, 0x00000098, 0x00000070, 0x00000064, 0x00000000, 0x00202020, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000000, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc,
-		0x000000bc, 0x000000b0, 0x000000a4, 0x00000098, 0x000000a4, 0x000000bc, 0x000000b0, 0x000000a4, 0x00000088, 0x000000a4, 0x000000a4, 0x0000007c, 0x000000a4, 0x00000098, 0x0000007c, 0x00000000, 0x000000b0, 0x000000b0, 0x00000098, 0x000000bc, 0x000000bc, 0x0000007c, 0x000000bc, 0x00000000, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000bc, 0x000000a4, 0x00000098, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000088, 0x00000064, 0x00000070, 0x0000007c, 0x00010040, 0x00000040, 0x00000064, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x00000098, 0x00010098, 0x0000007c, 0x00000070, 0x0000007c, 0x00000070, 0x00000058, 0x00000000, 0x00202020, 0x000000a4, 0x000000b0, 0x00000188, 0x0000007c, 0x00000000, 0x000000bc, 0x000000bc, 0x000000a4, 0x000000b0, 0x000000bc,
-		0x000000bc, 0x000000b0, 0x00000098, 0x00000098, 0x00000088, 0x000000a4, 0x000000a4, 0x00000088, 0x0000007c, 0x00000098, 0x00000098, 0x0000007c, 0x0000007c, 0x00000098, 0x00010098, 0x00000000, 0x000000b0, 0x000000bc, 0x000000bc, 0x000000b0, 0x00000098, 0x0000007c, 0x0000007c, 0x00000000, 0x000000a4, 0x000000b0, 0x00000098, 0x000000a4, 0x000000bc, 0x000000a4, 0x00000088, 0x0000007c, 0x00000088, 0x00000088, 0x00000164, 0x0000007c, 0x0000007c, 0x00000070, 0x00000040, 0x00000040, 0x00000064, 0x00000040, 0x00000040, 0x00000000, 0x00202021, 0x00000098, 0x00000098, 0x00000058, 0x00000058, 0x00000058, 0x00000064, 0x00000040, 0x00000000, 0x00202020, 0x000000a4, 0x000000b0, 0x000000b0, 0x0000007c, 0x00000000, 0x000000bc, 0x000000a4, 0x000000b0, 0x000000b0, 0x000001b0,
-		0x000000b0, 0x000000a4, 0x00000099, 0x000000b0, 0x000000b0, 0x00000098, 0x00000098, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000098, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000000, 0x000000b0, 0x000000bc, 0x000000b0, 0x000000b0, 0x00000098, 0x00000098, 0x00000064, 0x00000000, 0x000000a4, 0x000000b0, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000088, 0x000000a4, 0x0000007c, 0x0000007c, 0x00000064, 0x00000070, 0x00000070, 0x00000058, 0x00000058, 0x00000058, 0x00000064, 0x00000064, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x00000098, 0x0000007c, 0x00000058, 0x00000064, 0x00000058, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x000000a4, 0x00000088, 0x0000007c, 0x00000058, 0x00000000, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000b0, 0x000000b0,
-		0x000000a4, 0x00000088, 0x00000098, 0x000000b0, 0x000000bc, 0x000000b0, 0x0000007c, 0x0000007c, 0x00000098, 0x00000098, 0x0000007c, 0x00000098, 0x00000058, 0x0000007c, 0x0000007c, 0x00000000, 0x000001b0, 0x000000bc, 0x00000098, 0x0000007c, 0x00000098, 0x00000098, 0x00000064, 0x00000000, 0x000000a4, 0x000100a4, 0x000000a4, 0x00000098, 0x00000098, 0x00000098, 0x00000098, 0x0000007c, 0x00000064, 0x00000058, 0x00000064, 0x00000064, 0x00000058, 0x00000064, 0x00000064, 0x00000058, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x00000098, 0x0000007c, 0x00000064, 0x00000058, 0x00000058, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x000000a4, 0x00000058, 0x00000064, 0x00000058, 0x00000000, 0x000000bc, 0x000000bc, 0x000000b0, 0x000000b0, 0x000000b0,
-		0x000000a4, 0x000000a4, 0x00000088, 0x00000098, 0x000000b0, 0x000000d4, 0x0000017c, 0x00000098, 0x0000007c, 0x0000007c, 0x00000065, 0x00000064, 0x00000070, 0x0000007c, 0x0000007c, 0x00000000, 0x000000b0, 0x00000098, 0x000000bc, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000064, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x000000a4, 0x000000a4, 0x00000098,
-		0x000000b0, 0x00000088, 0x0000007c, 0x00000088, 0x00000098, 0x000000a4, 0x00000098, 0x0001007c, 0x0000007c, 0x00000098, 0x00000064, 0x00000070, 0x0000007c, 0x00000058, 0x00000058, 0x00000000, 0x000000b0, 0x00000098, 0x00000098, 0x00000064, 0x0000007c, 0x0001007c, 0x00000058, 0x00000000, 0x00202020, 0x00202020, 0x00202020, 0x00202121, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x00202020, 0x00202020, 0x000000bc, 0x000000a4, 0x000000a4, 0x00000098, 0x00000098,
-		0x000000b0, 0x000000a4, 0x00000088, 0x00000098, 0x0000007c, 0x00000098, 0x0000007c, 0x00000098, 0x00000098, 0x0000007c, 0x00000070, 0x0000007c, 0x00000064, 0x0000007c, 0x00000058, 0x00000000, 0x000000b0, 0x000000bc, 0x00000098, 0x00000088, 0x00000064, 0x00000058, 0x00010064, 0x00000000, 0x00202020, 0x000000b1, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x00010098, 0x000000a4, 0x00202020, 0x00202020, 0x000000b0, 0x000000c8, 0x000000b0, 0x000000c8, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000098, 0x00000000, 0x00202020, 0x000000bc, 0x000000b0, 0x00000098, 0x00000098, 0x00000098,
-		0x000000b0, 0x000000b0, 0x00000098, 0x00000088, 0x000000b0, 0x00000098, 0x00000098, 0x00000098, 0x00000098, 0x0000007c, 0x0000007c, 0x00000070, 0x00000058, 0x00000058, 0x00000058, 0x00000000, 0x000000a4, 0x000000bd, 0x0000017c, 0x00000088, 0x00000088, 0x00000064, 0x00000058, 0x00000000, 0x00202020, 0x000000b0, 0x000000bc, 0x000000b0, 0x000000a4, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000b0, 0x000000bc, 0x000000a4, 0x000000b0, 0x000000a4, 0x000000bc, 0x000000b0, 0x0000007c, 0x000000a4, 0x000000bc, 0x000000bc, 0x000000bc, 0x0000007c, 0x000000a4, 0x00000058, 0x00000000, 0x00202020, 0x000100b0, 0x000000c8, 0x000000b0, 0x000000c8, 0x000000c8, 0x000000a4, 0x00000098, 0x00000088, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x00000098, 0x00000098, 0x00000098,
-		0x000000b0, 0x000000a4, 0x00000088, 0x0000007c, 0x00000088, 0x000000b0, 0x000000b0, 0x00000064, 0x0000007c, 0x00000098, 0x00000088, 0x00000088, 0x00000070, 0x00000058, 0x00000064, 0x00000000, 0x000000a4, 0x0000007c, 0x00000064, 0x00000070, 0x00000070, 0x00000058, 0x00000064, 0x00000000, 0x00202020, 0x000000b0, 0x000000bc, 0x000000a4, 0x000000b0, 0x000000c8, 0x000000e0, 0x000000e0, 0x000000bc, 0x000000d4, 0x000000e0, 0x000000a4, 0x000000bc, 0x000000a4, 0x000000a4, 0x000000bc, 0x000000bc, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x0000007c, 0x00000058, 0x00000000, 0x00202020, 0x000000b0, 0x000000c8, 0x000000c8, 0x000000c8, 0x000000c8, 0x000000a4, 0x00000088, 0x0000007c, 0x00000000, 0x00202020, 0x000000bc, 0x000000b0, 0x000000bc, 0x000000a4, 0x000000a4,
-		0x000000a4, 0x00000098, 0x0000007c, 0x00000088, 0x000000a4, 0x000000b0, 0x000000b0, 0x000001a4, 0x00000098, 0x0000007c, 0x00000088, 0x00000088, 0x00000070, 0x00000058, 0x00000064, 0x00000000, 0x00000098, 0x0000007c, 0x00000058, 0x00000058, 0x00010058, 0x00000058, 0x00000064, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x000000a4, 0x000000bc, 0x000000d4, 0x000000d4, 0x000000e0, 0x000000bc, 0x000000e0, 0x000000d4, 0x000000d4, 0x000000b0, 0x0000007c, 0x000000a4, 0x0000007c, 0x0000007c, 0x000000a5, 0x0000007c, 0x0000007c, 0x000000a4, 0x00000058, 0x00000058, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x000000a4, 0x000000c8, 0x000001a4, 0x00000089, 0x000000a4, 0x00000064, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000a4, 0x000000a4,
-		0x000000b0, 0x00000098, 0x000000b0, 0x00000098, 0x00000098, 0x000000a4, 0x000000b0, 0x000000a4, 0x00000064, 0x0000007c, 0x00000070, 0x00000070, 0x00010070, 0x00000058, 0x00000058, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00202120, 0x000000b0, 0x000000bc, 0x000000bc, 0x000000b0, 0x000000b0, 0x000000c8, 0x000000c8, 0x000000a5, 0x000000a4, 0x000000d4, 0x000000d4, 0x000000a4, 0x000000a4, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000070, 0x000000a4, 0x0000007c, 0x0000007c, 0x00000058, 0x00000058, 0x00000000, 0x00202020, 0x000000b0, 0x000000c8, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000088, 0x00000064, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000b0, 0x000000b0,
-		0x000000a4, 0x00000088, 0x00000088, 0x000000a4, 0x000000a4, 0x00000098, 0x000000a4, 0x000000a4, 0x00000064, 0x00000070, 0x00000058, 0x00000064, 0x00000058, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202021, 0x00202020, 0x00202020, 0x00202020, 0x000000b0, 0x000000b0, 0x000000bc, 0x000000b0, 0x000000b0, 0x000000b0, 0x000001a4, 0x000000a4, 0x000000a4, 0x000000bc, 0x000000a4, 0x000000a4, 0x000000a4, 0x0000007c, 0x00000088, 0x00000088, 0x0000007c, 0x0000007c, 0x00000058, 0x00000058, 0x00000058, 0x00000064, 0x00000000, 0x00202020, 0x000000b0, 0x000000c8, 0x000000c8, 0x000000a4, 0x000000a4, 0x00000088, 0x0000007c, 0x00000070, 0x00000000, 0x00202020, 0x000000bc, 0x000000a4, 0x000000a4, 0x000000bc, 0x000000b0,
-		0x000000a4, 0x00000098, 0x00000088, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000098, 0x0000007c, 0x00000070, 0x00000064, 0x00000058, 0x00000064, 0x00000064, 0x00000058, 0x00000058, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000a4, 0x000000a4, 0x00202020, 0x00202020, 0x000000b0, 0x000000a4, 0x000000a4, 0x000000bc, 0x000000b0, 0x00000088, 0x00000088, 0x000000a4, 0x000000bc, 0x000000b0, 0x0000007c, 0x000000a4, 0x000000a4, 0x0000007c, 0x00000088, 0x00000088, 0x00000088, 0x00000070, 0x00000070, 0x00000070, 0x00000058, 0x00000058, 0x00000000, 0x00202020, 0x000000b0, 0x000000c8, 0x000000c8, 0x00000098, 0x00000098, 0x000000a4, 0x000000a4, 0x00000058, 0x00000000, 0x00202020, 0x000000bc, 0x000000a4, 0x000000a4, 0x000000b0, 0x000001b0,
-		0x00000098, 0x00000088, 0x00000098, 0x00000088, 0x000001a4, 0x000000a4, 0x0000007c, 0x00000064, 0x00000064, 0x00000058, 0x00000058, 0x00000058, 0x00000064, 0x00000040, 0x00000064, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x00000088, 0x000000a4, 0x00000098, 0x00000088, 0x00000000, 0x00202120, 0x000000b0, 0x000000bc, 0x000000b0, 0x000000bc, 0x000000b0, 0x00000088, 0x00000088, 0x000000a4, 0x000000a4, 0x000000a4, 0x0000007c, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000070, 0x00000088, 0x00000088, 0x00000058, 0x00000070, 0x00000070, 0x00000070, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x000000c8, 0x00000098, 0x00000098, 0x00000098, 0x000000a4, 0x00000058, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x00000098, 0x00000098, 0x0000007c,
-		0x00000098, 0x00000188, 0x00000088, 0x0000017c, 0x00000088, 0x00000088, 0x0000007c, 0x00000064, 0x00000064, 0x00000070, 0x0000007c, 0x0000007c, 0x00000064, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000a4, 0x000000a4, 0x00000098, 0x00000088, 0x00000098, 0x00000000, 0x00202020, 0x000000b0, 0x000000bc, 0x000000bc, 0x000000a4, 0x000000b0, 0x000000b0, 0x000000b0, 0x00000098, 0x000000a4, 0x0000007c, 0x0000007c, 0x0000007c, 0x000000a4, 0x000000a4, 0x00000070, 0x00000058, 0x00000064, 0x00000058, 0x00000065, 0x00000070, 0x00000070, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x000000a4, 0x00000088, 0x000000b0, 0x000000a4, 0x000000a5, 0x00000064, 0x00000000, 0x00202020, 0x000000bc, 0x00000088, 0x00000088, 0x00000098, 0x00000098,
-		0x00000098, 0x00000088, 0x000000a4, 0x00000098, 0x00000070, 0x0000007c, 0x0000007c, 0x00000070, 0x00000064, 0x00000070, 0x0000007c, 0x0000007c, 0x00000064, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000a4, 0x00000098, 0x00000088, 0x00000070, 0x00000064, 0x00000000, 0x00202020, 0x000000b0, 0x000000bc, 0x000000a4, 0x0000007c, 0x000000a4, 0x000000b0, 0x000000b0, 0x000000a4, 0x000000a4, 0x0000007c, 0x00000070, 0x0000007c, 0x00000064, 0x00000070, 0x00000070, 0x00000070, 0x00000058, 0x00000040, 0x00000040, 0x00000058, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x000000c8, 0x00000088, 0x000000b0, 0x000000b0, 0x00000098, 0x00000064, 0x00000000, 0x00202020, 0x000000bc, 0x00010088, 0x00000089, 0x0000007c, 0x0000007c,
-		0x00000098, 0x000000a4, 0x00010098, 0x00000088, 0x00010088, 0x0000007c, 0x00000064, 0x00000164, 0x00000058, 0x0000004c, 0x0000004c, 0x00000071, 0x00000064, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x00000088, 0x000000b0, 0x00000088, 0x00000058, 0x00000000, 0x00202020, 0x000000b0, 0x000000a4, 0x000000a4, 0x000000bc, 0x0000007c, 0x000000a4, 0x000000a4, 0x00000098, 0x0000007c, 0x00000070, 0x0000007c, 0x0000007c, 0x00000064, 0x00000064, 0x00000070, 0x00000070, 0x00000064, 0x00000040, 0x00000040, 0x00000064, 0x00000064, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000a4, 0x000000c8, 0x000000a4, 0x00000088, 0x00000098, 0x00000198, 0x00000058, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x0000007c, 0x0000007c, 0x0000007c,
-		0x0000007c, 0x00000098, 0x00000098, 0x00000188, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000058, 0x0000004c, 0x0000004c, 0x00000058, 0x00000058, 0x00000065, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000100b0, 0x000000b0, 0x00000070, 0x00000070, 0x00000064, 0x00000000, 0x00202020, 0x000000b0, 0x0000007c, 0x000000bc, 0x0000007c, 0x000000a4, 0x000000a4, 0x0000007c, 0x0000007c, 0x00000070, 0x00000064, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000064, 0x00000064, 0x00000058, 0x00000058, 0x00000064, 0x00000064, 0x00000064, 0x0000004c, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000c8, 0x000000a4, 0x000000a4, 0x00000098, 0x00000058, 0x00000070, 0x00000064, 0x00000000, 0x00202020, 0x000000bc, 0x000000a4, 0x000000a4, 0x00000098, 0x00000098,
-		0x0000007c, 0x00000088, 0x00000089, 0x0000007c, 0x00000070, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000058, 0x00000058, 0x00000064, 0x00000058, 0x00000058, 0x00000058, 0x00000058, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000a4, 0x00000058, 0x00000058, 0x00000000, 0x00202020, 0x000100b0, 0x000000a4, 0x000000bc, 0x0000007c, 0x000000a4, 0x000000a4, 0x00000070, 0x00000064, 0x00000064, 0x00000058, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000064, 0x00000058, 0x00000058, 0x00000058, 0x00000058, 0x0000004c, 0x0000004c, 0x0000004c, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000c8, 0x000000a4, 0x00000098, 0x0000007c, 0x00000098, 0x00000070, 0x00010058, 0x00000000, 0x00202020, 0x000000bc, 0x000000a4, 0x000000a4, 0x00000098, 0x00000088,
-		0x0000007c, 0x00000088, 0x00000064, 0x00000070, 0x0000007c, 0x00000064, 0x0000007c, 0x0000007c, 0x00000158, 0x00000064, 0x00000058, 0x00000040, 0x00000058, 0x00000064, 0x00000058, 0x00000000, 0x00202020, 0x000000b0, 0x00000098, 0x00000098, 0x00000058, 0x00000088, 0x00000064, 0x00000000, 0x00202020, 0x000000b0, 0x000000a4, 0x0000007c, 0x000000a5, 0x000000a4, 0x0000007c, 0x00000058, 0x00000058, 0x00000059, 0x00000058, 0x00000064, 0x00000064, 0x00000064, 0x00000064, 0x00010058, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00202120, 0x000000b0, 0x000000c8, 0x000000a4, 0x0000007c, 0x00000098, 0x00000098, 0x0000007c, 0x00000064, 0x00000000, 0x00202020, 0x000000bc, 0x00000098, 0x000000a4, 0x000000a4, 0x0000007c,
-		0x0000007c, 0x00000098, 0x0000007c, 0x00000064, 0x0000007c, 0x00000064, 0x00000070, 0x00000058, 0x00000064, 0x00000040, 0x00010040, 0x00000058, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x00000098, 0x00000098, 0x000000b0, 0x00000058, 0x00000065, 0x00000000, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00202020, 0x000000a4, 0x000000b0, 0x000000a4, 0x0000007c, 0x00000064, 0x0000007c, 0x0000007c, 0x00000064, 0x00000000, 0x00202020, 0x000000bc, 0x00000098, 0x00000088, 0x00000088, 0x0001007c,
-		0x0000007c, 0x00000088, 0x00000098, 0x00000088, 0x00010070, 0x0000007c, 0x00000070, 0x00000058, 0x00000058, 0x00000058, 0x00000040, 0x00000064, 0x00000040, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x00000088, 0x000000b0, 0x00000088, 0x00000058, 0x00000000, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202021, 0x00202020, 0x00202020, 0x00202020, 0x000000a4, 0x000000b0, 0x000000b0, 0x000000a4, 0x0000007c, 0x00010058, 0x00000064, 0x00000040, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x00000088, 0x00000088, 0x0000007c,
-		0x0000007c, 0x00000098, 0x00000088, 0x0000007c, 0x00000064, 0x00000070, 0x0000007c, 0x00000070, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x00000088, 0x00000088, 0x00000058, 0x00000064, 0x00000000, 0x00202020, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x00202020, 0x00202020, 0x000000a4, 0x000000b0, 0x000000a4, 0x000000bc, 0x000000a4, 0x0000007c, 0x00000064, 0x00000040, 0x00000000, 0x00202020, 0x000000bc, 0x00000098, 0x00000098, 0x0000007c, 0x00000088,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x0000007c, 0x0000007c, 0x00000058, 0x00000058, 0x00000000, 0x00202020, 0x000000a4, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000001bc, 0x000000b1, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000098, 0x00000088, 0x0000007c, 0x000000bc, 0x00000098, 0x000000a4, 0x0000007c, 0x00000000, 0x00202020, 0x000000a4, 0x000000c8, 0x000100a4, 0x000000a4, 0x000000bc, 0x00000088, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00000058, 0x00000058, 0x00010070, 0x00000070, 0x00000088, 0x00000088, 0x00000088, 0x0000007c, 0x00000070, 0x00000064, 0x00202020, 0x00202020, 0x000000a4, 0x000000b0, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000058, 0x00000000, 0x00202020, 0x000000b0, 0x000000bc, 0x000000c8, 0x000000c8, 0x000000bc, 0x000000a4, 0x000000a4, 0x000000b0, 0x000000b0, 0x000000c8, 0x000000bc, 0x00000098, 0x00000098, 0x000000a4, 0x000000a4, 0x00000098, 0x0000007c, 0x00000088, 0x0000007c, 0x00000088, 0x00000098, 0x0000007c, 0x00000000, 0x00202020, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000088, 0x00000088, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x00000088, 0x00000098, 0x00000088, 0x00000088, 0x00000000,
-		0x00202020, 0x00000098, 0x000000a4, 0x000000b0, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x00202020, 0x00202020, 0x000000a4, 0x000000a4, 0x00000088, 0x0001007c, 0x0000007c, 0x00000064, 0x00000000, 0x00202020, 0x000000b0, 0x000000bc, 0x000000c8, 0x000000c8, 0x000000c8, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000bc, 0x000000bc, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000098, 0x00000098, 0x0000007c, 0x00000064, 0x00000000, 0x00212020, 0x000000a4, 0x000001c8, 0x000000a4, 0x0000007c, 0x00000070, 0x00000058, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x00000098, 0x00000098, 0x0000007c, 0x0000007c, 0x00000000,
-		0x00202020, 0x000000a4, 0x000001bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000b0, 0x000000a4, 0x000000b0, 0x000000bc, 0x000000a4, 0x000000a4, 0x000000a5, 0x000000bc, 0x00000000, 0x00202020, 0x000000a4, 0x000000a4, 0x00000098, 0x00000058, 0x00000064, 0x00000064, 0x00000000, 0x00202020, 0x000000b0, 0x000001bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000d4, 0x000000d4, 0x000000b0, 0x000000b0, 0x000000b0, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000098, 0x0000007c, 0x0000007c, 0x00000070, 0x00000098, 0x00000064, 0x00000000, 0x00202020, 0x000000a4, 0x000000b0, 0x00000088, 0x00000070, 0x00000064, 0x00000058, 0x00000070, 0x00000041, 0x00000000, 0x00202020, 0x00000098, 0x0000007c, 0x00000070, 0x00000070, 0x00000000,
-		0x00202020, 0x000000a4, 0x000000bc, 0x000000b0, 0x000000b0, 0x000000d4, 0x000000d4, 0x000000b0, 0x000000bd, 0x000000bc, 0x000000bc, 0x00000098, 0x000000a4, 0x000000bc, 0x000100bc, 0x00000000, 0x00202020, 0x000000a4, 0x00000098, 0x00000088, 0x00000058, 0x00000058, 0x00000058, 0x00000000, 0x00202020, 0x000000b0, 0x000000bc, 0x000000bc, 0x000000b0, 0x000000bc, 0x000000d4, 0x000000d4, 0x000000d4, 0x0000007c, 0x000000a4, 0x00000098, 0x0000007c, 0x0000007c, 0x00000070, 0x00000070, 0x00000070, 0x00000088, 0x0000007c, 0x0001007c, 0x0000007c, 0x0000007c, 0x00000064, 0x00000000, 0x00202020, 0x000001a4, 0x000000a4, 0x00000070, 0x00000064, 0x00000070, 0x00000058, 0x00010058, 0x00000040, 0x00000000, 0x00202020, 0x00000098, 0x00000070, 0x0000007c, 0x00000058, 0x00000000,
-		0x00202020, 0x000000bc, 0x000000bc, 0x000100bc, 0x000000b0, 0x000000d4, 0x000000d4, 0x000000bc, 0x00000098, 0x00000098, 0x000000a4, 0x000000bc, 0x000000bc, 0x00000098, 0x000000b0, 0x00000000, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00202020, 0x000000a4, 0x000000b1, 0x000000bc, 0x000000b0, 0x000000bc, 0x000000bc, 0x000000d4, 0x000000d4, 0x000000bc, 0x000000a4, 0x000100a4, 0x00000098, 0x0000007c, 0x00000070, 0x00000070, 0x00000065, 0x00000065, 0x00000058, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000064, 0x00000000, 0x00202020, 0x00000088, 0x0000007c, 0x0000007c, 0x00000058, 0x00000058, 0x00000058, 0x00000064, 0x00000040, 0x00000000, 0x00202020, 0x00000088, 0x0000007c, 0x00000070, 0x00000058, 0x00000000,
-		0x00202020, 0x000000bc, 0x000000a4, 0x000000b0, 0x000000a4, 0x000000b0, 0x000000b0, 0x000000b0, 0x00000099, 0x00000098, 0x00000098, 0x000000bc, 0x000000a4, 0x00000088, 0x00000088, 0x00000000, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x000000a4, 0x000000a5, 0x000000b0, 0x000000c8, 0x00000098, 0x00000098, 0x000000bc, 0x000000a4, 0x000000bc, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x0000007c, 0x0000007c, 0x00000064, 0x00000064, 0x0000007c, 0x00000064, 0x00000059, 0x0000004c, 0x0000004c, 0x00000000, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00202020, 0x00000088, 0x00000070, 0x00000059, 0x00000064, 0x00000000,
-		0x00202020, 0x000000bc, 0x000000bc, 0x000000b0, 0x00000098, 0x00000088, 0x000000b0, 0x000000b0, 0x000000a4, 0x00000098, 0x00000098, 0x000000a4, 0x000000bd, 0x000000bc, 0x000000a4, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x000000b0, 0x000000a4, 0x000000a4, 0x00000098, 0x00202020, 0x00202020, 0x000000a4, 0x000000a4, 0x000100c8, 0x000000c8, 0x00000098, 0x00000098, 0x00000098, 0x000000b0, 0x000000a5, 0x000000a4, 0x000001a4, 0x0000007c, 0x0000007c, 0x00000098, 0x00000088, 0x00000070, 0x00000064, 0x00000064, 0x00000058, 0x00000058, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202021, 0x00202020, 0x00202020, 0x00202020, 0x00000000,
-		0x00202020, 0x000000bc, 0x000000bc, 0x00000098, 0x000000a4, 0x000000bc, 0x000000b0, 0x00000088, 0x000000a4, 0x000000b0, 0x000000b0, 0x000000b0, 0x0000007c, 0x000000a4, 0x000000a4, 0x00000000, 0x00202020, 0x000000bc, 0x0000007c, 0x000000bc, 0x00000088, 0x00000098, 0x00000088, 0x00000000, 0x00202020, 0x000000a4, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000b0, 0x00000198, 0x00000098, 0x000000bc, 0x000000bc, 0x000000bd, 0x000000a4, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000064, 0x00000064, 0x00000064, 0x00000058, 0x00000058, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000100bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x00000000,
-		0x00202020, 0x000000bd, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000a4, 0x00000088, 0x000000bc, 0x00000088, 0x000000b0, 0x0000007c, 0x0000007c, 0x000000a4, 0x00000088, 0x000000a4, 0x00000000, 0x00202020, 0x000000bc, 0x000000a4, 0x000000b0, 0x000000b0, 0x00000098, 0x0000007d, 0x00000000, 0x00202020, 0x000000a4, 0x000000b0, 0x000000a4, 0x000000a4, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000bc, 0x000100bc, 0x000000bc, 0x000000bc, 0x000000a5, 0x0000007c, 0x00000088, 0x00000070, 0x00000058, 0x00000164, 0x00000064, 0x00000064, 0x00000070, 0x00000058, 0x0000004c, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x000000a4, 0x000000a4, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000a4, 0x00000088, 0x000000bc, 0x000000a4, 0x000000a4, 0x0000007c, 0x00000000,
-		0x00202020, 0x000000bc, 0x000000a4, 0x000000bc, 0x00000098, 0x000000a4, 0x000000a4, 0x000000bc, 0x000000b0, 0x00000098, 0x0000007c, 0x0000004c, 0x0000007c, 0x000000a4, 0x000000a4, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x0000017c, 0x000000a4, 0x0000007c, 0x00000070, 0x00000000, 0x00202020, 0x000000a4, 0x000000bc, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000098, 0x000000a4, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000058, 0x00000058, 0x00000058, 0x00000058, 0x00000164, 0x00000070, 0x00000070, 0x00000064, 0x00000000, 0x00202020, 0x000000b0, 0x000000a4, 0x000001b0, 0x000000d4, 0x000000d4, 0x000000b0, 0x000000b0, 0x000000b0, 0x00000098, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000098, 0x0000007c, 0x00000000,
-		0x00202020, 0x000000bc, 0x000100b0, 0x00000098, 0x00000098, 0x000000bc, 0x000000e0, 0x000000bc, 0x000000a4, 0x00000088, 0x000000a4, 0x0001007c, 0x0000007c, 0x000000a4, 0x000000a4, 0x00000000, 0x00202020, 0x000000bc, 0x000000b0, 0x000000a4, 0x000000a4, 0x0000007c, 0x000001a4, 0x00000000, 0x00202020, 0x000000a4, 0x000000bc, 0x000100bc, 0x000001a4, 0x000000a4, 0x000000bc, 0x00000088, 0x00000088, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000070, 0x00000058, 0x00000058, 0x00000064, 0x00000058, 0x0000004c, 0x0000004c, 0x0000004c, 0x00000000, 0x00202020, 0x000000b0, 0x000000bc, 0x000000bc, 0x000000d4, 0x000000c8, 0x000000c8, 0x000000b0, 0x000000b0, 0x00000088, 0x00000088, 0x000000a4, 0x00000098, 0x0000007c, 0x00000064, 0x00000000,
-		0x00202020, 0x000000bc, 0x000000a4, 0x000000bc, 0x000000a4, 0x000000e0, 0x004040fc, 0x000000e0, 0x00000098, 0x00000098, 0x000000a4, 0x00000098, 0x00000088, 0x0000007c, 0x00000088, 0x00000000, 0x00202020, 0x000000bc, 0x000000b0, 0x000000a4, 0x0000007c, 0x000000a4, 0x00000070, 0x00000000, 0x00202020, 0x000100a4, 0x000000a4, 0x000000bc, 0x00000098, 0x00000098, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000088, 0x000000a4, 0x000000a4, 0x000000a4, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000064, 0x00000064, 0x00000058, 0x00000058, 0x00000058, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x00000098, 0x000000bc, 0x00000098, 0x000000c8, 0x000000c8, 0x000000b0, 0x000000b0, 0x000000a4, 0x000000a4, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000058, 0x00000000,
-		0x00202020, 0x000000bc, 0x000000b0, 0x000000bc, 0x000000b0, 0x000000bc, 0x000000e1, 0x000000bc, 0x000000a4, 0x0000007c, 0x000000a4, 0x000000a4, 0x0000004c, 0x0000004c, 0x00000064, 0x00000000, 0x00202020, 0x000000bc, 0x000000a4, 0x000000b0, 0x000000b0, 0x0000007c, 0x00000064, 0x00000000, 0x00202020, 0x000001a4, 0x000000a4, 0x000000bc, 0x000000a4, 0x00000088, 0x00000088, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000088, 0x0000007c, 0x00000088, 0x00000058, 0x00000058, 0x00000098, 0x00000098, 0x00000070, 0x00000170, 0x00000058, 0x0000004c, 0x00000140, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000bc, 0x000000b0, 0x00000098, 0x00000098, 0x00000098, 0x000000a4, 0x000000a4, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000058, 0x00000064, 0x00000000,
-		0x00202020, 0x000000bc, 0x000000a4, 0x000000bc, 0x000000b0, 0x000000b0, 0x000000b0, 0x00000088, 0x00000088, 0x00000088, 0x0000007c, 0x00000070, 0x0000004d, 0x0000004c, 0x00000064, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x000000b0, 0x00000098, 0x00000088, 0x00000064, 0x00000000, 0x00202020, 0x000000a4, 0x00000098, 0x000000bc, 0x000000bc, 0x00000098, 0x000000bc, 0x0000007c, 0x0000007c, 0x00010088, 0x0000007c, 0x0000007c, 0x00000088, 0x0000007c, 0x00000058, 0x00000098, 0x00000098, 0x00000088, 0x00000070, 0x00000070, 0x00000064, 0x00000058, 0x00000064, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x000000a4, 0x00000098, 0x00000098, 0x00000098, 0x000000a4, 0x0000007c, 0x00000070, 0x00000064, 0x0000007c, 0x00000058, 0x00000058, 0x00000064, 0x00000000,
-		0x00202020, 0x000000a4, 0x000000bc, 0x000000b0, 0x000001b0, 0x000000a4, 0x0000007c, 0x0000007c, 0x00000098, 0x000000a4, 0x00000098, 0x00000098, 0x0000007c, 0x00000064, 0x00000064, 0x00000000, 0x00202020, 0x000000bc, 0x000000b0, 0x000000a4, 0x00000088, 0x00000088, 0x0000007c, 0x00000000, 0x00202020, 0x000000a4, 0x000000bc, 0x00000098, 0x000000a4, 0x000000bc, 0x000100a4, 0x00000088, 0x0000007c, 0x00000070, 0x00000070, 0x00000088, 0x00000088, 0x00000058, 0x00000058, 0x0000007c, 0x00000098, 0x00000098, 0x0000007c, 0x00000070, 0x00000058, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x00000098, 0x000000a4, 0x00000198, 0x00000098, 0x000000a4, 0x0000007c, 0x00000070, 0x00000064, 0x00000070, 0x0000007c, 0x00000058, 0x00000058, 0x00000000,
-		0x00202020, 0x000000bc, 0x000000a4, 0x000000bc, 0x000000b0, 0x00000088, 0x00000088, 0x000000b0, 0x0000007c, 0x000000a4, 0x000000a4, 0x00000098, 0x00000070, 0x0000007c, 0x00000058, 0x00000000, 0x00202020, 0x000000bc, 0x000000a5, 0x000000bc, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000000, 0x00202020, 0x000000a4, 0x000000bc, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000098, 0x00000088, 0x000000a4, 0x000000a4, 0x00000070, 0x00000070, 0x00000058, 0x00000070, 0x00000058, 0x00000058, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000164, 0x00000058, 0x00000058, 0x00000040, 0x00000000, 0x00202020, 0x000000b0, 0x000000b0, 0x000000bc, 0x000100b0, 0x00000088, 0x000000b0, 0x000000b0, 0x00000098, 0x0000007c, 0x00000064, 0x00000098, 0x00000098, 0x00000058, 0x00000041, 0x00000000,
-		0x00202020, 0x000000bc, 0x000000a4, 0x000000bc, 0x000000a4, 0x00000098, 0x00000088, 0x0000007c, 0x00000064, 0x00000088, 0x000000a4, 0x000000a4, 0x00000098, 0x00000070, 0x00000064, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x000000a4, 0x00000064, 0x00000064, 0x00000064, 0x00000000, 0x00202020, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000098, 0x00000098, 0x0000007c, 0x00000088, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000070, 0x00000064, 0x00000070, 0x00000070, 0x00000058, 0x0000004c, 0x0000004c, 0x0000004c, 0x00000064, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x000000b0, 0x00000088, 0x000000a4, 0x000000b0, 0x000000b0, 0x000000b0, 0x00000098, 0x0000007c, 0x00000098, 0x00000098, 0x0000007c, 0x00000040, 0x00000000,
-		0x00202020, 0x000000b0, 0x000000a4, 0x00000088, 0x00000088, 0x00000088, 0x000000a4, 0x00000064, 0x0000004c, 0x00000064, 0x00000088, 0x00000098, 0x00000198, 0x00000070, 0x00000070, 0x00000000, 0x00202020, 0x000000bc, 0x000000b0, 0x000000a4, 0x0000007c, 0x00000070, 0x00000058, 0x00000000, 0x00202020, 0x000000a4, 0x000000b0, 0x000000a4, 0x00000098, 0x00000098, 0x000000bc, 0x000000a4, 0x0000007c, 0x000000a4, 0x000000a4, 0x00000058, 0x00000058, 0x00000070, 0x00000070, 0x00000064, 0x00000058, 0x00000040, 0x00000040, 0x00000058, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x000000bc, 0x000000b0, 0x000000a4, 0x00000088, 0x000000a4, 0x000000a4, 0x000000b0, 0x000000b0, 0x00000098, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000017c, 0x00000140, 0x00000000,
-		0x00202020, 0x000000b0, 0x000000a4, 0x00000070, 0x00000064, 0x00000088, 0x00000064, 0x000000a4, 0x0000007c, 0x0000007d, 0x00000098, 0x00000058, 0x00000064, 0x00000058, 0x00000058, 0x00000000, 0x00202020, 0x000000b0, 0x000000a4, 0x00000064, 0x00000064, 0x00000064, 0x00000058, 0x00000000, 0x00202020, 0x000000a4, 0x000000b0, 0x000000bc, 0x0001007c, 0x000001bc, 0x000000bc, 0x000000a4, 0x00000058, 0x00000064, 0x00000064, 0x00000064, 0x00000058, 0x00000058, 0x0000004c, 0x0000004c, 0x0000004c, 0x00000040, 0x00000040, 0x0000004c, 0x00000058, 0x00000040, 0x00000040, 0x00000000, 0x00202020, 0x000000bc, 0x000000b0, 0x000000a4, 0x000000bc, 0x000000a4, 0x000000a4, 0x0001017c, 0x00000088, 0x00000170, 0x00000070, 0x0000007c, 0x0000007c, 0x00000058, 0x00000041, 0x00000000,
-		0x00202020, 0x000000a4, 0x000000a4, 0x00000088, 0x00000088, 0x00000064, 0x00000088, 0x00000059, 0x00000064, 0x00010058, 0x00000064, 0x00000070, 0x00000064, 0x00000070, 0x00010064, 0x00000000, 0x00202020, 0x000000b0, 0x000000a4, 0x00000088, 0x00000070, 0x00000064, 0x00000064, 0x00000000, 0x00202020, 0x000000a4, 0x000000a5, 0x000000b0, 0x000000bc, 0x000000a4, 0x0000007c, 0x00000098, 0x00000058, 0x00000064, 0x00000064, 0x00000064, 0x00000058, 0x00000058, 0x00000040, 0x00000040, 0x00000070, 0x00000070, 0x00000064, 0x00000040, 0x0000004c, 0x00000040, 0x00000058, 0x00000000, 0x00202020, 0x000000bc, 0x000000bc, 0x000000bc, 0x00000098, 0x000000a4, 0x0000007c, 0x0000007c, 0x00000070, 0x0000007c, 0x0000007c, 0x00000070, 0x00000064, 0x00000040, 0x00000064, 0x00000000,
-		0x00202020, 0x000000a4, 0x00000098, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000070, 0x00000070, 0x00000070, 0x00000070, 0x0000007c, 0x0000007c, 0x0000007c, 0x00202020, 0x00202020, 0x000000a4, 0x00000088, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00202020, 0x00202020, 0x000000a4, 0x000000a4, 0x00000098, 0x000000a4, 0x00000098, 0x0000007c, 0x0000007d, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000070, 0x00000064, 0x00000058, 0x00000058, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000058, 0x00000058, 0x00000071, 0x00202020, 0x00202020, 0x000000bc, 0x000000a4, 0x000000a4, 0x0000007c, 0x00000098, 0x000000a4, 0x0000007c, 0x0000007c, 0x0001007c, 0x0000007c, 0x0000007c, 0x00000070, 0x00010070, 0x0000007c, 0x00000000,
-		0x00383838, 0x00000088, 0x00000088, 0x00000089, 0x0000007c, 0x0000007c, 0x0000007c, 0x0001007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00383838, 0x00383838, 0x00000088, 0x00000088, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00383838, 0x00383838, 0x000000a4, 0x000000c8, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007d, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00383838, 0x00383838, 0x000000bc, 0x00000088, 0x00000088, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00202020,
-		0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545455, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00383838};
-	// 'colorstone', 64x64px
-	const unsigned int colorstone[] = {
-		0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00483818, 0x00543c1c, 0x005c4020, 0x005c4020, 0x00744c28, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4120, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00403018, 0x00483818, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00707070, 0x00707070, 0x00707170, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00484848, 0x00646464, 0x00707070, 0x00545454, 0x00646464, 0x00555454, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00555454, 0x005c5c5c, 0x005c5c5c, 0x00646464, 0x00707070, 0x007c7c7c,
-		0x007c7c7c, 0x00707070, 0x00707070, 0x00545454, 0x00483818, 0x00543c1c, 0x005c4020, 0x00744c28, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4120, 0x005c4020, 0x00543c1c, 0x00403018, 0x00483818, 0x005c4020, 0x005c4020, 0x005d4020, 0x00543c1c, 0x00483818, 0x00483818, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x007c7c7c, 0x00707070, 0x007c7c7c, 0x007c7c7c, 0x00494848, 0x002c2c2d, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00484848, 0x00646464, 0x00707070, 0x00545454, 0x00656464, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x00545454, 0x00545454, 0x005c5c5c, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00707070,
-		0x00707070, 0x00707070, 0x00707070, 0x00646464, 0x00545454, 0x00483818, 0x00543c1c, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4021, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005d4020, 0x00543c1d, 0x00403018, 0x00483818, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00484848, 0x00545454, 0x00646464, 0x00646464, 0x00484848, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00484848, 0x00646464, 0x00646464, 0x00484848, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00484848, 0x00646464, 0x00707070, 0x00545454, 0x00646464, 0x00545454, 0x004c4c4c, 0x00545454, 0x005c5c5c, 0x00656464, 0x00646464, 0x00646465, 0x00646464, 0x00646465, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464,
-		0x00555454, 0x00707070, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00483818, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00553c1c, 0x00553c1c, 0x005c4020, 0x005c4120, 0x005c4021, 0x005c4020, 0x00483818, 0x00403018, 0x00483818, 0x00543c1c, 0x00483818, 0x00483818, 0x00545454, 0x00646464, 0x007c7c7c, 0x00484848, 0x005c4020, 0x005c4020, 0x00483818, 0x00483818, 0x00403019, 0x00483818, 0x00403018, 0x00493818, 0x00646464, 0x00646464, 0x00484849, 0x00484848, 0x00484848, 0x00646465, 0x00707070, 0x00545454, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x005c5c5c, 0x00545454, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004d4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c,
-		0x004c4c4c, 0x00545454, 0x00707071, 0x00707070, 0x007c7c7c, 0x00646464, 0x00483818, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00403018, 0x00483818, 0x00483818, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00484848, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00483818, 0x00403018, 0x00483818, 0x00484848, 0x007c7c7c, 0x00646464, 0x00656464, 0x00646464, 0x00707070, 0x00545454, 0x00646464, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x005c5c5d, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c,
-		0x004d4c4c, 0x004c4c4c, 0x00545454, 0x00707070, 0x00707070, 0x00707070, 0x00483918, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4120, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00403018, 0x00403018, 0x00483818, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x005c4020, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00483818, 0x00403018, 0x00403018, 0x00382c14, 0x00646464, 0x008c8c8c, 0x00a8a8a8, 0x00707070, 0x00555454, 0x00646464, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4d, 0x004d4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c,
-		0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00545454, 0x00707170, 0x007c7c7c, 0x00545454, 0x00483818, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00403018, 0x00403018, 0x00484848, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00484848, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483918, 0x00483818, 0x00483818, 0x00403018, 0x00403018, 0x00483818, 0x00392c14, 0x00382c14, 0x00646465, 0x00a8a8a8, 0x007c7c7c, 0x00545454, 0x00646464, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4d4c, 0x004c4c4c,
-		0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00545454, 0x00707070, 0x007c7c7c, 0x00545454, 0x00483818, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005d4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00403018, 0x00493818, 0x00545454, 0x00646464, 0x00646464, 0x007c7c7c, 0x00646464, 0x005c4020, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00403018, 0x00483818, 0x00382c14, 0x00382c14, 0x00646464, 0x00989898, 0x007c7c7c, 0x00646464, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4d, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c,
-		0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00545454, 0x007c7c7c, 0x00646464, 0x00545454, 0x00483818, 0x00543c1c, 0x005d4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00403018, 0x00403018, 0x00545454, 0x00646464, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00484848, 0x005c4020, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00483818, 0x00483818, 0x00403018, 0x00392c14, 0x00483818, 0x00382c14, 0x00392c14, 0x00646464, 0x00989898, 0x00646464, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4d, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c,
-		0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00484848, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00545454, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00403018, 0x00403018, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00656464, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00483818, 0x00483818, 0x00403018, 0x00382c14, 0x00403018, 0x00382c14, 0x00382c14, 0x00646464, 0x008c8c8c, 0x00646464, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c,
-		0x004d4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00484848, 0x007c7c7c, 0x00707070, 0x007c7c7c, 0x00646464, 0x00545454, 0x00403018, 0x00403118, 0x00403018, 0x00403018, 0x00484848, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00484848, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483918, 0x00483818, 0x00483818, 0x00382c14, 0x00403018, 0x00382c14, 0x00404040, 0x00646464, 0x008c8c8c, 0x00646464, 0x005c5c5c, 0x004c4c4c, 0x00484848, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4d4c, 0x004c4c4c,
-		0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00484848, 0x00707070, 0x00707070, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7d, 0x00646464, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00543c1d, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00382c14, 0x00493818, 0x00483818, 0x00483818, 0x00382c14, 0x00382d14, 0x00382c14, 0x004c4c4c, 0x00707070, 0x007c7c7c, 0x00646464, 0x005c5c5c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00484848, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004d4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848,
-		0x004d4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00383838, 0x00707070, 0x00717070, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x00646464, 0x00707070, 0x00989898, 0x00989898, 0x008c8c8c, 0x00707070, 0x00646464, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483918, 0x00483818, 0x00382c14, 0x00483818, 0x00483818, 0x00483818, 0x00382c14, 0x00382c14, 0x00382c14, 0x00545454, 0x00707070, 0x008c8c8c, 0x00646464, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4d4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00484848, 0x004c4c4c, 0x00484848, 0x00484848, 0x00484849, 0x00484848, 0x004c4c4c, 0x004c4c4c,
-		0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484849, 0x00393838, 0x00646464, 0x007c7c7c, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00646464, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x00646464, 0x005d4020, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483819, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00493818, 0x00382c14, 0x00483818, 0x00483818, 0x00483818, 0x00382c14, 0x00382c14, 0x00382c14, 0x00646464, 0x00707070, 0x007c7c7c, 0x00646464, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4d4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00484848, 0x00484848, 0x00484849, 0x004c4c4c, 0x004c4c4c,
-		0x004c4c4c, 0x004c4c4c, 0x00494848, 0x00383838, 0x00646464, 0x007c7c7c, 0x00707071, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00707070, 0x008c8c8c, 0x007c7c7c, 0x005c4020, 0x00543c1c, 0x00483918, 0x005c4020, 0x00483918, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00382c14, 0x00483818, 0x00483818, 0x00483818, 0x00382c14, 0x00382c14, 0x00404040, 0x00646464, 0x007c7d7c, 0x007c7c7c, 0x00646464, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004d4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x004c4c4c, 0x004c4c4c,
-		0x004c4c4d, 0x00484848, 0x00383838, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00646464, 0x00545454, 0x005c4020, 0x00483818, 0x005c4020, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00382c14, 0x00483818, 0x00483818, 0x00483818, 0x00382c14, 0x00382c14, 0x004c4c4c, 0x00707070, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x004c4c4c, 0x00484848,
-		0x00484848, 0x00383838, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545455, 0x00404040, 0x004c4c4c, 0x00545454, 0x00484848, 0x00646464, 0x005c4020, 0x00483818, 0x005c4020, 0x00483818, 0x00483818, 0x00553c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00382c14, 0x00483818, 0x00483818, 0x00403018, 0x00382c15, 0x00382c14, 0x00545454, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4d, 0x004c4c4d, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00383838,
-		0x00383938, 0x00646464, 0x00646464, 0x00484848, 0x00484848, 0x00646464, 0x00707070, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x004c4c4c, 0x00404040, 0x00545454, 0x00545454, 0x00646464, 0x00656464, 0x005c4020, 0x00483818, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00493818, 0x00382c14, 0x00382c14, 0x00483818, 0x00483818, 0x00403018, 0x00382c14, 0x00382c14, 0x00646464, 0x006c4824, 0x005c4020, 0x00646464, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4d, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00383838, 0x00404040,
-		0x00646464, 0x00646464, 0x00494848, 0x00543c1c, 0x00543c1c, 0x00484848, 0x00646465, 0x00656464, 0x00545454, 0x00545454, 0x00545455, 0x00404040, 0x00404040, 0x00545454, 0x00545454, 0x00545454, 0x00707070, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00382c14, 0x00403018, 0x00483818, 0x00403018, 0x00382c14, 0x00403018, 0x005c5c5c, 0x006c4824, 0x005c4020, 0x005c4020, 0x00545454, 0x00646464, 0x00404041, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4d4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00404040, 0x00383838, 0x00404040, 0x00404040,
-		0x00646464, 0x00484848, 0x00543c1c, 0x005c4020, 0x00483818, 0x00543c1c, 0x00484848, 0x007c7d7c, 0x00484848, 0x00545454, 0x00404040, 0x00404040, 0x00404040, 0x00545454, 0x00545454, 0x00545454, 0x00646464, 0x00646464, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00493818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00382c14, 0x00403018, 0x00382c14, 0x00382c14, 0x00403018, 0x00646464, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x00646464, 0x00646464, 0x00404040, 0x00484848, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00484848, 0x00404040, 0x00383838, 0x00343434, 0x00343434, 0x00383838, 0x00404040, 0x00646464,
-		0x00494848, 0x00543c1c, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00646464, 0x00707070, 0x00484848, 0x00404040, 0x00545454, 0x00404040, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x007c7c7c, 0x00484848, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00493818, 0x00483818, 0x00493818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00382c14, 0x00382c14, 0x00382c15, 0x00382c14, 0x004c4c4c, 0x00646464, 0x007c7c7c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00707071, 0x00707070, 0x00646464, 0x00404040, 0x00404040, 0x00404040, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00494848, 0x00404040, 0x00404040, 0x00383838, 0x00343434, 0x00383838, 0x00404040, 0x00383838, 0x00545454, 0x00646464, 0x00646464,
-		0x00543c1c, 0x005c4020, 0x00483818, 0x00483818, 0x00483918, 0x00483818, 0x00403018, 0x00484848, 0x007c7d7c, 0x00646464, 0x00484848, 0x00545454, 0x00404040, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00707070, 0x00646464, 0x00403018, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00382c14, 0x00382c14, 0x00382c14, 0x00382c14, 0x004c4c4c, 0x00646564, 0x007c7c7c, 0x007c7c7c, 0x007c7c7d, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x008c8c8c, 0x008c8c8c, 0x00646464, 0x00646464, 0x00404040, 0x00383838, 0x00343434, 0x00343434, 0x00343434, 0x00343434, 0x00343434, 0x00343434, 0x00343434, 0x00383838, 0x00404040, 0x00404040, 0x00383838, 0x00545454, 0x00646464, 0x007c7c7c, 0x00484848,
-		0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00403018, 0x00646464, 0x00707070, 0x00484848, 0x00545454, 0x00404040, 0x00545454, 0x00545454, 0x00545454, 0x00383838, 0x00646464, 0x007c7c7c, 0x00484848, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483819, 0x00483818, 0x00382c14, 0x00382c14, 0x00382c14, 0x00404040, 0x005c5c5c, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x007c7c7c, 0x008c8c8c, 0x00989898, 0x00989898, 0x00707070, 0x00646464, 0x00545454, 0x00383838, 0x00404040, 0x00404040, 0x00404040, 0x00404140, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00383838, 0x00545454, 0x00646464, 0x007c7c7c, 0x00484848, 0x00543c1c,
-		0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00483818, 0x00483818, 0x00403018, 0x00483818, 0x00646464, 0x007c7c7c, 0x00646464, 0x00484848, 0x00404040, 0x00545455, 0x00545454, 0x004c4c4c, 0x00383838, 0x00646464, 0x007c7c7c, 0x00646464, 0x00403018, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00382c14, 0x00382c14, 0x00404040, 0x00545454, 0x00646464, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00545454, 0x007c7c7c, 0x00989898, 0x00989898, 0x008d8c8c, 0x007c7c7c, 0x00646464, 0x00545454, 0x00383838, 0x00404041, 0x00404040, 0x00404040, 0x00404040, 0x00414040, 0x00383838, 0x00383938, 0x00545454, 0x00646464, 0x007c7c7c, 0x00484848, 0x00543c1c, 0x005c4020,
-		0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403118, 0x00483818, 0x00484848, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00404040, 0x00545454, 0x004d4c4c, 0x00484848, 0x00383838, 0x00646465, 0x007c7c7c, 0x007c7c7c, 0x00484848, 0x00382c14, 0x00403018, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00382c14, 0x00382c14, 0x00545554, 0x00646464, 0x007c7c7c, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00404040, 0x00383838, 0x00383838, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00545454, 0x007c7c7c, 0x008c8c8c, 0x008c8c8c, 0x00707070, 0x007c7c7c, 0x00646464, 0x00545454, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00545454, 0x00646464, 0x007c7c7c, 0x00656464, 0x00543c1c, 0x005c4020, 0x00493818,
-		0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403019, 0x00483818, 0x00403018, 0x00646464, 0x007c7c7c, 0x00707070, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00707070, 0x00707070, 0x007c7c7c, 0x00646464, 0x00382c14, 0x00382c14, 0x00382c14, 0x00382c14, 0x00382c14, 0x00382c14, 0x00382c14, 0x00404040, 0x00646464, 0x007c7c7c, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00404040, 0x00404140, 0x00383838, 0x00404041, 0x00383838, 0x00404040, 0x00404040, 0x00383838, 0x00404040, 0x00707070, 0x007c7c7c, 0x00707070, 0x00545454, 0x00545454, 0x007c7c7c, 0x00646464, 0x00545454, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00545554, 0x00646564, 0x007c7c7c, 0x00646464, 0x00484848, 0x005c4020, 0x00483818, 0x00483818,
-		0x00483818, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00382c14, 0x00483818, 0x00403018, 0x00545554, 0x00707070, 0x007c7c7c, 0x00646464, 0x00383838, 0x00383838, 0x00383838, 0x00707070, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00484848, 0x00382c14, 0x00382c15, 0x00382c14, 0x00382c14, 0x00404040, 0x004c4c4c, 0x005c5c5c, 0x007c7c7c, 0x00545454, 0x00545454, 0x00484848, 0x00404040, 0x00484948, 0x00484848, 0x00404040, 0x00393838, 0x00404040, 0x00383838, 0x00404040, 0x00404041, 0x00383838, 0x00484848, 0x00646464, 0x00707070, 0x00646464, 0x00484848, 0x00484848, 0x00545454, 0x007c7c7c, 0x00646464, 0x00555454, 0x00545454, 0x00545454, 0x00545454, 0x00646464, 0x007c7c7c, 0x00646464, 0x00484848, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818,
-		0x00483818, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00382c14, 0x00483818, 0x00403018, 0x00484848, 0x007c7c7c, 0x008c8c8c, 0x00707070, 0x00646464, 0x00646464, 0x00707070, 0x007c7c7c, 0x00545454, 0x006c4824, 0x006c4824, 0x00545454, 0x00646465, 0x00484848, 0x00484848, 0x004c4c4c, 0x005c5c5c, 0x005c5c5c, 0x007c7c7c, 0x007c7c7c, 0x00545454, 0x00545454, 0x00484848, 0x00404040, 0x00404040, 0x00484848, 0x00484848, 0x00404040, 0x00383838, 0x00404040, 0x00404040, 0x00383838, 0x00404040, 0x00343434, 0x00545454, 0x00646464, 0x00707070, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x007c7c7c, 0x007c7c7c, 0x007d7c7c, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00484848, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818,
-		0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00483818, 0x00493818, 0x00382c14, 0x00483818, 0x00403018, 0x00484948, 0x007c7c7c, 0x00707070, 0x008d8c8c, 0x00707070, 0x00707070, 0x00646464, 0x006c4824, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00646464, 0x00646564, 0x00646464, 0x00707070, 0x007c7c7c, 0x00707070, 0x00545454, 0x00545454, 0x00484848, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00343434, 0x00404040, 0x00414040, 0x00383838, 0x00383838, 0x00303030, 0x00545455, 0x00646464, 0x00646464, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00646464, 0x007c7c7c, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818,
-		0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00382c14, 0x00483818, 0x00403018, 0x00484848, 0x007c7c7c, 0x00707070, 0x00707070, 0x00707070, 0x00707070, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00707070, 0x00545454, 0x00545454, 0x00484848, 0x00404040, 0x00404040, 0x00404040, 0x00484848, 0x00404040, 0x00404040, 0x00404040, 0x00343434, 0x00404040, 0x00414040, 0x00383838, 0x00383838, 0x00484848, 0x00646464, 0x00707070, 0x00545454, 0x00545454, 0x00484948, 0x00484948, 0x00484848, 0x00484848, 0x00545454, 0x00646464, 0x00707070, 0x00707070, 0x00646465, 0x005c5c5c, 0x00545454, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00543c1c,
-		0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00403018, 0x00483818, 0x00403018, 0x00545454, 0x00707070, 0x008c8c8c, 0x00707070, 0x00707070, 0x00707070, 0x00646464, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x007c7c7c, 0x00707070, 0x007c7c7c, 0x00545454, 0x00545454, 0x00545454, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00343434, 0x00404040, 0x00404040, 0x00383838, 0x00343434, 0x00545454, 0x00707070, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x007c7c7c, 0x00707070, 0x005c5c5c, 0x00545554, 0x005c5c5c, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00543c1c,
-		0x00483818, 0x00483818, 0x00483818, 0x00483918, 0x00483818, 0x00382c14, 0x00403019, 0x00403018, 0x00403018, 0x00545454, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00483818, 0x007c7c7c, 0x007c7c7d, 0x00545454, 0x00545454, 0x00484848, 0x00545454, 0x00404040, 0x00404040, 0x00414040, 0x00404040, 0x00404040, 0x00404040, 0x00404041, 0x00404040, 0x00343434, 0x00404140, 0x00404040, 0x00383838, 0x00303030, 0x00646464, 0x00545454, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00483818, 0x005d4020, 0x00744c28, 0x005c5c5c, 0x00646464, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00543c1c,
-		0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00382c14, 0x00483818, 0x00403018, 0x00484848, 0x00646464, 0x007c7c7c, 0x00646464, 0x00545454, 0x005c5c5c, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00646464, 0x007c7c7d, 0x00545454, 0x00545454, 0x00494848, 0x00484848, 0x00545454, 0x00484848, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00303030, 0x00404040, 0x00404040, 0x00343434, 0x00545454, 0x00707070, 0x006c4824, 0x006c4824, 0x006c4824, 0x005d4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x005c4020, 0x005c4020, 0x005c4020, 0x007c7c7d, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818,
-		0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00392c14, 0x00403018, 0x00484848, 0x00646464, 0x00646464, 0x00646464, 0x00545454, 0x005c5c5c, 0x00545454, 0x00545454, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00545454, 0x00545454, 0x007c7c7c, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00484848, 0x00545454, 0x00484848, 0x00404040, 0x00404040, 0x00414040, 0x00404040, 0x00404040, 0x00404040, 0x00383838, 0x00303030, 0x00404040, 0x00383838, 0x00303130, 0x00545454, 0x00646464, 0x006c4824, 0x005c4020, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00646464, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x00483819, 0x00483818,
-		0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00382c14, 0x00403018, 0x00484848, 0x00646464, 0x00646464, 0x007c7c7c, 0x00545454, 0x005c5c5c, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00646464, 0x007c7c7c, 0x008c8c8c, 0x007c7c7c, 0x008c8c8c, 0x007c7c7c, 0x00545454, 0x00484848, 0x00404040, 0x00404040, 0x00484948, 0x00545454, 0x00484848, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404041, 0x00383838, 0x00303030, 0x00404040, 0x00383838, 0x00303030, 0x00646464, 0x00545454, 0x0080502c, 0x005c4020, 0x006c4824, 0x005c4020, 0x005c4020, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00646464, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483918, 0x00483918,
-		0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00382c14, 0x00484848, 0x00646464, 0x00646464, 0x00707070, 0x00646464, 0x00545454, 0x005c5c5c, 0x00545454, 0x00545454, 0x00545454, 0x00555454, 0x00545454, 0x00545454, 0x00646464, 0x007c7c7c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00545454, 0x00404040, 0x00404040, 0x00404040, 0x00484848, 0x00545454, 0x004c4c4c, 0x00404040, 0x00404041, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00343434, 0x00303030, 0x00404040, 0x00303030, 0x00646464, 0x00707070, 0x00484848, 0x0080502c, 0x005c4020, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00646464, 0x00403018, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818,
-		0x00483818, 0x00483818, 0x00483818, 0x00382c14, 0x00484848, 0x00656464, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00545454, 0x005c5c5c, 0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00545454, 0x00646464, 0x008c8c8c, 0x00989898, 0x00989898, 0x00545454, 0x00404040, 0x00404040, 0x00404040, 0x00484849, 0x00545454, 0x004c4c4c, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00343434, 0x00303030, 0x00383838, 0x00484848, 0x00707070, 0x00707070, 0x006c4824, 0x0080502c, 0x005c4020, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00646465, 0x00484848, 0x00403018, 0x00483818, 0x00483818, 0x00483818, 0x00483818,
-		0x00483818, 0x00483818, 0x00403018, 0x00484848, 0x00646464, 0x00646464, 0x00707070, 0x007c7c7c, 0x00646464, 0x00545454, 0x005c5c5c, 0x00545454, 0x00545454, 0x00545455, 0x00545454, 0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00646464, 0x00989898, 0x00989898, 0x00646464, 0x00404040, 0x00404040, 0x00404040, 0x00484848, 0x00545454, 0x004c4c4c, 0x00484848, 0x00404041, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00303030, 0x00303030, 0x00343434, 0x00545454, 0x007c7c7c, 0x00646464, 0x006c4824, 0x0080502c, 0x005c4020, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00646464, 0x00646464, 0x00484848, 0x00403118, 0x00483818, 0x00483818, 0x00483818,
-		0x00483818, 0x00403018, 0x00484848, 0x00646564, 0x00646464, 0x00707070, 0x007c7c7c, 0x00646464, 0x00545454, 0x005c5c5c, 0x00545454, 0x00545454, 0x005c5c5c, 0x00545454, 0x00545454, 0x00555454, 0x00545454, 0x00545455, 0x00484848, 0x00545454, 0x00545454, 0x00646464, 0x008c8c8c, 0x00707070, 0x00383838, 0x00404140, 0x00404040, 0x00484848, 0x00545454, 0x004c4c4c, 0x00484848, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00303030, 0x00303030, 0x00303030, 0x00646464, 0x007d7c7c, 0x00545454, 0x006c4824, 0x0080502c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005d4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00646464, 0x007c7c7c, 0x00646464, 0x00484848, 0x00403018, 0x00483818, 0x00483818,
-		0x00403018, 0x00484849, 0x00646464, 0x00646564, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00545454, 0x00545454, 0x008c8c8c, 0x008c8c8c, 0x00545454, 0x00383839, 0x00383838, 0x00484848, 0x00545454, 0x00484848, 0x004c4c4c, 0x00404040, 0x00404140, 0x00404040, 0x00404040, 0x00404040, 0x00303030, 0x00303031, 0x00484848, 0x00707070, 0x00707070, 0x006c4824, 0x005c4020, 0x0080502c, 0x005c4020, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00484848, 0x00403018, 0x00403018,
-		0x00484848, 0x00646564, 0x00646464, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545554, 0x005c5c5c, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545554, 0x00404040, 0x00545454, 0x00545454, 0x00646464, 0x00707070, 0x00707070, 0x00303030, 0x00383838, 0x00383838, 0x00545454, 0x00404040, 0x004c4c4c, 0x00404040, 0x00404041, 0x00404040, 0x00404040, 0x00404040, 0x00303030, 0x00303030, 0x00545454, 0x007c7c7c, 0x00646464, 0x006c4824, 0x005c4020, 0x0080502c, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4120, 0x005c4020, 0x005c4020, 0x005c4020, 0x005d4020, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00484848, 0x00484848,
-		0x00646464, 0x00646465, 0x00989898, 0x00989898, 0x008c8c8c, 0x00656464, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x005c5c5c, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00404040, 0x00484848, 0x00545454, 0x00545454, 0x00646464, 0x00646464, 0x00484848, 0x00303030, 0x00343434, 0x00303030, 0x00404040, 0x004c4c4c, 0x00404041, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00303030, 0x00303030, 0x00545454, 0x007c7c7c, 0x00545454, 0x006c4824, 0x005c4020, 0x0080502c, 0x00744c28, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4021, 0x005c4020, 0x005c4020, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x00646464, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00545454, 0x00646464, 0x00646464,
-		0x00646464, 0x007c7c7c, 0x00989898, 0x00989898, 0x00717070, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x005c5c5c, 0x005c5c5c, 0x00545554, 0x00545454, 0x00545454, 0x00545454, 0x005c5c5c, 0x00545555, 0x00545454, 0x00545454, 0x00484848, 0x00404040, 0x00545454, 0x00545454, 0x00545454, 0x00646464, 0x00545454, 0x00484848, 0x00303030, 0x00303030, 0x00383838, 0x00484848, 0x00484848, 0x00404040, 0x00404040, 0x00404040, 0x00383838, 0x00303031, 0x00484848, 0x00646464, 0x00707070, 0x006c4824, 0x005c4020, 0x005c4020, 0x00744c28, 0x0080502c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x00646464, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00545454,
-		0x002c2c2c, 0x00484848, 0x008c8c8c, 0x008c8c8c, 0x00646464, 0x00545454, 0x00545454, 0x00555454, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00404040, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00545454, 0x00646464, 0x00545454, 0x00343434, 0x00343434, 0x00484848, 0x00404040, 0x00404040, 0x00404040, 0x00383838, 0x00303030, 0x00545454, 0x00707070, 0x007c7c7c, 0x006c4824, 0x005c4020, 0x005c4020, 0x006c4824, 0x0080502c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x00646564, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x002c2c2c,
-		0x002c2c2c, 0x00202020, 0x00484848, 0x007c7c7d, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00545454, 0x00484848, 0x00404040, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00646464, 0x00646464, 0x00545454, 0x00303030, 0x00343434, 0x00343434, 0x00383838, 0x00404040, 0x00404040, 0x00383838, 0x00303030, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x00744c28, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x005c4020, 0x005c4020, 0x00483818, 0x00646464, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x002c2c2c,
-		0x002c2c2c, 0x00202020, 0x00484848, 0x00707070, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x005c5c5c, 0x005c5c5c, 0x00545454, 0x00545455, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00404041, 0x00484848, 0x00545454, 0x00545454, 0x00484848, 0x00383838, 0x00646464, 0x008c8c8c, 0x008c8c8c, 0x00545454, 0x00303030, 0x00343434, 0x00343434, 0x00404040, 0x00404040, 0x00343434, 0x00484848, 0x00707070, 0x00707070, 0x00707070, 0x00646464, 0x00543c1c, 0x005c4120, 0x005c4020, 0x006c4824, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x00646464, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x002d2c2c,
-		0x00202020, 0x00484848, 0x00646464, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x005d5c5c, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00545454, 0x00484848, 0x00404040, 0x00484848, 0x00545454, 0x00484848, 0x00383838, 0x00484848, 0x007c7c7c, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x00545454, 0x00303030, 0x00343434, 0x00383838, 0x00383838, 0x00303030, 0x00545554, 0x007c7c7c, 0x00707070, 0x00707070, 0x007c7c7c, 0x00646464, 0x00543c1c, 0x005c4020, 0x005c4020, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00646464, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x002c2c2c, 0x002c2c2c,
-		0x00484848, 0x00646464, 0x00646464, 0x00646464, 0x00484848, 0x00545454, 0x00545454, 0x005c5c5c, 0x005c5c5c, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00545454, 0x00484848, 0x00343434, 0x00484848, 0x00484848, 0x00383938, 0x00484848, 0x00545454, 0x007c7c7c, 0x00484848, 0x00483819, 0x00484848, 0x007c7c7c, 0x00545454, 0x00303030, 0x00303030, 0x00303030, 0x00303130, 0x00707070, 0x007c7c7c, 0x00646464, 0x00383839, 0x00383838, 0x00646464, 0x00646465, 0x00543c1c, 0x00543c1c, 0x005c4020, 0x006c4824, 0x005c4120, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1d, 0x00543c1c, 0x005c4020, 0x00543c1c, 0x00483818, 0x00484848, 0x00646464, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x002c2c2c, 0x002c2c2c,
-		0x00646464, 0x00707170, 0x00707070, 0x00707070, 0x00646464, 0x00484848, 0x00545454, 0x005c5c5c, 0x005c5c5c, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545455, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00545454, 0x00484848, 0x00343434, 0x00404040, 0x00383838, 0x00484848, 0x00545454, 0x00646464, 0x00484848, 0x00543c1c, 0x00483819, 0x00403018, 0x00484848, 0x007c7c7c, 0x00646464, 0x00545454, 0x00555454, 0x00646464, 0x007c7c7c, 0x00646465, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x00383839, 0x00646464, 0x00707070, 0x00646464, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00484848, 0x00646464, 0x00646465, 0x00202020, 0x00202021, 0x00202020, 0x00202020, 0x00202020, 0x00202020,
-		0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00707070, 0x007c7c7c, 0x00646464, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00545454, 0x00404040, 0x00343434, 0x00383838, 0x00484848, 0x00545454, 0x00646464, 0x00484848, 0x00543c1c, 0x00483818, 0x00483818, 0x00403018, 0x00483818, 0x00403018, 0x00484848, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00646564, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00646464, 0x00707070, 0x00646464, 0x00553c1c, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00484848, 0x00646464, 0x00707070, 0x007c7c7c, 0x007c7c7c, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848,
-		0x007c7c7c, 0x00707070, 0x007c7c7c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00646464, 0x00484848, 0x00484848, 0x00545455, 0x00545454, 0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00545454, 0x00404040, 0x00343434, 0x00484848, 0x00545454, 0x00646464, 0x00484848, 0x00543c1c, 0x00483818, 0x00483818, 0x00483819, 0x00403018, 0x00483818, 0x00403018, 0x00483818, 0x00484848, 0x007c7c7c, 0x007c7c7c, 0x00484848, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00646464, 0x00707070, 0x00707070, 0x00545455, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00484848, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7c,
-		0x007c7c7c, 0x00545454, 0x006c4824, 0x006c4824, 0x00545454, 0x008c8c8c, 0x008c8c8c, 0x00646464, 0x00484849, 0x00383838, 0x00545454, 0x00545454, 0x00555454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00343434, 0x00484848, 0x00545454, 0x00646464, 0x00484848, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00483918, 0x00403018, 0x00483818, 0x00403018, 0x007c7c7c, 0x00646464, 0x00383838, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x00282828, 0x002c2c2c, 0x00383838, 0x00646464, 0x007c7c7c, 0x00707070, 0x00545455, 0x00543c1c, 0x00483918, 0x00484848, 0x00484848, 0x00646464, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00646464, 0x007c7c7c,
-		0x006c4824, 0x006c4824, 0x005c4020, 0x005c4020, 0x006c4824, 0x006c4824, 0x00545454, 0x007c7c7c, 0x00646464, 0x00484848, 0x00383838, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00484849, 0x00545454, 0x00646464, 0x00484848, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00483818, 0x00403018, 0x00483818, 0x00403018, 0x007c7c7c, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00646464, 0x007c7c7c, 0x00707070, 0x00555454, 0x00484848, 0x00484848, 0x00646464, 0x007c7c7c, 0x00545454, 0x00545454, 0x00545554, 0x004c4c4c, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00646464, 0x007c7c7c,
-		0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4021, 0x006c4824, 0x006c4824, 0x00545454, 0x00646464, 0x00484849, 0x00383838, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00494848, 0x00646464, 0x00484848, 0x00484848, 0x00543c1c, 0x00483818, 0x00483819, 0x00483818, 0x00483818, 0x00403018, 0x00483818, 0x00403018, 0x00483818, 0x00403018, 0x00403018, 0x00484848, 0x00646464, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00292828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00646464, 0x007c7c7c, 0x00707070, 0x00646464, 0x00646464, 0x008c8c8c, 0x00646464, 0x004c4c4c, 0x004c4c4c, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x004c4c4c, 0x00484848, 0x00646464, 0x007c7c7c,
-		0x005c4020, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4120, 0x006c4824, 0x00483818, 0x00646464, 0x00484848, 0x00383838, 0x00484848, 0x00484848, 0x00383838, 0x00484848, 0x00545454, 0x00646464, 0x00484848, 0x00543c1c, 0x005c4020, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00403018, 0x00403018, 0x00484848, 0x00646464, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00646464, 0x007c7c7c, 0x00707070, 0x008c8c8c, 0x008c8c8c, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x004c4c4c, 0x00484848, 0x00646464, 0x006c4924,
-		0x005c4020, 0x005c4020, 0x005c4021, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x005c4020, 0x00483818, 0x005c4020, 0x005c4020, 0x00484848, 0x00383838, 0x00383838, 0x00484848, 0x00545454, 0x00646464, 0x00484848, 0x00543c1c, 0x005c4020, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00483918, 0x00403118, 0x00403018, 0x00403018, 0x00545454, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x00202020, 0x00202020, 0x00292828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383839, 0x00646464, 0x007c7c7c, 0x008c8c8c, 0x00646464, 0x00555454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x004c4c4c, 0x00484848, 0x00494848, 0x00646464, 0x006c4824,
-		0x005c4020, 0x005c4020, 0x00543c1c, 0x00553c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x005c4020, 0x00483818, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00484848, 0x00484848, 0x00545454, 0x00646464, 0x00484848, 0x00543c1c, 0x00543c1c, 0x005c4021, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00483818, 0x00403018, 0x00403018, 0x00484848, 0x00646464, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x00202020, 0x00202020, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00646464, 0x007c7c7c, 0x00545454, 0x00545454, 0x00545454, 0x00555454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00545454, 0x006c4824, 0x005c4020,
-		0x005c4020, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x005c4020, 0x00483818, 0x00543c1c, 0x00483818, 0x00483818, 0x00545454, 0x00555454, 0x00646464, 0x00484848, 0x00543c1c, 0x00483818, 0x00543c1c, 0x005c4020, 0x00483818, 0x00483818, 0x00483819, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00483818, 0x00403018, 0x00484848, 0x00646464, 0x00484849, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x00282828, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x00202020, 0x00202020, 0x00202020, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x002c2d2c, 0x002c2c2c, 0x00383838, 0x00646464, 0x007c7c7c, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x004c4c4c, 0x00484848, 0x00646464, 0x006c4824, 0x005c4020,
-		0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00403018, 0x00483818, 0x00483818, 0x00545454, 0x00646464, 0x00646464, 0x00484848, 0x00543c1c, 0x00483819, 0x00483818, 0x00543c1c, 0x005c4020, 0x00483818, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00403018, 0x00403018, 0x00545454, 0x00646464, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x00282928, 0x00282828, 0x002c2c2c, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00646464, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x004c4c4c, 0x00484848, 0x00484848, 0x00545454, 0x006c4824, 0x005c4021, 0x005c4020,
-		0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4120, 0x00543c1c, 0x00483818, 0x00483818, 0x00403018, 0x00483818, 0x00545454, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00484948, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00403018, 0x00484848, 0x00646464, 0x00383838, 0x002c2c2c, 0x00393838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x00202020, 0x00202020, 0x00282828, 0x00202020, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00646464, 0x004c4c4c, 0x004c4c4c, 0x004c4d4c, 0x00484848, 0x004c4c4c, 0x00484848, 0x00545454, 0x006c4824, 0x005c4020, 0x005c4120,
-		0x005c4020, 0x005d4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00403018, 0x00403018, 0x00555454, 0x007c7c7c, 0x007d7c7c, 0x007c7c7c, 0x007c7c7c, 0x00545454, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483918, 0x00483818, 0x00403018, 0x00484848, 0x00646464, 0x00484848, 0x00383838, 0x002c2c2c, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00282829, 0x00202020, 0x00202020, 0x00202020, 0x00282828, 0x00202020, 0x00282928, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00646464, 0x004c4c4c, 0x00484848, 0x00545454, 0x00545454, 0x00484848, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020,
-		0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x00403018, 0x00403018, 0x00545454, 0x007c7c7c, 0x00545454, 0x00404040, 0x00545454, 0x007c7c7c, 0x00646464, 0x00484848, 0x00483818, 0x00483818, 0x00543c1c, 0x005c4020, 0x00483818, 0x00483918, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00545454, 0x00646464, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x00202020, 0x001c1c1c, 0x00282828, 0x00282828, 0x00202021, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00545454, 0x00646464, 0x00545454, 0x00545454, 0x004c4c4c, 0x00646464, 0x006c4824, 0x005c4020, 0x005c4020, 0x005d4020,
-		0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00403018, 0x00545454, 0x007c7c7c, 0x00545454, 0x00404040, 0x00404040, 0x00404041, 0x00545454, 0x007c7c7c, 0x00545454, 0x00483818, 0x00483818, 0x00543c1c, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483819, 0x00483818, 0x00403018, 0x00484848, 0x00646464, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00292828, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x00202020, 0x001c1c1c, 0x00202020, 0x002c2c2c, 0x00202020, 0x00202020, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00545454, 0x007c7c7c, 0x004c4c4c, 0x004c4c4c, 0x00646464, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020,
-		0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00403018, 0x00403018, 0x00545454, 0x007c7c7c, 0x007c7c7c, 0x00404040, 0x00404040, 0x00404140, 0x00404040, 0x00404040, 0x00545454, 0x00646464, 0x00483818, 0x00483818, 0x00553c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483918, 0x00403018, 0x00484848, 0x00545454, 0x00646464, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002d2c2c, 0x002c2c2c, 0x00282828, 0x00202020, 0x001c1c1c, 0x00202020, 0x002c2c2c, 0x00282828, 0x00202020, 0x00202020, 0x00282828, 0x002c2d2c, 0x00202020, 0x00545454, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00646564, 0x006c4824, 0x005c4020, 0x005c4120, 0x005c4020, 0x005c4020};
-	// 'eagle', 64x64px
-	const unsigned int eagle[] = {
-		0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383839, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383839, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383839, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838,
-		0x00545454, 0x00383938, 0x00545454, 0x00484849, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00555454, 0x00484848, 0x00484848, 0x00484849, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545455, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484948, 0x00383838,
-		0x00383838, 0x00ec0000, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40001, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00a40000, 0x00484848, 0x00484848, 0x00555454, 0x00ec0000, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d50000, 0x00a40000, 0x00484848, 0x00383838, 0x00545454, 0x00ec0000, 0x00ec0000, 0x00ec0000, 0x00ec0000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00c80000, 0x00c80000, 0x00c80001, 0x00c80000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00a40000, 0x00484848,
-		0x00484848, 0x00fcf400, 0x00c80000, 0x00b00000, 0x00b00001, 0x00d40000, 0x00880000, 0x00a40000, 0x00d40000, 0x00880000, 0x00c80000, 0x00a40000, 0x00640000, 0x002c2c2c, 0x00484848, 0x00545454, 0x00ec0000, 0x00bc0000, 0x00880000, 0x00bc0000, 0x00880000, 0x00bc0000, 0x00880000, 0x00bc0000, 0x007c0000, 0x00bc0000, 0x00980000, 0x00bc0000, 0x00990000, 0x00bc0000, 0x007c0000, 0x00bc0000, 0x007c0000, 0x00bc0000, 0x00c80000, 0x00a40000, 0x00700000, 0x002c2c2c, 0x00484848, 0x00383838, 0x00d40000, 0x00a40000, 0x00c80000, 0x00b10000, 0x00c80000, 0x00b00000, 0x00b00000, 0x00c80000, 0x00700000, 0x00c80000, 0x007c0001, 0x00c80000, 0x00b00000, 0x00c80000, 0x00880000, 0x00b00000, 0x00a40000, 0x007c0000, 0x00c80000, 0x00980000, 0x00c80000, 0x00a40000, 0x00fcf400, 0x002c2c2c,
-		0x00e5d800, 0x00ccc400, 0x00848400, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b5b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b5b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b5, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00cdc401, 0x00ccc400, 0x00706c00,
-		0x00a86840, 0x009c9c00, 0x00585400, 0x00707070, 0x00707070, 0x007c7c7c, 0x007d7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7d7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7d7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00707070, 0x00707070, 0x00706c01, 0x00e88c58, 0x00585400,
-		0x00484848, 0x00543c1c, 0x00a40001, 0x007c7c7c, 0x007c7c7d, 0x007c7c7c, 0x007c7c7c, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989899, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989899, 0x00999898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x007c7d7c, 0x00707070, 0x007c7c7c, 0x007c7d7c, 0x00580000, 0x00a86840, 0x002c2c2c,
-		0x00484848, 0x00bc0000, 0x007c0000, 0x00989898, 0x007c7c7c, 0x00fc2020, 0x00a40000, 0x00400000, 0x00400000, 0x00545454, 0x00700001, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700100, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700001, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00a40000, 0x00b00000, 0x00fc0000, 0x00e00000, 0x007c7c7c, 0x00400000, 0x00400000, 0x00400000, 0x007c7c7c, 0x00c0c0c0, 0x00707070, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00bc0000, 0x00a40000, 0x00a8a8a8, 0x007c7c7c, 0x00a40000, 0x00c0c0c0, 0x00989898, 0x00707070, 0x00400000, 0x007c7c7c, 0x00a9a8a8, 0x00c0c0c0, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b5b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b5, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b5, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x007c7c7c, 0x00400000, 0x007c7c7c, 0x00707070, 0x00989898, 0x00fc2020, 0x007c7c7c, 0x00707070, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x007c0000, 0x00640000, 0x00b4b4b4, 0x00989898, 0x00400000, 0x00989898, 0x00c0c0c0, 0x00989898, 0x007c7c7c, 0x008c8c8c, 0x00989898, 0x00a8a8a8, 0x00a8a8a8, 0x008c8c8c, 0x007c7c7c, 0x00a9a8a8, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b5, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x008c8c8c, 0x006c0070, 0x00646464, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00707070, 0x00a8a8a8, 0x00d0d0d0, 0x00a40000, 0x00707070, 0x007c7c7c, 0x00400000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00484848, 0x002c2c2c, 0x00d0d0d0, 0x00a8a8a8, 0x00400000, 0x00989898, 0x00a8a8a8, 0x00c0c0c0, 0x00989898, 0x007c7c7c, 0x007c7c7c, 0x00989898, 0x00989898, 0x00545454, 0x00580058, 0x00707070, 0x00a8a8a8, 0x00d0d0d1, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c1c0, 0x00b4b4b4, 0x00b4b4b5, 0x00b4b4b4, 0x00b5b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b5, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b5b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00c0c0c0, 0x00c0c0c0, 0x008c8c8c, 0x00646464, 0x00600064, 0x00500150, 0x00989898, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x00999898, 0x00a8a8a8, 0x00d0d0d0, 0x007c7c7c, 0x00400000, 0x007c7c7c, 0x00989898, 0x00202020, 0x00202020, 0x002c2c2d,
-		0x00545454, 0x00383838, 0x00383838, 0x00d0d0d0, 0x00b4b4b4, 0x00545454, 0x00707070, 0x00989898, 0x00b4b4b4, 0x00c0c0c0, 0x00989898, 0x007c7c7c, 0x007c7c7c, 0x008c8c8c, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x007c7c7c, 0x00a8a8a8, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00500050, 0x00707070, 0x00545454, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00b45400, 0x00cc6000, 0x00fc7800, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b5b4, 0x00b4b4b4, 0x00c0c0c0, 0x00c0c0c0, 0x008c8c8c, 0x00646464, 0x00600064, 0x00580058, 0x00500050, 0x00500050, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00a8a8a8, 0x00d0d1d0, 0x00c0c0c0, 0x00646464, 0x00545454, 0x008c8d8c, 0x00a8a8a8, 0x00202020, 0x002c2c2c, 0x002c2c2c,
-		0x00ec0000, 0x00d50000, 0x00d40000, 0x00b4b4b4, 0x00d1d0d0, 0x00400000, 0x007c7c7c, 0x00989898, 0x00a8a9a8, 0x00b4b4b4, 0x00c0c0c0, 0x00989898, 0x00707070, 0x00646464, 0x00484848, 0x00480048, 0x00500050, 0x00510050, 0x00580058, 0x00580058, 0x007c7c7c, 0x00a8a8a8, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00500050, 0x00500050, 0x00500050, 0x00500051, 0x00500050, 0x007c7c7d, 0x00500050, 0x00b45400, 0x00b45400, 0x00cc6000, 0x00fc8820, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b5, 0x008c8c8d, 0x00646464, 0x00600064, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00484848, 0x00989898, 0x00989898, 0x00989898, 0x00a8a8a8, 0x00c0c0c0, 0x00c0c0c0, 0x00a9a8a8, 0x007c7c7c, 0x00400000, 0x00989898, 0x00a8a8a8, 0x00580000, 0x00580000, 0x00d40000,
-		0x00b00000, 0x00880000, 0x00880000, 0x00b4b4b4, 0x00d0d0d1, 0x00700000, 0x00989898, 0x008c8c8c, 0x00989898, 0x00a8a8a8, 0x00b4b4b4, 0x00646464, 0x00580058, 0x00707070, 0x00646464, 0x00484848, 0x00480048, 0x00480048, 0x00500050, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x007c7c7c, 0x008c8c8c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00b45400, 0x008c8c8c, 0x00b4b4b4, 0x00b4b4b4, 0x008c8c8c, 0x00646464, 0x00600064, 0x00600064, 0x00580058, 0x00580058, 0x00500050, 0x00500050, 0x00500150, 0x00484948, 0x00707070, 0x00707070, 0x00500050, 0x00646464, 0x00a8a8a8, 0x00c0c0c0, 0x00a8a8a8, 0x008c8c8d, 0x007c7c7c, 0x00400000, 0x00a8a8a8, 0x00b4b4b4, 0x00580000, 0x00580000, 0x00b00000,
-		0x00880000, 0x00a40000, 0x00880000, 0x00b4b4b4, 0x00d0d0d0, 0x00b00000, 0x00a8a8a8, 0x00989899, 0x008c8c8c, 0x00989898, 0x00646464, 0x006c0070, 0x00610064, 0x00484848, 0x00707070, 0x00646464, 0x00484848, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00850184, 0x00580058, 0x00580058, 0x00580058, 0x00707070, 0x008c8c8c, 0x00b4b4b4, 0x00b4b4b4, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x008c8c8c, 0x00b4b4b4, 0x008c8c8c, 0x00646464, 0x00600064, 0x00600064, 0x00580058, 0x00840084, 0x00500050, 0x00500051, 0x00500050, 0x00480048, 0x00484848, 0x00707070, 0x00545454, 0x006c0070, 0x00600064, 0x00600064, 0x00646464, 0x00a8a8a8, 0x00989898, 0x007c7c7c, 0x008c8c8c, 0x00700000, 0x00a8a8a8, 0x00b4b4b4, 0x00580000, 0x00580000, 0x00980000,
-		0x00700000, 0x00a40000, 0x00a40000, 0x00b4b4b4, 0x00b4b4b4, 0x00980000, 0x00b4b4b4, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x00480148, 0x00600064, 0x006c0070, 0x00600064, 0x00580058, 0x00484848, 0x00646464, 0x00484848, 0x00383838, 0x00480048, 0x00480048, 0x006c0071, 0x00490048, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00b4b4b4, 0x00b4b4b5, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00b4b4b4, 0x00b4b4b4, 0x00580058, 0x00600064, 0x00600064, 0x00580059, 0x00500050, 0x006c0070, 0x00480048, 0x00480048, 0x00383838, 0x00484848, 0x00646464, 0x00484848, 0x00500050, 0x00600065, 0x00600064, 0x006c0070, 0x006c0070, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x008c8c8c, 0x00700000, 0x00a8a8a8, 0x00b4b4b4, 0x00580000, 0x00580000, 0x007c0000,
-		0x00a40000, 0x00880000, 0x00880000, 0x00b4b4b5, 0x00b4b4b4, 0x00880000, 0x00c0c0c0, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x00480048, 0x00480048, 0x00600065, 0x006c0070, 0x00600064, 0x00600064, 0x00580058, 0x00484848, 0x00545454, 0x00383838, 0x00400040, 0x00400040, 0x00480048, 0x00480048, 0x00480048, 0x00580058, 0x00545454, 0x00b4b4b4, 0x00b4b4b4, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00b4b4b4, 0x00b4b4b4, 0x00545454, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00383838, 0x00484848, 0x00484848, 0x00480048, 0x00500050, 0x00580058, 0x00600064, 0x006c0070, 0x006c0070, 0x006c0070, 0x008c8c8c, 0x007c7c7c, 0x008c8c8c, 0x008c8c8c, 0x00700000, 0x00a8a8a8, 0x00b4b4b4, 0x00580000, 0x00580000, 0x007c0000,
-		0x00700000, 0x00a40000, 0x00640000, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00d0d0d0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x00484848, 0x00480048, 0x00480048, 0x00600064, 0x006c0070, 0x006c0071, 0x00600064, 0x00580058, 0x00480048, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00480048, 0x00480048, 0x008c8c8c, 0x00b4b4b4, 0x00b4b4b4, 0x00707070, 0x00500050, 0x00500050, 0x00500051, 0x00500050, 0x00500050, 0x00500050, 0x00717070, 0x00b4b4b4, 0x00b4b4b5, 0x008c8c8c, 0x00480048, 0x00480048, 0x00480048, 0x00400040, 0x00400040, 0x00400040, 0x00480048, 0x00480048, 0x00500050, 0x00580058, 0x00600064, 0x006c0070, 0x006c0070, 0x006c0070, 0x00545454, 0x008c8c8c, 0x007c7c7c, 0x008c8c8c, 0x00989898, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00580100, 0x00580000, 0x00880000,
-		0x00700000, 0x00b00000, 0x00650000, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00989998, 0x00646464, 0x00484848, 0x00480048, 0x00580058, 0x00600064, 0x00600064, 0x006c0070, 0x00600064, 0x00580058, 0x006c0070, 0x00400040, 0x00400140, 0x00400040, 0x00480049, 0x008c8c8c, 0x00500050, 0x00707070, 0x00b4b4b4, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00b4b4b4, 0x00707070, 0x00480048, 0x008c8c8c, 0x00480049, 0x00400040, 0x00400040, 0x00480048, 0x00580058, 0x00480048, 0x00480048, 0x00580058, 0x00600064, 0x006c0070, 0x006c0070, 0x006c0070, 0x00545454, 0x007c7c7c, 0x007c7c7c, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00580000, 0x00580000, 0x00700000,
-		0x00400000, 0x004c0000, 0x004c0000, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00d0d0d0, 0x00d0d0d0, 0x00646464, 0x00500050, 0x00707070, 0x00545454, 0x00545454, 0x00484848, 0x00580058, 0x00600064, 0x00600064, 0x006c0070, 0x00580058, 0x00840084, 0x00500050, 0x00400040, 0x00400040, 0x00480048, 0x00500050, 0x00480048, 0x00500050, 0x00b4b4b4, 0x00b4b5b4, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00b4b4b4, 0x00b4b4b4, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00580058, 0x006c0070, 0x00500050, 0x00580058, 0x00600064, 0x00600064, 0x006c0070, 0x00545454, 0x007c7c7c, 0x00646464, 0x00484848, 0x00484848, 0x00656464, 0x00989898, 0x00a8a8a8, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00400000, 0x00580000, 0x00400000,
-		0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00b5b4b4, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00d0d0d0, 0x00580058, 0x00500050, 0x00480048, 0x00484848, 0x00545554, 0x00545454, 0x00545454, 0x00484848, 0x00600064, 0x00600064, 0x006c0070, 0x00580058, 0x00840084, 0x00500050, 0x00500050, 0x00500050, 0x00480048, 0x00500051, 0x00480048, 0x007c7c7c, 0x00646464, 0x00500050, 0x00500050, 0x00500050, 0x00500051, 0x00500050, 0x00500051, 0x00646464, 0x007c7c7c, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x006c0070, 0x00580058, 0x00580058, 0x00600164, 0x00600064, 0x00545454, 0x008c8c8c, 0x007c7c7c, 0x00656464, 0x00484848, 0x00400040, 0x00400040, 0x00480048, 0x00989898, 0x00a8a8a8, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00202020, 0x00202020, 0x002c2c2c,
-		0x00545554, 0x00545454, 0x00484848, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00d0d0d0, 0x00600065, 0x00580058, 0x00500050, 0x00480048, 0x00480048, 0x00400040, 0x00383838, 0x00484848, 0x00484848, 0x00545454, 0x00646464, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00480048, 0x00480048, 0x00480048, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500150, 0x00500050, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00500050, 0x00500050, 0x00580059, 0x00545454, 0x00646464, 0x008c8c8c, 0x007c7c7c, 0x00545454, 0x00500050, 0x00480048, 0x00400040, 0x00400040, 0x00400040, 0x00480048, 0x00a8a8a8, 0x00a8a8a8, 0x00700000, 0x00b4b5b4, 0x00b4b4b4, 0x00202020, 0x002c2c2c, 0x002c2c2c,
-		0x00545454, 0x00ec0000, 0x00ec0000, 0x00c0c0c0, 0x00c0c0c0, 0x007c0000, 0x00c0c0c0, 0x00b4b4b4, 0x00600064, 0x00610064, 0x00500050, 0x00500050, 0x00480048, 0x00400040, 0x00400040, 0x00400040, 0x00480048, 0x00480048, 0x00580058, 0x009c009c, 0x00580058, 0x00580058, 0x00580058, 0x00480048, 0x00480048, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500051, 0x00500050, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00500050, 0x00580058, 0x00580058, 0x009c009c, 0x00580058, 0x00580058, 0x00580058, 0x00500051, 0x00500050, 0x00480048, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00580058, 0x00a8a8a8, 0x00a8a8a8, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00580000, 0x00580000, 0x002c2c2c,
-		0x00545454, 0x00ec0000, 0x00880000, 0x00d0d0d0, 0x00d0d0d0, 0x00980000, 0x00d0d0d0, 0x00c0c0c0, 0x00580058, 0x00600064, 0x00580058, 0x00500050, 0x00480048, 0x00480148, 0x00400040, 0x00400040, 0x00400040, 0x00490048, 0x00480048, 0x00840084, 0x00580058, 0x00580058, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00480048, 0x00480048, 0x00500050, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x009c009c, 0x00580158, 0x00580058, 0x00580158, 0x00500150, 0x00480048, 0x00480048, 0x00400040, 0x00400041, 0x00400040, 0x00480048, 0x00580058, 0x00989898, 0x00a8a8a8, 0x007c0000, 0x00b4b5b4, 0x00b4b4b4, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00383838, 0x00ec0000, 0x00b00000, 0x00c0c0c0, 0x00c0c0c0, 0x00880000, 0x00c0c0c0, 0x00989898, 0x00717070, 0x00580058, 0x00600064, 0x00500050, 0x00500050, 0x00480048, 0x00400040, 0x00400040, 0x00480048, 0x00400040, 0x00480048, 0x006c0070, 0x00580058, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00545554, 0x00545454, 0x00646464, 0x00707070, 0x00707070, 0x00646464, 0x00545454, 0x00545454, 0x00500050, 0x00500150, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00840084, 0x00580058, 0x00580058, 0x00500050, 0x00480048, 0x00480048, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00480048, 0x00707070, 0x00989898, 0x00a8a8a8, 0x007c0000, 0x00b4b4b4, 0x00b4b4b4, 0x00580000, 0x00400000, 0x002c2c2d,
-		0x00484848, 0x00bc0000, 0x00640000, 0x00b4b5b4, 0x00b4b4b4, 0x007c0000, 0x00b4b4b4, 0x00989898, 0x00989898, 0x00707070, 0x00484848, 0x00580058, 0x00500050, 0x00480048, 0x00480048, 0x00480048, 0x00500050, 0x00480048, 0x00510150, 0x00580058, 0x006c0070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00646464, 0x006c0070, 0x009c009c, 0x006c0070, 0x006c0070, 0x009c009c, 0x006c0070, 0x00646464, 0x00500050, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00840084, 0x00580058, 0x00580058, 0x00500050, 0x00480048, 0x00480048, 0x00480048, 0x00400040, 0x00400040, 0x00400040, 0x00484848, 0x00707070, 0x00989898, 0x00989898, 0x00b4b4b4, 0x00880000, 0x00b4b4b4, 0x00b4b4b4, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00bc0000, 0x00b00000, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00500050, 0x00580058, 0x00484849, 0x00646464, 0x00707070, 0x00707070, 0x00646564, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00303030, 0x00480048, 0x00500050, 0x00580058, 0x00840084, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x007c7c7c, 0x009c009c, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x009c009c, 0x007c7c7c, 0x00500050, 0x00580058, 0x00500050, 0x00580058, 0x00580058, 0x00840084, 0x00580058, 0x00580058, 0x00580058, 0x00545454, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x00404040, 0x00484848, 0x00545454, 0x00646464, 0x00484848, 0x00600064, 0x006c0070, 0x00c0c0c0, 0x00980000, 0x00c0c0c0, 0x00c0c0c0, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00545454, 0x00bc0000, 0x00710000, 0x00a8a8a8, 0x00a8a8a8, 0x00700000, 0x00a8a8a8, 0x00500050, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00500050, 0x00480048, 0x00500050, 0x00480048, 0x00500050, 0x00480048, 0x00500050, 0x00480048, 0x00500050, 0x00580058, 0x00840084, 0x006c0070, 0x00500050, 0x00500050, 0x00500050, 0x00545454, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x00545454, 0x00500050, 0x00500051, 0x00580058, 0x006c0070, 0x00840084, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00500050, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00400040, 0x00480048, 0x00480048, 0x00500050, 0x00580058, 0x00600064, 0x006c0070, 0x00d0d0d0, 0x00980000, 0x00d0d0d0, 0x00d0d0d0, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00c80000, 0x00a40000, 0x00a8a8a8, 0x00a8a8a8, 0x00640000, 0x00a8a8a8, 0x00500050, 0x00500050, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x00500050, 0x00500150, 0x00480048, 0x00500050, 0x00480048, 0x00500050, 0x00480048, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x007c7c7c, 0x009c009c, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x009c009c, 0x007c7c7c, 0x00500050, 0x00580058, 0x00500050, 0x00580058, 0x00500050, 0x00580058, 0x00580058, 0x00590058, 0x00500050, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480148, 0x00480048, 0x00480048, 0x00500050, 0x00580058, 0x00580058, 0x00600064, 0x00600064, 0x00c1c0c0, 0x00980000, 0x00c0c0c0, 0x00c0c0c0, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00a40000, 0x00980000, 0x00989898, 0x00999898, 0x004c0000, 0x00989898, 0x00500050, 0x00500050, 0x00580058, 0x00500050, 0x00580058, 0x00500050, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500051, 0x00510050, 0x00500050, 0x00545454, 0x006c0070, 0x009c009c, 0x00484848, 0x006c0070, 0x009c009c, 0x006c0070, 0x00545454, 0x00500050, 0x00500050, 0x00580058, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x00500050, 0x00500050, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00500050, 0x00500050, 0x00600064, 0x006c0070, 0x00600064, 0x00c0c0c0, 0x00880000, 0x00c0c0c0, 0x00c0c0c0, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00484848, 0x00383838, 0x00a8a8a8, 0x00a8a8a8, 0x00580000, 0x00a8a8a8, 0x00500050, 0x00500050, 0x00500050, 0x00580059, 0x00500050, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00545454, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00545454, 0x00500050, 0x00500050, 0x00500050, 0x007c7c7c, 0x00545454, 0x006c0070, 0x00484848, 0x006c0070, 0x006c0070, 0x00545454, 0x007c7c7c, 0x00500050, 0x00580058, 0x00500050, 0x00545454, 0x00580058, 0x00500050, 0x00510050, 0x00500050, 0x00545455, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00500050, 0x00500050, 0x00600064, 0x00600064, 0x00500050, 0x00b4b4b5, 0x007c0000, 0x00b4b4b4, 0x00b4b4b4, 0x00202020, 0x00202020, 0x002c2c2c,
-		0x00545454, 0x00545455, 0x00545454, 0x00a8a8a8, 0x00a8a8a8, 0x00640000, 0x00a9a8a8, 0x00646464, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00484848, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00545454, 0x00500050, 0x00500050, 0x00500150, 0x00500050, 0x00545454, 0x007c7c7c, 0x007c7c7c, 0x00545454, 0x00555454, 0x007c7c7c, 0x007c7c7c, 0x00545454, 0x00500050, 0x00500150, 0x00500050, 0x00580058, 0x00545454, 0x00500050, 0x00500050, 0x00490048, 0x00510050, 0x00480048, 0x00707070, 0x00484848, 0x00480048, 0x00480048, 0x00480048, 0x00500050, 0x00500050, 0x00580058, 0x00600064, 0x00580058, 0x00646464, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00202020, 0x002c2c2c, 0x002c2c2c,
-		0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00989898, 0x00646464, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00484848, 0x00707070, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00500050, 0x00500150, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00545454, 0x007c7c7c, 0x007c7c7c, 0x00545554, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00580058, 0x00500050, 0x00500150, 0x00707070, 0x00500050, 0x00500050, 0x00480048, 0x00480048, 0x00480048, 0x00500050, 0x00707070, 0x00707070, 0x00484848, 0x00500050, 0x00500050, 0x00580058, 0x00580058, 0x00646464, 0x00989898, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00580000, 0x00580000, 0x00bc0000,
-		0x00a40000, 0x00b00000, 0x00a40100, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00510050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00480048, 0x00500050, 0x00480048, 0x00480049, 0x00480048, 0x00480048, 0x00500051, 0x00717070, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00b4b4b4, 0x00a8a8a8, 0x00a8a8a8, 0x00640000, 0x00a8a8a8, 0x00a8a8a8, 0x00580000, 0x00580000, 0x00a40000,
-		0x00a50000, 0x007c0000, 0x00880000, 0x00b4b4b4, 0x00b4b4b4, 0x00700001, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x00989898, 0x00707070, 0x00500051, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00510050, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00500051, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00510150, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00480048, 0x00500050, 0x00480048, 0x00500050, 0x00480048, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x00707070, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00580000, 0x00989898, 0x00989898, 0x00580000, 0x00580000, 0x00700000,
-		0x00880000, 0x007c0000, 0x00a40000, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00b4b5b4, 0x00500150, 0x00500050, 0x00510050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500150, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707071, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00480048, 0x00500050, 0x00480048, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00500050, 0x00500050, 0x008c8c8c, 0x008c8c8c, 0x004c0100, 0x008c8c8c, 0x008c8d8c, 0x00580000, 0x00580000, 0x00700000,
-		0x00a40000, 0x00880000, 0x007c0000, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00510050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00646464, 0x00989998, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00989898, 0x00646464, 0x00500050, 0x00500050, 0x00500051, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00500050, 0x00500050, 0x00989898, 0x00989898, 0x00580000, 0x00989898, 0x00989898, 0x00580000, 0x00580000, 0x00880000,
-		0x00a40000, 0x00880000, 0x007c0000, 0x00b4b4b5, 0x00b4b4b4, 0x007c0000, 0x00b4b4b4, 0x00b4b4b4, 0x00707070, 0x00500050, 0x00500051, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500150, 0x00707070, 0x00500150, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00989898, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500150, 0x00500050, 0x00500050, 0x00500050, 0x00500150, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00989898, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x00580059, 0x00580058, 0x00500050, 0x00707070, 0x00989898, 0x00989898, 0x00640000, 0x00989898, 0x00989898, 0x00580000, 0x00580000, 0x00700000,
-		0x00700100, 0x00700000, 0x00880000, 0x00b4b4b4, 0x00b4b4b4, 0x007c0000, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500051, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00989898, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00989898, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00580058, 0x00500050, 0x00580058, 0x00500050, 0x00500050, 0x00999898, 0x00a8a8a9, 0x00a8a8a8, 0x00640000, 0x00a8a8a8, 0x00a8a8a8, 0x00580000, 0x00580000, 0x00700000,
-		0x00400000, 0x00400000, 0x004c0000, 0x00b4b4b5, 0x00b4b4b4, 0x00880000, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00707070, 0x00500050, 0x00500050, 0x00500051, 0x00500050, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00510050, 0x00500050, 0x00500050, 0x00510050, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00580058, 0x00500050, 0x00707070, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00640000, 0x00b4b4b4, 0x00b4b4b4, 0x00580000, 0x00580000, 0x00400000,
-		0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00c0c0c0, 0x00c0c0c0, 0x00880000, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00989898, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00510050, 0x00500150, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00989898, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00510150, 0x00500050, 0x00500050, 0x00707070, 0x00b4b4b4, 0x00b4b4b5, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00202020, 0x00202020, 0x002c2c2c,
-		0x00545454, 0x00484848, 0x00545454, 0x00d0d0d0, 0x00d1d0d0, 0x00a40000, 0x00d0d0d0, 0x00d0d0d0, 0x00d0d0d0, 0x00b4b4b4, 0x00b4b4b4, 0x00989899, 0x00989898, 0x00989898, 0x00989898, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00989998, 0x00b4b4b4, 0x009c009c, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500150, 0x00500050, 0x009c009c, 0x00b4b4b4, 0x00989898, 0x00500050, 0x00500050, 0x00500150, 0x00500050, 0x00500050, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00202020, 0x002c2c2c, 0x002c2c2c,
-		0x00383838, 0x00ed0000, 0x00d40000, 0x00c0c0c0, 0x00c0c0c0, 0x00980000, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x00989898, 0x00500150, 0x00500050, 0x00500050, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00707070, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00707070, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x00500050, 0x00500050, 0x00500050, 0x00989898, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00c0c0c0, 0x00c0c0c0, 0x00880000, 0x00c0c0c0, 0x00c0c0c0, 0x00580000, 0x00580000, 0x002c2c2c,
-		0x00545454, 0x00d40000, 0x00a40000, 0x00b4b4b4, 0x00b4b5b4, 0x00980000, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b5b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00b45400, 0x00b45400, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00b45400, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00b45400, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00b45400, 0x00b45400, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00c0c0c0, 0x00c0c0c0, 0x00c1c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00880000, 0x00c0c0c0, 0x00c0c0c0, 0x00580001, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00d40000, 0x00a40000, 0x00b4b4b4, 0x00b4b4b4, 0x00880000, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b5, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00744c28, 0x00744c28, 0x00500050, 0x00500050, 0x00707070, 0x00b4b4b4, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00b5b4b4, 0x00707070, 0x00500050, 0x00500050, 0x00744c28, 0x00744c28, 0x00b45500, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00d0d0d0, 0x00d0d0d0, 0x00d0d0d0, 0x00980001, 0x00d0d0d0, 0x00d0d0d0, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00d40000, 0x00880000, 0x00b4b4b4, 0x00b4b4b4, 0x00880000, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00646464, 0x00744c28, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00744c28, 0x00744c28, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500051, 0x00500050, 0x00500050, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00744c28, 0x00744c28, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00744c28, 0x00646464, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00980000, 0x00c0c0c0, 0x00c0c0c0, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00383838, 0x00d40000, 0x00a40000, 0x00b4b4b4, 0x00b5b4b4, 0x007c0000, 0x00b5b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x008c8c8c, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00500050, 0x00500150, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x00b45400, 0x008c8c8c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00c0c0c0, 0x00c0c0c0, 0x00880000, 0x00c0c0c0, 0x00c0c0c0, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00545454, 0x00d40000, 0x00a40000, 0x00a8a8a8, 0x00a8a8a8, 0x00710000, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b45400, 0x00744c28, 0x00744c28, 0x008c8c8c, 0x00b45400, 0x00b45400, 0x00744c28, 0x00b4b4b4, 0x008c8c8c, 0x00744c28, 0x00b45400, 0x00b4b4b4, 0x007c7c7c, 0x00500050, 0x00500051, 0x00510050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00510050, 0x00500050, 0x00500050, 0x007c7c7c, 0x00b4b4b4, 0x00b45400, 0x00744c29, 0x008c8c8c, 0x00b4b4b4, 0x00744c28, 0x00b45500, 0x00b45400, 0x008c8c8c, 0x00754c28, 0x00744c28, 0x00b45400, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00383838, 0x00c80000, 0x00a40000, 0x00a8a8a8, 0x00a9a8a8, 0x00700000, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00b4b4b4, 0x00744c28, 0x007c7c7c, 0x008c8c8c, 0x00b4b4b4, 0x00b45400, 0x00744c28, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00545454, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500150, 0x00500050, 0x00510050, 0x00500050, 0x00510050, 0x00500050, 0x00545454, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00744c28, 0x00b45400, 0x00b4b4b4, 0x008c8c8c, 0x007c7c7c, 0x00744c28, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b5b4, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00545454, 0x00a40000, 0x00640000, 0x00b4b4b4, 0x00b4b4b4, 0x00700100, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b45400, 0x00744c28, 0x00b4b4b5, 0x00b4b4b4, 0x007c7c7c, 0x00545454, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500051, 0x00500050, 0x00500050, 0x00500050, 0x00545454, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00744c28, 0x00b45400, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b5b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00400000, 0x00400000, 0x002c2c2c,
-		0x00383838, 0x00484848, 0x002c2c2c, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b5, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x008c8c8c, 0x00b45400, 0x00b4b4b4, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x007c7c7c, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x007c7c7c, 0x00500050, 0x00500050, 0x00510150, 0x00500050, 0x00500050, 0x00500050, 0x00500150, 0x00500050, 0x00500050, 0x00b4b4b4, 0x00b45400, 0x008c8c8c, 0x00b4b4b5, 0x00b4b4b4, 0x00b4b5b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00202020, 0x00202020, 0x002c2c2c,
-		0x00545455, 0x00383838, 0x00545454, 0x00b4b4b4, 0x00b4b4b4, 0x00700000, 0x007c7c7c, 0x00b4b4b5, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00545454, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00646464, 0x00b4b4b4, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500150, 0x00500050, 0x00b4b4b4, 0x00646464, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00545454, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00700000, 0x00b4b4b4, 0x00b4b4b4, 0x00202020, 0x002c2c2c, 0x002c2c2c,
-		0x00d40000, 0x00d40000, 0x00d40000, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00700000, 0x007c7c7c, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b5b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00545454, 0x00500050, 0x00500150, 0x00646464, 0x00b4b4b5, 0x007c7c7c, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x007c7c7c, 0x00b4b4b4, 0x00646464, 0x00500050, 0x00500050, 0x00545454, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x007c7c7c, 0x00700000, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00580000, 0x00580000, 0x00bc0000,
-		0x007c0000, 0x00a40000, 0x00580000, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00700000, 0x00700000, 0x00700000, 0x007c7c7c, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b5b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00b4b4b5, 0x00b5b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b5b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x008c8c8c, 0x00700000, 0x00700000, 0x00700000, 0x007c7c7c, 0x00989898, 0x00b4b4b4, 0x007c7c7c, 0x00580000, 0x00580000, 0x00700000,
-		0x00a40000, 0x007c0000, 0x007c0000, 0x00580000, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x007c7c7c, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x007c7c7c, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00646464, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00646564, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x007c7c7c, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x008c8c8c, 0x00989898, 0x00b4b4b5, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00580000, 0x00580000, 0x00590000, 0x004c0000,
-		0x00a40000, 0x007c0000, 0x00580000, 0x00590000, 0x00580000, 0x00545454, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x007c7c7c, 0x00700000, 0x00700000, 0x00700000, 0x007c7c7c, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00646464, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00656464, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x007c7c7c, 0x00700000, 0x00700000, 0x00710000, 0x007c7c7c, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00545454, 0x00580000, 0x00580000, 0x00580000, 0x00700000, 0x00880000,
-		0x007c0000, 0x00980000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00545454, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x007d7c7c, 0x00700000, 0x00700000, 0x00700000, 0x007c7c7c, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00646464, 0x00500050, 0x00500050, 0x00646464, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b5b4, 0x00989898, 0x007c7c7c, 0x00700000, 0x00700000, 0x00700000, 0x007c7c7c, 0x00989899, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00545454, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00640000, 0x00700000, 0x00a40000,
-		0x00640000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00640000, 0x00580000, 0x00640000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00545454, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989899, 0x007c7c7c, 0x00700000, 0x00700000, 0x00710000, 0x007c7c7d, 0x00999898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00646464, 0x00646464, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b5, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x007c7c7c, 0x00700000, 0x00700000, 0x00700000, 0x007c7c7c, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007d7c7c, 0x00545454, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00700000, 0x00580000, 0x00a40000, 0x00700000, 0x00a40000,
-		0x00640000, 0x00a40000, 0x007c0000, 0x007c0000, 0x00640000, 0x00980000, 0x00980000, 0x00640000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00590000, 0x00580000, 0x00545454, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x007c7c7c, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x007c7c7d, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x007c7c7c, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x007c7c7c, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00545454, 0x00590000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00700000, 0x00a40000, 0x00700000, 0x00580000, 0x00640000, 0x00a40000, 0x004c0000,
-		0x007c0000, 0x00980000, 0x00580000, 0x00a40001, 0x00640000, 0x00640000, 0x00880000, 0x00640000, 0x007c0000, 0x007c0000, 0x00a40000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00400001, 0x00545454, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x007c7c7c, 0x00700000, 0x00700100, 0x00700000, 0x007c7c7c, 0x00989898, 0x00989898, 0x007c7c7c, 0x00700000, 0x00700000, 0x00700000, 0x007c7c7c, 0x00989899, 0x00b4b4b5, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00545454, 0x00400000, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00a40000, 0x00580000, 0x00a40000, 0x00700000, 0x00a40000, 0x00700000, 0x00a50000, 0x00640000, 0x00a40000, 0x00700000,
-		0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0001, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x00400000, 0x00400000, 0x00202020, 0x00202020, 0x002c2c2c, 0x00545454, 0x007c7c7c, 0x00b4b4b4, 0x00b4b5b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00989898, 0x007c7c7c, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x007c7c7c, 0x00989898, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00555454, 0x004c0000, 0x004c0000, 0x004c0000, 0x00400000, 0x00400000, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x00580000, 0x00400000, 0x00400000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000,
-		0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202021, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x00545455, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00545454, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2d2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c,
-		0x00383838, 0x00545454, 0x00383838, 0x00545554, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00545454, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00545454, 0x002c2d2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00404040, 0x00383838, 0x00404040, 0x00484848, 0x00484848, 0x00484848,
-		0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x002c2c2c, 0x002d2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454};
-	// 'greenlight', 64x64px
-	const unsigned int greenlight[] = {
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00646464, 0x00000000, 0x00646464, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007c7c7c, 0x008c8c8c, 0x007c7c7c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00044c00, 0x00046400, 0x00044c00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00046400, 0x00047000, 0x00047c00, 0x00047c00, 0x00047c00, 0x00047000, 0x00047000, 0x00046400, 0x00045800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00046400, 0x00048800, 0x00049800, 0x0004b000, 0x0004c800, 0x0004c800, 0x0004b000, 0x00049800, 0x00049800, 0x00048800, 0x00047c00, 0x00046400, 0x00045800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00046400, 0x0004a400, 0x0004bc00, 0x0000ec00, 0x0000ec00, 0x0000ec00, 0x0000ec00, 0x0000e000, 0x0004c800, 0x0000a800, 0x00049800, 0x00048800, 0x00047c00, 0x00046400, 0x00045800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00046400, 0x0005b000, 0x0004c800, 0x0000e000, 0x0000fc00, 0x0000fc00, 0x0000fc00, 0x0000fc00, 0x0000e000, 0x0000e000, 0x0004c800, 0x0004b000, 0x0004a400, 0x00048800, 0x00047c00, 0x00046400, 0x00045800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00046400, 0x0004a400, 0x0000e001, 0x0000fc00, 0x0080fc7c, 0x00bcfcb8, 0x00d8fcd9, 0x00fcfcb8, 0x00fcfcfc, 0x00fcfc54, 0x00fcfc9c, 0x00fcfcb8, 0x00d9fcd8, 0x00bcfcb9, 0x0080fc7c, 0x0000fc00, 0x0000e000, 0x00049800, 0x00046400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00047c00, 0x00049800, 0x0000ec00, 0x0080fc7c, 0x0080fc7c, 0x0080fc7c, 0x00bcfcb8, 0x00d8fcd8, 0x00fcfcb8, 0x00fcfcb8, 0x00fcfcb8, 0x00d8fcd9, 0x00bcfcb8, 0x0080fc7c, 0x0080fd7c, 0x0080fc7c, 0x0000ec00, 0x00049800, 0x00047c00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00049800, 0x0004c800, 0x0000e000, 0x0000fc00, 0x0080fc7c, 0x0080fc7c, 0x0080fc7c, 0x0080fc7c, 0x0080fc7c, 0x0080fc7c, 0x0080fc7c, 0x0000fc00, 0x0000e000, 0x0004c900, 0x00049900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000};
-	// 'greystone', 64x64px
-	const unsigned int greystone[] = {
-		0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3a, 0x001f1e1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003a3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001e1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1e1f, 0x003b3b3b,
-		0x00575757, 0x00535353, 0x00575757, 0x004f4f4f, 0x00575757, 0x004f4f4f, 0x00575757, 0x004f4f4f, 0x00575757, 0x004f4f4f, 0x004b4b4b, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x001f1f1f, 0x003b3b3b, 0x00838383, 0x00ababab, 0x00b7b7b7, 0x00d3d3d3, 0x00c7c7c7, 0x00d3d3d3, 0x00d3d3d3, 0x00c7c7c7, 0x00d3d3d3, 0x00b7b7b7, 0x00c7c6c7, 0x00ababab, 0x00838383, 0x00575757, 0x001f1f1f, 0x00474747, 0x00474746, 0x00474747, 0x00474747, 0x00474747, 0x00474747, 0x00474747, 0x00474747, 0x00474747, 0x00474747, 0x00535353, 0x004f4f4f, 0x00575757, 0x004f4f4e, 0x00575757, 0x004f4f4f, 0x00575757, 0x004f4f4e, 0x00575757, 0x004f4f4f,
-		0x00535353, 0x00575757, 0x00535353, 0x00535353, 0x00575757, 0x00535353, 0x00525353, 0x00535353, 0x00575757, 0x00535353, 0x00474747, 0x00dfdfdf, 0x00d3d3d3, 0x00c7c7c7, 0x00d3d3d3, 0x00b7b7b7, 0x00d3d3d3, 0x00d3d3d3, 0x00d3d3d3, 0x00c7c7c7, 0x00d3d3d3, 0x00d3d3d3, 0x00b7b7b7, 0x00d3d3d3, 0x00d3d3d3, 0x00c7c7c7, 0x008f8f8f, 0x001f1f1f, 0x003b3b3b, 0x00838383, 0x00c7c7c7, 0x00b7b7b7, 0x008f8f8f, 0x00ababab, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x00ababab, 0x004f4f4f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x006b6b6b, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x007a7b7b, 0x006b6b6b, 0x00676766, 0x00474747, 0x00474747, 0x00474747, 0x004b4b4b, 0x00474747, 0x00474747, 0x00474747, 0x004b4b4b, 0x00474747,
-		0x008f8f8f, 0x008f8f8f, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x008f8f8f, 0x001f1f1f, 0x00535353, 0x004b4b4b, 0x00dfdfdf, 0x00c7c7c7, 0x00c7c7c7, 0x00b7b7b7, 0x00d3d3d3, 0x00b7b7b7, 0x00c7c7c7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00c7c7c7, 0x00b7b7b7, 0x00b7b7b7, 0x00d3d3d3, 0x008f8f8f, 0x005f5f5f, 0x001f1e1f, 0x003b3b3b, 0x00ababab, 0x00d3d3d3, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00575757, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x008f8f8f, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00b7b7b7, 0x00b7b7b7, 0x00ababab, 0x008f8f8f, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f,
-		0x00d3d3d3, 0x00d3d3d3, 0x00d3d3d3, 0x00d3d3d3, 0x00b7b7b7, 0x00ababab, 0x008f8f8f, 0x00838383, 0x001f1f1f, 0x00575757, 0x00474747, 0x00dfdfdf, 0x00d3d3d3, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x00ababab, 0x00ababab, 0x009b9a9b, 0x00ababab, 0x00ababab, 0x007b7b7b, 0x00535353, 0x001f1f1f, 0x003b3b3b, 0x008f8f8f, 0x00b7b7b7, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x00ababab, 0x00ababab, 0x00ababab, 0x00ababab, 0x00838383, 0x008f8f8f, 0x00737373, 0x004f4f4f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x00838383, 0x00dfdfdf, 0x00dfdfdf, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00d3d3d3, 0x00c7c7c7, 0x00d3d3d3, 0x00d3d3d3, 0x00d3d3d3, 0x00c7c7c7, 0x00d3d3d3,
-		0x00ababab, 0x00ababab, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x00ababab, 0x007a7b7b, 0x00737372, 0x001f1f1f, 0x00535353, 0x00474747, 0x00efefef, 0x00b7b7b7, 0x009b9b9b, 0x00ababab, 0x00ababab, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x00ababab, 0x006b6b6b, 0x00535353, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x00838383, 0x008f8f8f, 0x009b9b9b, 0x008f8e8f, 0x00ababab, 0x006b6b6b, 0x00565757, 0x00535353, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x008f8e8f, 0x00d3d3d3, 0x00b7b7b7, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x009b9b9b,
-		0x00b7b7b7, 0x009b9b9b, 0x009b9b9b, 0x009a9b9b, 0x00ababab, 0x008f8f8f, 0x007b7b7b, 0x006b6b6b, 0x001f1f1f, 0x004b4b4b, 0x00474747, 0x00efefef, 0x00d3d3d3, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x009b9b9b, 0x009b9b9b, 0x009b9b9b, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x004f4f4f, 0x001f1f1f, 0x003a3b3b, 0x00474746, 0x007b7b7a, 0x008f8f8f, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x00838383, 0x00ababab, 0x00737373, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x00838383, 0x00dfdfdf, 0x00b7b7b7, 0x008f8f8f, 0x00ababab, 0x00838383, 0x009b9b9b, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x00aaabab, 0x00838383, 0x008f8f8f, 0x009b9b9b, 0x008f8f8f, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x009b9b9b,
-		0x00b7b7b7, 0x00ababab, 0x00838383, 0x00b7b7b7, 0x00838383, 0x009b9b9b, 0x005f5f5f, 0x00575657, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x00efefef, 0x00c7c7c7, 0x008f8f8f, 0x009b9b9b, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x005f5f5f, 0x00575756, 0x001f1e1f, 0x003b3b3b, 0x00474747, 0x00474747, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x008f8f8e, 0x008f8f8f, 0x00ababab, 0x006b6b6b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x008f8f8f, 0x00dfdfdf, 0x00ababab, 0x00ababab, 0x00838383, 0x009b9b9b, 0x007b7b7b, 0x00ababab, 0x009b9b9b, 0x007b7b7b, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x00aaabab, 0x008f8f8f, 0x007b7b7b, 0x00ababab, 0x009b9b9b,
-		0x009b9b9b, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x009b9b9b, 0x00737373, 0x00474747, 0x004b4b4b, 0x001f1f1f, 0x001f1f1f, 0x004b4b4b, 0x00c7c7c7, 0x00b7b7b7, 0x00abaaab, 0x009b9b9b, 0x00ababab, 0x00838383, 0x00aaabab, 0x008f8f8f, 0x009b9b9b, 0x00838383, 0x009b9b9b, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x006b6b6b, 0x00535353, 0x001f1f1f, 0x001f1f1f, 0x004b4a4b, 0x00535353, 0x00474747, 0x007b7b7b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x003b3a3b, 0x00737373, 0x00dfdfdf, 0x00dfdfdf, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00838383, 0x009b9b9b, 0x00737373, 0x009b9b9b, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x007b7b7b, 0x00ababab, 0x00ababab, 0x00737373, 0x008f8f8f,
-		0x008f8f8f, 0x008f8f8e, 0x00838383, 0x008f8f8f, 0x00737373, 0x00535353, 0x00474747, 0x00474747, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x00ababab, 0x00efefef, 0x00ababab, 0x009b9b9b, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x008e8f8f, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x00ababab, 0x00838383, 0x00575757, 0x007b7b7b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x00474747, 0x00474747, 0x00474747, 0x00c7c7c7, 0x00c7c7c7, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x008f8e8f, 0x009b9b9b, 0x009b9b9b, 0x009b9b9b, 0x00838383, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f,
-		0x00737373, 0x006b6b6b, 0x00737373, 0x00737373, 0x004f4f4f, 0x004b4b4b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x004b4b4b, 0x008f8f8f, 0x00d3d3d2, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x006b6b6b, 0x00575757, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1e1f, 0x001f1f1e, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x004b4b4b, 0x00535353, 0x00474747, 0x00c7c7c7, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00838383, 0x008f8f8f, 0x00737373, 0x006b6b6b, 0x00676767, 0x005f5f5f, 0x005f5f5f, 0x00676767, 0x005f5f5f, 0x00676767, 0x005f5f5f,
-		0x00535353, 0x00575757, 0x00474747, 0x00474747, 0x00474747, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003a3b3b, 0x003f3f3f, 0x00737372, 0x00dfdfdf, 0x00ababab, 0x00838383, 0x009b9b9b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x00838383, 0x007b7b7b, 0x008e8f8f, 0x006b6b6b, 0x00676767, 0x003b3b3a, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x00474747, 0x004b4b4b, 0x004b4b4b, 0x00737373, 0x007b7b7b, 0x008f8f8f, 0x00ababab, 0x009b9b9b, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x00737373, 0x003b3b3b, 0x004f4f4f, 0x004b4b4b, 0x00b7b7b7, 0x008f8f8f, 0x006b6b6b, 0x00737373, 0x00676767, 0x005e5f5f, 0x00676767, 0x00575757, 0x00535353, 0x00535353, 0x00535353, 0x00474747, 0x004b4b4b, 0x00474747, 0x004b4b4b, 0x00474747, 0x00474747, 0x004b4b4b,
-		0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x00535353, 0x00474747, 0x00dfdfdf, 0x00c7c7c7, 0x008f8f8f, 0x008f8f8f, 0x008f8f8e, 0x009b9b9b, 0x009b9b9b, 0x00838383, 0x008f8f8f, 0x00ababab, 0x007b7b7b, 0x008f8f8f, 0x00ababab, 0x008f8e8f, 0x004f4f4f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x003f3f3f, 0x00737373, 0x00ababab, 0x00ababab, 0x00d3d3d3, 0x00dfdfdf, 0x00efefef, 0x00d3d3d3, 0x00d3d3d3, 0x00d3d3d3, 0x009b9b9b, 0x006b6a6b, 0x00535353, 0x001f1f1f, 0x00535353, 0x00474747, 0x008f8f8f, 0x006b6b6b, 0x00676767, 0x005f5f5f, 0x00535353, 0x004b4b4b, 0x00474747, 0x00474747, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f,
-		0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x003b3b3b, 0x004f4f4f, 0x00474747, 0x00ababab, 0x00d3d3d3, 0x008f8f8f, 0x00ababab, 0x00838383, 0x007b7b7b, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00838383, 0x009b9b9b, 0x008f8f8f, 0x00838383, 0x00737373, 0x004f4f4f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1e, 0x003b3b3b, 0x00ababab, 0x00b7b7b7, 0x00dfdfdf, 0x00d3d3d3, 0x00b7b7b7, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00737373, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1e, 0x001f1f1f,
-		0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x004b4b4b, 0x004b4b4b, 0x008f8f8f, 0x00c7c7c7, 0x00ababab, 0x00828383, 0x00ababab, 0x009b9b9b, 0x00838383, 0x007b7b7b, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x004f4f4f, 0x00575757, 0x003b3b3b, 0x001f1f1f, 0x003b3b3a, 0x003f3f3f, 0x00aaabab, 0x00dfdfdf, 0x00b7b7b7, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x004f4f4f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1e, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001e1f1f, 0x003a3b3b, 0x001f1f1e, 0x003f3f3f, 0x003f3f3f, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b,
-		0x00535353, 0x004b4b4b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1e1f, 0x003b3b3b, 0x00535352, 0x00474747, 0x00737373, 0x00c7c7c7, 0x00838383, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x00ababab, 0x009b9b9b, 0x00ababab, 0x00838383, 0x00ababab, 0x00838383, 0x00ababab, 0x004f4f4f, 0x00737373, 0x00474747, 0x001f1f1f, 0x001f1e1f, 0x004b4b4b, 0x00ababab, 0x00efefef, 0x00ababab, 0x008f8f8f, 0x00838383, 0x00ababaa, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x00535353, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x00575757, 0x00535353, 0x00575757, 0x00575757, 0x001f1f1f, 0x00474747, 0x004b4b4b, 0x00474747, 0x00474747, 0x004b4b4b, 0x00474747, 0x00474746, 0x00474747, 0x00474747, 0x00474747, 0x00474747, 0x00474747, 0x003f3f3f,
-		0x009b9b9b, 0x009b9b9b, 0x008f8f8f, 0x009b9b9b, 0x008f8e8f, 0x009b9b9b, 0x008f8f8f, 0x009b9b9b, 0x009b9b9b, 0x001f1f1f, 0x001f1f1e, 0x00575757, 0x00474747, 0x00c7c7c7, 0x00b7b7b7, 0x009b9b9b, 0x008f8f8f, 0x00838383, 0x009b9b9b, 0x009b9b9b, 0x00737373, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x006b6b6b, 0x00575757, 0x00535352, 0x001f1f1f, 0x001f1f1f, 0x004b4b4b, 0x00ababab, 0x00efefef, 0x00838383, 0x008f8f8e, 0x00ababab, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x004f4f4f, 0x003a3b3b, 0x001f1f1f, 0x003b3b3b, 0x006a6b6b, 0x00ababab, 0x00dfdfdf, 0x00d3d3d3, 0x00575757, 0x00474747, 0x00535353, 0x007b7b7b, 0x009b9b9b, 0x009b9b9b, 0x008f8f8f, 0x009b9b9b, 0x009b9b9b, 0x009b9b9b, 0x008f8f8f, 0x009b9b9b, 0x009b9b9b, 0x009b9b9b, 0x009b9b9b,
-		0x00d3d3d3, 0x00c7c7c7, 0x00d3d3d3, 0x00d3d3d3, 0x00c7c7c7, 0x00d3d3d3, 0x00b7b7b7, 0x00ababab, 0x00737373, 0x003f3f3f, 0x001f1f1f, 0x00575757, 0x00474747, 0x008f8f8f, 0x00b7b7b7, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x00ababab, 0x008f8f8f, 0x006b6b6b, 0x008f8f8f, 0x006b6b6a, 0x004b4b4b, 0x001f1f1f, 0x001f1f1f, 0x004b4b4b, 0x00aaabab, 0x00c7c7c7, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00575757, 0x003b3b3b, 0x001f1f1e, 0x003b3b3b, 0x00ababab, 0x00d3d3d3, 0x00c7c7c7, 0x00ababab, 0x001e1f1f, 0x00474747, 0x007b7b7b, 0x00c7c7c7, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdedf, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00d3d3d3,
-		0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x00abaaab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x006b6b6b, 0x00737373, 0x003b3b3b, 0x001f1f1f, 0x00535353, 0x00474747, 0x00737373, 0x009b9b9b, 0x00ababab, 0x00838283, 0x00ababab, 0x00ababab, 0x00838283, 0x00ababab, 0x00737373, 0x008f8f8f, 0x006b6b6b, 0x00535353, 0x00737273, 0x00535353, 0x004b4b4b, 0x001f1f1f, 0x001f1f1f, 0x004b4b4b, 0x00ababab, 0x00c7c6c7, 0x00ababab, 0x008f8f8f, 0x006b6b6b, 0x00737373, 0x00737373, 0x006b6b6b, 0x00535353, 0x00575757, 0x00535353, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x00d3d3d3, 0x00c7c7c7, 0x00ababab, 0x00838383, 0x001f1f1f, 0x004b4b4b, 0x009b9b9b, 0x00d3d3d3, 0x00d3d3d3, 0x00b7b7b7, 0x00b7b7b7, 0x00ababab, 0x00b7b7b7, 0x00b7b7b7, 0x00b7b7b7, 0x00ababab, 0x00b7b7b7, 0x00b7b7b7, 0x00b7b7b7,
-		0x00ababab, 0x008f8f8f, 0x009b9b9b, 0x008f8f8f, 0x00ababab, 0x00838383, 0x008f8f8e, 0x006b6b6b, 0x00737373, 0x003b3b3b, 0x001f1f1e, 0x00474747, 0x00535253, 0x00474747, 0x009b9b9b, 0x008f8f8f, 0x00737373, 0x00737373, 0x006b6b6b, 0x00737373, 0x00535353, 0x00535353, 0x00737373, 0x004f4f4f, 0x00737373, 0x00535353, 0x00474747, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x009b9b9b, 0x008f8f8f, 0x00737373, 0x008f8f8f, 0x006b6b6b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x005f5f5f, 0x00dfdfdf, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x001f1f1f, 0x00464747, 0x009b9b9b, 0x00dfdfdf, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x009b9b9b, 0x00838383, 0x009b9b9b, 0x009b9b9b,
-		0x00ababab, 0x008f8f8f, 0x008e8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x00ababab, 0x006b6b6b, 0x00575757, 0x003b3b3b, 0x001f1f1f, 0x00474747, 0x00535353, 0x00474747, 0x00676767, 0x00535353, 0x00575757, 0x00535353, 0x00575757, 0x00474747, 0x00474747, 0x00474747, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1e, 0x001f1f1f, 0x001f1f1f, 0x008f8f8f, 0x00737373, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1e, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x005f5f5f, 0x00dfdfdf, 0x00ababab, 0x00ababab, 0x00838383, 0x001f1f1e, 0x004b4b4b, 0x009b9b9b, 0x00d3d3d3, 0x00ababab, 0x008f8f8f, 0x009b9b9b, 0x00838383, 0x009b9b9b, 0x008f8f8f, 0x009b9b9b, 0x00727373, 0x00838383, 0x008f8f8f, 0x00838383,
-		0x00ababab, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x008f8f8f, 0x00727373, 0x004f4f4f, 0x003b3b3b, 0x001f1f1f, 0x00474747, 0x00535253, 0x00474747, 0x001f1f1f, 0x003b3a3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1e, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x003b3b3b, 0x004f4f4f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1e, 0x003b3b3b, 0x001f1f1f, 0x008f8f8f, 0x00dfdfdf, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x001f1f1f, 0x00474747, 0x008f8f8f, 0x00c7c7c7, 0x00838383, 0x00ababab, 0x009b9b9b, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x009b9b9b, 0x00838383, 0x009b9b9b, 0x009b9b9b,
-		0x008f8f8f, 0x00ababab, 0x00737373, 0x007b7b7b, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x006b6b6b, 0x00575757, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x004f4f4f, 0x00575757, 0x004b4b4b, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001e1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x004f4f4f, 0x004b4b4b, 0x004b4b4b, 0x004f4f4f, 0x004b4b4b, 0x004b4b4b, 0x00474747, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x008f8f8e, 0x008f8f8f, 0x007a7b7b, 0x00575757, 0x001f1f1f, 0x003f3f3f, 0x00676767, 0x00b7b7b7, 0x00dfdfdf, 0x00ababab, 0x00838383, 0x007a7b7b, 0x001f1f1f, 0x004b4b4b, 0x00838383, 0x00c7c7c7, 0x00ababab, 0x00838283, 0x009b9b9b, 0x008f8f8f, 0x009a9b9b, 0x00838383, 0x009b9b9b, 0x007b7b7b, 0x007b7b7b, 0x008f8f8f, 0x008f8f8f,
-		0x008f8f8f, 0x00838383, 0x00838383, 0x007b7b7b, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00676767, 0x00474747, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x00838383, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00c7c7c7, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x005f5f5f, 0x003a3b3b, 0x004b4b4b, 0x00676767, 0x007b7b7b, 0x00ababab, 0x00ababab, 0x00b7b7b7, 0x00c7c7c7, 0x00c7c7c7, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00c7c7c7, 0x009b9a9b, 0x00676767, 0x001f1f1f, 0x003b3b3b, 0x007b7b7b, 0x00dfdfdf, 0x00c7c7c7, 0x009b9b9b, 0x00ababab, 0x00737373, 0x001f1f1f, 0x00474747, 0x00838383, 0x00b7b7b7, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x007b7b7b, 0x007b7b7b, 0x008f8f8f, 0x008f8f8f,
-		0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x005f5f5f, 0x004b4b4b, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x00d3d2d3, 0x00c7c7c7, 0x00ababaa, 0x008f8f8f, 0x009b9b9b, 0x009b9b9b, 0x00ababab, 0x008f8f8f, 0x009b9b9b, 0x003b3b3b, 0x004f4e4f, 0x004b4b4b, 0x007b7b7b, 0x00d3d3d3, 0x00efefef, 0x00dfdfdf, 0x00dfdfdf, 0x00c7c7c7, 0x00b7b7b7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x006b6b6b, 0x00575757, 0x001f1f1f, 0x003b3b3b, 0x008f8f8f, 0x00dfdfdf, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x006b6b6b, 0x001f1f1f, 0x004b4b4b, 0x006b6b6a, 0x00c7c7c7, 0x00838383, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x009b9b9b, 0x008f8f8f, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x008f8f8f,
-		0x009b9b9b, 0x00ababab, 0x00838383, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00737373, 0x00535353, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x00dfdfdf, 0x009b9b9b, 0x008f8f8e, 0x009b9b9b, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x009b9b9b, 0x00ababab, 0x001f1f1f, 0x00535353, 0x004b4b4b, 0x009b9b9b, 0x00dfdedf, 0x00c7c7c7, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00abaaab, 0x009b9b9b, 0x00838383, 0x00ababab, 0x009b9b9b, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x00838383, 0x00676767, 0x00474747, 0x001f1f1f, 0x003b3b3b, 0x008f8f8f, 0x00efefef, 0x00ababab, 0x00838383, 0x00ababab, 0x00575757, 0x001f1f1f, 0x004b4b4b, 0x00474747, 0x008f8f8f, 0x00737373, 0x005f5f5f, 0x00575757, 0x00535353, 0x00535353, 0x00676667, 0x00676767, 0x006b6b6b, 0x007b7b7b, 0x008f8f8f, 0x00838383,
-		0x00676767, 0x005f5f5f, 0x00676767, 0x005f5f5f, 0x00676767, 0x00535353, 0x00474747, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x003b3a3b, 0x00d3d3d3, 0x00ababab, 0x00aaabab, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x005f5f5e, 0x001f1f1f, 0x004b4b4b, 0x00474747, 0x009b9b9b, 0x00efefef, 0x00ababab, 0x009b9a9b, 0x00ababab, 0x008f8f8f, 0x007b7b7b, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x00838383, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x00575757, 0x00474747, 0x001f1f1f, 0x003b3b3b, 0x00838383, 0x00efefef, 0x00ababaa, 0x00ababab, 0x008f8f8f, 0x00575757, 0x001f1f1f, 0x00535353, 0x001f1f1f, 0x003b3b3b, 0x003b3b3b, 0x00474747, 0x00474747, 0x00474747, 0x00474747, 0x004b4b4b, 0x00474747, 0x00474747, 0x00535353, 0x00575757, 0x00535353,
-		0x00525353, 0x004b4b4b, 0x00474746, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x00dfdfdf, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x007b7b7b, 0x005f5f5f, 0x001f1f1e, 0x004b4b4b, 0x00474747, 0x009b9b9a, 0x00efefef, 0x00838383, 0x00ababab, 0x008f8f8f, 0x009b9b9b, 0x00ababab, 0x00838383, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x004f4f4f, 0x004b4b4b, 0x001f1f1f, 0x003b3b3b, 0x008f8f8f, 0x00efefef, 0x00838383, 0x00ababab, 0x008f8f8f, 0x004f4f4f, 0x001f1f1f, 0x00575757, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x003b3b3b, 0x00474747,
-		0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x004b4b4b, 0x004b4b4b, 0x00474747, 0x00dfdfdf, 0x00ababab, 0x009b9b9b, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x007b7b7b, 0x005f5f5f, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x009b9b9b, 0x00efefef, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x00838382, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x00838382, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x004f4f4f, 0x004b4b4b, 0x001f1f1f, 0x003b3b3b, 0x00838383, 0x00efefef, 0x00ababab, 0x00ababab, 0x00838383, 0x00575757, 0x001f1f1f, 0x00575757, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1e1f,
-		0x00474747, 0x00676767, 0x00676767, 0x006b6b6b, 0x008f8f8f, 0x009b9b9b, 0x008f8f8f, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x00474747, 0x001f1f1f, 0x00dfdfdf, 0x00ababab, 0x00737373, 0x009b9b9b, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00838383, 0x00676767, 0x003b3b3b, 0x001f1f1f, 0x00474747, 0x008f8f8f, 0x00efefef, 0x00ababaa, 0x008f8f8f, 0x00828383, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x00ababab, 0x007b7b7b, 0x008f8f8f, 0x00838383, 0x00ababab, 0x00535353, 0x00474747, 0x001f1f1f, 0x003b3b3a, 0x008f8f8f, 0x00efefef, 0x008f8e8f, 0x00ababab, 0x00ababab, 0x004f4f4f, 0x001f1f1f, 0x00575757, 0x00474747, 0x003f3f3f, 0x00474747, 0x004f4f4f, 0x00535353, 0x004f4e4f, 0x00575757, 0x00535353, 0x00535353, 0x00575757, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b,
-		0x00676767, 0x008f8f8f, 0x00b7b7b7, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00d3d3d3, 0x00d3d3d3, 0x00c7c7c7, 0x00ababab, 0x00737373, 0x001f1f1f, 0x00dfdfdf, 0x00ababab, 0x00ababab, 0x00838383, 0x007b7b7b, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00676767, 0x003b3b3b, 0x001f1f1f, 0x00474747, 0x008f8f8f, 0x00dfdfdf, 0x00b7b7b7, 0x009b9b9b, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00737373, 0x007b7b7b, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00575757, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x008f8f8f, 0x00d3d3d3, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x004f4f4f, 0x001f1f1f, 0x004b4a4b, 0x00ababab, 0x00dfdfdf, 0x00d3d3d3, 0x00b7b7b7, 0x008f8f8f, 0x005f5f5f, 0x00575757, 0x00474647, 0x00474747, 0x004b4b4b, 0x00474747, 0x00474747, 0x00535353,
-		0x00676767, 0x00ababab, 0x00d3d3d3, 0x00c7c7c7, 0x00c7c7c7, 0x00b7b7b7, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x00ababaa, 0x003f3f3f, 0x001f1f1f, 0x00efefef, 0x008f8f8f, 0x009b9b9b, 0x00ababab, 0x007b7b7b, 0x008f8f8f, 0x00ababab, 0x009b9b9b, 0x006b6b6b, 0x00474747, 0x001f1f1f, 0x004b4b4b, 0x007b7b7b, 0x00d3d3d3, 0x00c7c7c7, 0x00ababab, 0x00838383, 0x008f8f8f, 0x00737373, 0x008f8f8f, 0x007b7b7b, 0x007b7b7b, 0x00ababab, 0x008f8f8f, 0x00abaaab, 0x00838383, 0x00838383, 0x004f4f4f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x008f8f8f, 0x00dfdfdf, 0x00aaabab, 0x008f8e8f, 0x008f8f8f, 0x00535353, 0x001f1f1f, 0x004b4b4b, 0x00dfdfdf, 0x00838383, 0x008f8f8f, 0x00b7b7b7, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x008e8f8f, 0x003b3b3b, 0x00535353,
-		0x00676767, 0x00dfdfdf, 0x00b7b7b7, 0x00ababab, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8e, 0x00ababab, 0x00838383, 0x00737373, 0x001f1f1f, 0x00efefef, 0x009b9b9b, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x00838383, 0x00ababab, 0x006a6b6b, 0x004b4b4b, 0x001f1f1f, 0x003b3b3b, 0x004f4f4f, 0x00c7c7c7, 0x00dfdfdf, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x007b7b7b, 0x007b7b7b, 0x008f8f8f, 0x00ababab, 0x006b6b6b, 0x00575757, 0x003b3b3b, 0x001f1f1f, 0x003f3f3f, 0x008f8f8f, 0x00d3d3d3, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x004f4f4f, 0x001f1f1f, 0x004b4b4b, 0x00dfdfdf, 0x008f8f8f, 0x00838383, 0x00ababab, 0x00ababab, 0x00838383, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00838383, 0x00838383, 0x003b3b3b, 0x004f4f4f,
-		0x00676767, 0x00d3d3d3, 0x00b7b7b7, 0x009b9b9b, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x00737373, 0x001f1f1f, 0x00efefef, 0x009b9b9b, 0x00838383, 0x009b9b9b, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00676766, 0x00535353, 0x001f1f1f, 0x001f1f1f, 0x00575757, 0x00ababab, 0x00efefef, 0x00abaaab, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x007b7b7b, 0x007b7b7b, 0x00ababab, 0x00838383, 0x00737373, 0x00474747, 0x003b3b3b, 0x001f1f1f, 0x004b4b4b, 0x008f8f8f, 0x00d3d3d3, 0x00ababab, 0x00ababab, 0x00838383, 0x00575757, 0x001f1f1f, 0x00474747, 0x00dfdfdf, 0x00ababab, 0x00ababab, 0x00838383, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x005f5f5f, 0x003b3b3b, 0x00474747,
-		0x00676767, 0x00dfdfdf, 0x00ababab, 0x008f8f8f, 0x00ababaa, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x007b7b7b, 0x00ababab, 0x004f4f4f, 0x001f1f1f, 0x00dfdfdf, 0x00ababab, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x00676767, 0x004f4f4f, 0x001f1f1f, 0x003b3b3b, 0x004f4f4f, 0x008f8f8f, 0x00efefef, 0x00b7b7b7, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x008f8f8f, 0x009b9b9b, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x005f5f5f, 0x00474747, 0x001f1f1f, 0x003b3b3b, 0x003f3f3f, 0x008f8f8f, 0x00d3d3d3, 0x009b9b9b, 0x008f8f8f, 0x00ababab, 0x004f4f4f, 0x001f1f1f, 0x004b4b4a, 0x00c7c7c7, 0x00aaabab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x00838383, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x005f5f5f, 0x003b3b3b, 0x00474647,
-		0x00676767, 0x00dfdfdf, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x009b9b9b, 0x009b9b9b, 0x00ababab, 0x00838383, 0x00575757, 0x001f1f1f, 0x00dfdfdf, 0x00b7b7b7, 0x007b7a7b, 0x009b9b9b, 0x007b7b7b, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x005f5f5f, 0x00575757, 0x001f1f1f, 0x001f1f1e, 0x004b4b4b, 0x006b6b6b, 0x00d3d3d3, 0x00b7b7b7, 0x00ababab, 0x008f8f8f, 0x007b7b7b, 0x009b9b9b, 0x00838383, 0x008f8f8f, 0x009b9b9b, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x005f5f5f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x004b4b4b, 0x008f8f8f, 0x00d3d3d3, 0x008f8f8f, 0x00aaabab, 0x004f4f4f, 0x00575757, 0x001f1f1f, 0x004b4b4b, 0x00c7c7c7, 0x00ababab, 0x009b9b9b, 0x00ababaa, 0x008f8f8f, 0x00ababab, 0x00838383, 0x008f8f8f, 0x00ababab, 0x009b9b9b, 0x00565757, 0x003b3b3b, 0x00474747,
-		0x00676767, 0x00d3d3d3, 0x00b7b7b7, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x00535353, 0x001f1f1f, 0x00c7c7c7, 0x00dfdfdf, 0x00838383, 0x009b9b9b, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x005f5f5f, 0x00575757, 0x001f1f1f, 0x001f1f1f, 0x004b4b4b, 0x00535353, 0x00b7b7b6, 0x00dfdfdf, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababaa, 0x008f8f8f, 0x00ababab, 0x00838383, 0x008f8e8f, 0x00676767, 0x00535353, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x007b7b7b, 0x00ababab, 0x007b7b7b, 0x004f4f4f, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003f3f3f, 0x00ababaa, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x00ababaa, 0x008f8f8f, 0x00838382, 0x00ababab, 0x00575757, 0x003b3b3b, 0x003b3b3b,
-		0x00676767, 0x00dfdfdf, 0x00b7b7b7, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x004f4f4f, 0x001f1f1f, 0x00b7b7b7, 0x00dfdfdf, 0x007b7b7b, 0x00ababab, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x006b6b6b, 0x00575757, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x004f4f4f, 0x008f8f8f, 0x00b7b7b7, 0x00ababab, 0x008f8f8f, 0x007b7b7b, 0x00676767, 0x005f5f5f, 0x00535353, 0x00474747, 0x004b4b4b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x003f3f3f, 0x00575757, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003f3f3f, 0x00474747, 0x001f1f1f, 0x00737373, 0x004f4f4f, 0x00474747, 0x00535353, 0x00575757, 0x00535353, 0x00575757, 0x00535353, 0x00535353, 0x00575757, 0x00535353, 0x003b3b3b, 0x003b3b3b,
-		0x00676767, 0x00dfdfdf, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x00838383, 0x00ababab, 0x007b7a7b, 0x00ababab, 0x00535353, 0x001f1f1f, 0x009b9b9b, 0x00d3d3d3, 0x009b9b9b, 0x007b7b7b, 0x00ababab, 0x00ababab, 0x00838383, 0x008f8f8f, 0x006b6b6b, 0x00575757, 0x001f1f1f, 0x001f1f1f, 0x003b3b3a, 0x00535353, 0x00474747, 0x008f8f8f, 0x008f8f8f, 0x005f5f5f, 0x00575757, 0x00474747, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x004f4f4f, 0x00474747, 0x00474747, 0x004f4f4f, 0x00535353, 0x00575757, 0x00535353, 0x00575757, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3a3b,
-		0x00676767, 0x00d3d3d3, 0x00b7b7b7, 0x008f8f8f, 0x00838383, 0x009b9b9b, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00575757, 0x001f1f1f, 0x007b7b7b, 0x00dfdfdf, 0x00ababab, 0x009b9a9b, 0x00ababab, 0x00838383, 0x008f8f8f, 0x00ababab, 0x00676767, 0x004f4f4f, 0x001f1f1f, 0x001f1e1f, 0x001f1f1f, 0x004f4f4f, 0x00464747, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001e1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x00535353, 0x00575757, 0x00474747, 0x00474746, 0x004b4b4b, 0x00474747, 0x00474747, 0x00464747, 0x004b4b4b, 0x00474747, 0x00474747, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3a, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b,
-		0x00676767, 0x00dfdfdf, 0x00b7b6b7, 0x00ababab, 0x00ababab, 0x00828383, 0x009b9b9b, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00535353, 0x001f1f1f, 0x00575757, 0x00efefef, 0x008f8f8f, 0x009b9b9b, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00676767, 0x00535352, 0x001e1f1f, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x00474747, 0x00474747, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x004b4b4b, 0x00474747, 0x004b4b4b, 0x003f3f3f, 0x004f4f4f, 0x004b4b4b, 0x00474747, 0x004b4b4b, 0x00474747, 0x00474747, 0x00575757, 0x00535353, 0x007a7b7b, 0x007b7b7b, 0x007b7a7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7a7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7a7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x00737372, 0x003b3b3b, 0x004f4f4f,
-		0x00676767, 0x00dfdfdf, 0x00ababab, 0x008e8f8f, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x006b6b6a, 0x00575757, 0x001f1f1f, 0x00474747, 0x00efefef, 0x00ababab, 0x008f8f8f, 0x00838382, 0x007b7b7b, 0x008f8f8f, 0x00ababab, 0x006b6b6b, 0x00575757, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003f3f3f, 0x00676767, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x009b9b9b, 0x00ababab, 0x00b7b7b7, 0x00ababab, 0x00c7c6c7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x007b7b7b, 0x003b3b3b, 0x004f4f4f,
-		0x00676767, 0x00c7c7c7, 0x00b7b7b7, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x004f4f4f, 0x001f1f1f, 0x001f1f1f, 0x004f4f4f, 0x00efefef, 0x009a9b9b, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x008e8f8f, 0x00838383, 0x00676767, 0x00575756, 0x003b3b3b, 0x001f1f1f, 0x001f1f1e, 0x003b3b3b, 0x007b7b7b, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b6, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b6b7, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00efefef, 0x00efefef, 0x00efefef, 0x00efefef, 0x00efefef, 0x00efefef, 0x00efefef, 0x00efefef, 0x00efefef, 0x00efefef, 0x00efefef, 0x00d3d3d3, 0x00dfdfdf, 0x00d3d3d3, 0x00d3d3d3, 0x008f8f8f, 0x00676767, 0x001f1f1f, 0x004b4b4b,
-		0x00676767, 0x00d3d2d3, 0x00b7b7b7, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x00838383, 0x00575757, 0x001f1f1f, 0x003b3b3b, 0x003f3f3f, 0x00efefef, 0x008f8f8f, 0x00ababab, 0x007b7b7b, 0x009b9b9b, 0x00838383, 0x00abaaaa, 0x00676767, 0x004f4f4f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x007b7b7b, 0x00c7c7c7, 0x00c7c7c7, 0x00efefef, 0x00efefef, 0x00efefef, 0x00efefef, 0x00efefef, 0x00dfdfdf, 0x00dfdfdf, 0x00efefef, 0x00efefef, 0x00dfdfdf, 0x00efefef, 0x00efefef, 0x00efefef, 0x00efefef, 0x00efefef, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00d3d3d3, 0x00b7b7b7, 0x00b7b7b7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00ababab, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x007b7b7b, 0x00575757, 0x001f1f1f, 0x004f4f4f,
-		0x00666767, 0x00b7b7b7, 0x00b7b7b7, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x004f4f4f, 0x001f1f1f, 0x003b3b3a, 0x00474747, 0x00dfdfdf, 0x00ababab, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x005f5f5f, 0x00575757, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x007b7b7b, 0x00c7c7c7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00b7b7b7, 0x00c7c7c7, 0x00ababab, 0x00b7b7b7, 0x00c7c7c7, 0x00ababab, 0x00b7b6b7, 0x00c7c7c7, 0x00b7b7b7, 0x00b7b7b7, 0x00ababab, 0x00aaabab, 0x009b9b9b, 0x009b9b9b, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x006b6b6b, 0x00575757, 0x003b3b3b, 0x003b3b3b,
-		0x004b4b4b, 0x00c7c7c7, 0x00838383, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00737373, 0x006a6b6b, 0x00737373, 0x00535353, 0x001e1f1f, 0x003b3b3b, 0x00474747, 0x00d3d3d3, 0x00838383, 0x008f8e8f, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x006b6b6b, 0x00565757, 0x003b3a3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x00676767, 0x00b7b7b7, 0x00dfdfdf, 0x00b7b7b7, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x009b9b9b, 0x00ababab, 0x00abaaab, 0x00ababab, 0x008f8f8f, 0x007b7b7b, 0x009b9b9b, 0x00838383, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x006b6b6b, 0x00535353, 0x001f1f1f, 0x003b3b3b,
-		0x00474747, 0x00b7b7b7, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x00575757, 0x00535353, 0x00535353, 0x001f1f1f, 0x001e1f1f, 0x003f3f3f, 0x00474747, 0x00b7b7b7, 0x00ababab, 0x00838383, 0x008f8f8f, 0x00abaaab, 0x008f8f8f, 0x00838383, 0x00737373, 0x00535353, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x00474747, 0x00c7c7c7, 0x00dfdfdf, 0x00b7b7b7, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x00ababaa, 0x008f8f8f, 0x009b9b9b, 0x008f8f8f, 0x009b9b9b, 0x00ababab, 0x00838383, 0x008f8f8f, 0x009b9b9b, 0x00ababab, 0x00ababab, 0x00828383, 0x009a9b9b, 0x008f8f8f, 0x009b9b9b, 0x008f8f8f, 0x008f8f8f, 0x007b7b7b, 0x00838383, 0x009b9b9b, 0x009b9b9b, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x006b6b6a, 0x00575757, 0x003b3b3b, 0x003b3b3b,
-		0x00474747, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x00575757, 0x00535353, 0x00575757, 0x00535353, 0x00535353, 0x001f1f1f, 0x003b3b3b, 0x003b3b3b, 0x003f3f3f, 0x009b9b9b, 0x009b9b9b, 0x00aaabab, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x006b6b6b, 0x00676767, 0x00535353, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x00b7b7b7, 0x00dfdfdf, 0x00d3d3d3, 0x00ababab, 0x00ababab, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x00838383, 0x00ababab, 0x008f8f8f, 0x009b9b9b, 0x00838383, 0x00ababab, 0x009b9b9b, 0x007b7b7b, 0x00838383, 0x008f8f8f, 0x00ababab, 0x00838383, 0x008f8e8f, 0x00ababab, 0x008f8f8f, 0x007b7b7b, 0x00737373, 0x008f8f8f, 0x007b7b7b, 0x009b9b9b, 0x008f8f8f, 0x008f8f8f, 0x00737373, 0x00535353, 0x001e1f1f, 0x003b3b3b,
-		0x00474747, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x00575757, 0x00535353, 0x00535353, 0x00575757, 0x001f1f1f, 0x003b3b3b, 0x003f3f3f, 0x004b4b4b, 0x007b7b7b, 0x00676767, 0x005f5f5f, 0x00676767, 0x00676767, 0x005f5f5f, 0x00676767, 0x00535353, 0x00535353, 0x003b3a3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x00ababab, 0x00d3d3d3, 0x00d3d3d3, 0x008e8f8f, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x007b7b7b, 0x007b7b7b, 0x009b9b9b, 0x009b9b9b, 0x00838383, 0x00ababab, 0x008f8f8e, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x00838383, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00737373, 0x00838383, 0x006b6b6b, 0x00575757, 0x001f1f1f, 0x003b3b3b,
-		0x00535353, 0x00575757, 0x00525353, 0x00474747, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x003b3b3b, 0x003f3f3f, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003a3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x008f8f8f, 0x00d3d3d3, 0x00b7b7b7, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x007b7b7b, 0x008f8f8f, 0x00838383, 0x009b9b9a, 0x007b7b7b, 0x009b9b9b, 0x008f8f8f, 0x009b9b9b, 0x007b7b7b, 0x00ababab, 0x00838383, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x00ababab, 0x008f8f8f, 0x007a7b7b, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x007b7b7b, 0x006b6b6b, 0x00575757, 0x001e1f1f, 0x003b3b3b,
-		0x00474747, 0x004b4b4b, 0x00474747, 0x00474747, 0x00474747, 0x004b4b4b, 0x00474747, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x004b4b4b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1e1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x00838383, 0x009b9b9b, 0x006b6a6b, 0x00727373, 0x00737373, 0x006b6b6b, 0x00737373, 0x00737373, 0x006b6b6b, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x00838383, 0x008f8f8f, 0x007b7b7b, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x007b7b7b, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x00ababab, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x009b9b9b, 0x006b6a6b, 0x00575757, 0x001f1f1f, 0x003b3b3b,
-		0x00474747, 0x007b7b7b, 0x00ababab, 0x00ababab, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x00676767, 0x004b4b4b, 0x004b4b4b, 0x00535353, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x00535353, 0x00474747, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1e, 0x00575757, 0x00737373, 0x006b6b6b, 0x007b7b7b, 0x008f8f8f, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7a7b, 0x007b7b7a, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x007b7b7b, 0x00676767, 0x004f4f4f, 0x001f1f1f, 0x003b3b3b,
-		0x00474747, 0x00ababab, 0x00c7c7c7, 0x00d3d3d3, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00b7b7b7, 0x00ababab, 0x00abaaab, 0x008f8f8f, 0x006b6b6b, 0x005f5f5f, 0x00575757, 0x004b4b4b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003a3b3b, 0x003a3b3b, 0x003b3b3b, 0x003b3b3b, 0x003f3f3f, 0x00575757, 0x00474747, 0x00464747, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x004b4b4b, 0x00535353, 0x00535353, 0x00575657, 0x00535353, 0x00575757, 0x00535353, 0x00575757, 0x00535353, 0x00575757, 0x00535353, 0x00535353, 0x00535353, 0x00575757, 0x00535353, 0x00575757, 0x00535353, 0x00535353, 0x00565757, 0x00535353, 0x00575757, 0x00535353, 0x00535353, 0x00535353, 0x001f1f1f, 0x003a3b3b, 0x003b3b3b,
-		0x00474747, 0x00ababab, 0x00d3d3d3, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x00b7b7b7, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdedf, 0x00b7b7b7, 0x00ababab, 0x00ababab, 0x00ababab, 0x00ababab, 0x00ababab, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x008e8f8f, 0x008f8f8f, 0x00838383, 0x007b7b7b, 0x007b7b7b, 0x006b6b6b, 0x00676767, 0x00676767, 0x004f4f4f, 0x00575757, 0x00474747, 0x00474747, 0x00464747, 0x003f3f3f, 0x00474747, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1e1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1e1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x003f3f3f,
-		0x00464747, 0x00ababab, 0x00dfdfdf, 0x00ababab, 0x00ababab, 0x00abaaab, 0x00b7b7b7, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00b7b7b7, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfde, 0x00c7c7c7, 0x00d3d3d3, 0x00c7c7c7, 0x00b7b7b7, 0x00ababab, 0x00ababab, 0x00ababab, 0x00ababab, 0x00ababab, 0x00828383, 0x004b4b4b, 0x00535353, 0x00474747, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003a3b3b, 0x003b3b3a, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1e1f, 0x003b3a3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x00474747, 0x004b4b4b,
-		0x00474747, 0x00ababab, 0x00dfdfdf, 0x00ababab, 0x00838383, 0x00ababab, 0x007b7b7b, 0x007b7b7b, 0x00ababab, 0x009b9b9b, 0x008f8f8f, 0x007b7b7b, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8e, 0x00ababab, 0x00ababab, 0x00ababab, 0x00c7c7c7, 0x00d3d3d3, 0x00dfdfdf, 0x00d3d3d3, 0x00d2d3d3, 0x00b7b7b7, 0x00838383, 0x003b3b3b, 0x00474747, 0x004f4f4f, 0x004b4b4b, 0x00474747, 0x00474747, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3a3b, 0x003b3b3a, 0x003f3f3f, 0x00474747, 0x004b4b4b, 0x00535353,
-		0x00474747, 0x00ababab, 0x00c7c7c7, 0x00ababab, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x009b9b9b, 0x00ababab, 0x00838383, 0x008f8f8f, 0x00aaabab, 0x007b7b7b, 0x00737373, 0x008f8f8f, 0x00ababab, 0x007b7b7b, 0x008f8f8f, 0x00838383, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00ababab, 0x00ababab, 0x007b7b7b, 0x00676767, 0x001f1f1f, 0x003b3b3b, 0x004f4f4f, 0x004b4b4b, 0x00ababab, 0x00d3d3d3, 0x00dfdfdf, 0x009b9b9b, 0x007b7b7b, 0x004b4b4b, 0x004b4b4b, 0x00474747, 0x00535353, 0x00535353, 0x00535353, 0x00474747, 0x00474747, 0x003f3f3f, 0x00474747, 0x00474747, 0x00474747, 0x003f3f3f, 0x00474747, 0x00474747, 0x003f3f3f, 0x00474747, 0x00474747, 0x004f4f4f, 0x00575757, 0x00535353, 0x00535353,
-		0x00474747, 0x00ababab, 0x00c7c7c7, 0x00ababab, 0x00838383, 0x00ababab, 0x007b7b7b, 0x007b7b7b, 0x009b9b9b, 0x00ababab, 0x00838383, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x00828383, 0x007b7b7b, 0x00ababab, 0x007b7b7b, 0x008f8f8f, 0x007b7b7b, 0x009b9a9b, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x00ababab, 0x009b9b9b, 0x00676767, 0x00535353, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x00474747, 0x00dfdfdf, 0x00ababab, 0x00ababab, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00b7b7b7, 0x00535353, 0x00535353, 0x004b4b4b, 0x00b7b7b7, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00d3d3d3, 0x00c7c7c7, 0x00ababab, 0x009a9b9b, 0x007b7b7b, 0x004b4b4b, 0x00474747, 0x00525353,
-		0x00474747, 0x00ababab, 0x00838383, 0x00676767, 0x005f5f5f, 0x00666767, 0x005f5f5f, 0x00676767, 0x005f5f5f, 0x00676767, 0x00676767, 0x005f5f5f, 0x00676767, 0x005f5f5f, 0x00676767, 0x00676767, 0x005f5f5f, 0x00676767, 0x005f5f5f, 0x00676767, 0x005f5f5f, 0x00676767, 0x00676767, 0x005f5f5f, 0x00676767, 0x005f5f5f, 0x00676767, 0x005f5f5f, 0x00676767, 0x005f5f5f, 0x00676767, 0x00575757, 0x00535353, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x00474747, 0x00d3d2d3, 0x00b7b7b7, 0x00ababab, 0x00b7b7b7, 0x00ababab, 0x00b7b7b7, 0x00b7b7b7, 0x00b7b7b7, 0x005f5f5f, 0x00575757, 0x007b7b7b, 0x00dedfdf, 0x009b9b9b, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababaa, 0x009a9b9b, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00d3d3d3, 0x009b9b9b, 0x001f1f1f, 0x00535353,
-		0x00474747, 0x008f8f8f, 0x00676767, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003a3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3a3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3a, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x004b4b4b, 0x00b7b7b7, 0x00ababab, 0x00b7b7b7, 0x00b7b7b7, 0x009b9b9b, 0x005f5f5f, 0x009b9b9b, 0x00838383, 0x00676767, 0x00474747, 0x00b7b7b7, 0x00ababaa, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x00ababab, 0x00ababab, 0x00838383, 0x00ababab, 0x008f8f8f, 0x00ababab, 0x00838383, 0x00ababab, 0x00535253, 0x001f1f1f, 0x00575757,
-		0x00474747, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001e1f1f, 0x004e4f4f, 0x003b3b3b, 0x00474747, 0x003b3b3b, 0x004f4f4f, 0x00676767, 0x005f5f5f, 0x00676767, 0x00676767, 0x005f5f5f, 0x004b4b4b, 0x00dfdfdf, 0x009b9b9b, 0x009b9b9b, 0x009b9b9b, 0x00ababab, 0x00ababab, 0x008f8f8f, 0x009b9b9b, 0x00ababab, 0x009b9b9b, 0x009b9b9b, 0x00ababab, 0x008f8f8f, 0x008f8f8f, 0x004e4f4f, 0x001f1f1f, 0x00575757,
-		0x00535353, 0x004b4b4b, 0x003b3b3a, 0x003b3b3b, 0x003b3b3b, 0x001e1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1e, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003f3f3f, 0x004f4f4f, 0x00575757, 0x003b3b3b, 0x003b3b3b, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x003b3b3b, 0x00535353, 0x00575757, 0x00535353, 0x00535353, 0x00535353, 0x00535352, 0x00535352, 0x00575757, 0x004f4f4f, 0x00535353, 0x00575757, 0x00535353, 0x00575757, 0x004f4f4f, 0x00575757, 0x001f1f1f, 0x00535353,
-		0x00535353, 0x00575757, 0x004f4f4f, 0x00535353, 0x00474747, 0x00474747, 0x00474747, 0x004b4b4b, 0x004b4b4b, 0x00474747, 0x004b4b4b, 0x004b4b4b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3a, 0x003b3a3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3a, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x004f4f4f, 0x00575757, 0x004f4f4f, 0x00535353, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x004f4f4f, 0x00535353, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001e1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x00575657,
-		0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003a3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3a3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003a3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003a3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b};
-	// 'mossy', 64x64px
-	const unsigned int mossy[] = {
-		0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2d2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2d, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002d2c2c, 0x002c2c2c, 0x002d2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002d2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002d2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2d, 0x002c2c2c, 0x002c2c2c, 0x002c2d2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2d, 0x002c2c2c, 0x002c2c2c,
-		0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00dcdcdc, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00dcdcdc, 0x00dcdcdc, 0x00dcdcdd, 0x00dcdcdc, 0x00dcdcdc, 0x00dddcdc, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00dddcdc, 0x00202020, 0x00383838, 0x008c8c8c, 0x00a8a8a8, 0x00dcdcdc, 0x00dcdcdc, 0x00dcdcdc, 0x00dcdcdc, 0x00dcdcdc, 0x00ccc401, 0x00ccc400, 0x00ccc400, 0x00707070, 0x008c8c8c, 0x008c8d8c, 0x00545454, 0x00202020, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00494848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454,
-		0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545455, 0x00545455, 0x00545454, 0x00494848, 0x00dcdcdc, 0x00d0d0d0, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00989898, 0x00a8a8a8, 0x00ccc400, 0x00ccc400, 0x00d0d1d0, 0x00c0c0c0, 0x00c0c0c0, 0x00ccc400, 0x00ccc400, 0x008c8c8c, 0x00202020, 0x00383838, 0x008c8c8c, 0x00c0c0c0, 0x00b4b4b4, 0x008c8c8c, 0x00ccc400, 0x007c7c7c, 0x00ccc400, 0x009c9d00, 0x009c9c00, 0x009c9d00, 0x00706c00, 0x00555454, 0x00545454, 0x00383838, 0x00202020, 0x00383838, 0x00707070, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00484848, 0x00484849, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848,
-		0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8d8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00202020, 0x00545454, 0x00484848, 0x00dcdcdc, 0x00d0d0d0, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00706c00, 0x00989898, 0x00ccc500, 0x00ccc400, 0x009c9c00, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00848400, 0x00b4ac00, 0x00646464, 0x00202020, 0x00383838, 0x00a8a8a8, 0x00dcdcdc, 0x00a8a8a8, 0x008c8c8c, 0x007c7c7c, 0x00ccc400, 0x007c7c7c, 0x00706c00, 0x00848400, 0x00706c00, 0x00545454, 0x007d7c7c, 0x00545454, 0x00383838, 0x00202020, 0x00383838, 0x009c9c00, 0x00ccc400, 0x00e4d800, 0x009c9c00, 0x00706c00, 0x008c8c8c, 0x00b4b4b4, 0x00c0c0c0, 0x00cdc400, 0x00ccc400, 0x00ccc400, 0x00646464, 0x00646464, 0x00cdc400, 0x00ccc400, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c,
-		0x00d0d0d0, 0x00b4b4b4, 0x00b4ac00, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x00202020, 0x00545454, 0x00484848, 0x00dcdcdc, 0x00d0d0d0, 0x009c9c00, 0x009c9c01, 0x00848401, 0x00706c00, 0x00989898, 0x00ccc400, 0x009c9c00, 0x00a8a8a9, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x009c9c00, 0x00545454, 0x00202020, 0x00383838, 0x008c8c8c, 0x00c0c0c0, 0x008c8c8c, 0x008c8c8c, 0x008c8c8d, 0x00a8a8a8, 0x00a8a8a8, 0x00646464, 0x00848400, 0x00706c00, 0x00545454, 0x00707070, 0x00545454, 0x00383838, 0x00202021, 0x00383838, 0x009c9c00, 0x00e4d800, 0x00b4ac00, 0x00706c00, 0x00646564, 0x007c7c7c, 0x00b4b4b4, 0x00dcdcdc, 0x00ccc400, 0x00e4d800, 0x00e4d800, 0x00484848, 0x00646464, 0x00ccc400, 0x00ccc400, 0x00848400, 0x007c7c7c, 0x00d0d0d0, 0x00d0d0d0,
-		0x00a8a8a8, 0x00a8a8a8, 0x00b4ac00, 0x00b4ac00, 0x00545454, 0x00707070, 0x007c7c7c, 0x00707070, 0x00202020, 0x00545454, 0x00484848, 0x00dcdcdc, 0x00c0c0c0, 0x009c9c00, 0x00848400, 0x00706c00, 0x00707070, 0x007c7c7d, 0x00989898, 0x00a8a8a8, 0x00989898, 0x009c9c00, 0x008c8c8c, 0x00707070, 0x008c8c8c, 0x00848400, 0x00545454, 0x00202020, 0x00383838, 0x00484848, 0x00a8a8a8, 0x00ccc400, 0x009c9c00, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x00585400, 0x00545454, 0x00707070, 0x00545454, 0x00545454, 0x00383838, 0x00212020, 0x00383838, 0x009c9c00, 0x00e4d800, 0x00706c00, 0x00646564, 0x008c8c8c, 0x00b4b4b4, 0x00e4d800, 0x00ccc400, 0x007c7c7c, 0x009c9c00, 0x009c9c00, 0x00484848, 0x00646464, 0x009c9c00, 0x00848400, 0x00706c00, 0x00484848, 0x008c8c8c, 0x00989898,
-		0x00b4b4b4, 0x00989898, 0x00706c00, 0x00545454, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00707070, 0x00202021, 0x00484848, 0x00484848, 0x00dcdcdc, 0x00d0d0d0, 0x009c9c00, 0x00706c00, 0x00706c00, 0x007c7c7d, 0x00a8a8a8, 0x00989898, 0x00989898, 0x00989898, 0x009c9c00, 0x008c8c8c, 0x00989898, 0x00707070, 0x008c8c8c, 0x00545454, 0x00202020, 0x00383838, 0x00484848, 0x007c7c7d, 0x009c9c00, 0x00848400, 0x00b4ac00, 0x008c8c8c, 0x00a8a8a8, 0x00a8a8a8, 0x00707070, 0x00646464, 0x00707070, 0x00383838, 0x00383838, 0x00383838, 0x00202020, 0x00383838, 0x00848400, 0x009c9c00, 0x00706c00, 0x00656464, 0x007c7c7c, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x007c7c7c, 0x00706c00, 0x009c9c00, 0x00484848, 0x00707070, 0x00646464, 0x00484848, 0x00484848, 0x00646464, 0x00b5ac00, 0x007c7c7c,
-		0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x00707070, 0x00545454, 0x00202021, 0x00383838, 0x00484848, 0x00dcdcdc, 0x00d0d0d0, 0x008c8c8c, 0x007c7c7c, 0x007c7c7c, 0x00989898, 0x00a8a8a8, 0x00989898, 0x00d0d0d0, 0x007c7c7c, 0x00848400, 0x00989898, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x00545454, 0x00212020, 0x00383838, 0x00484848, 0x00707070, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x00707170, 0x00383838, 0x00383838, 0x00383839, 0x002c2c2c, 0x00383838, 0x00848400, 0x00706c00, 0x00646464, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x00ccc400, 0x007c7c7c, 0x007c7c7c, 0x00706c00, 0x00706c00, 0x00484848, 0x00707070, 0x007c7c7c, 0x008c8c8c, 0x00707070, 0x007c7c7c, 0x00848400, 0x00646464,
-		0x00989898, 0x00a8a8a9, 0x00a8a8a8, 0x00707070, 0x00707070, 0x008c8c8c, 0x00484848, 0x00484848, 0x00202020, 0x002c2c2c, 0x00484848, 0x00dcdcdc, 0x00c0c0c0, 0x00a8a8a8, 0x00989898, 0x007c7c7c, 0x00989898, 0x00ccc400, 0x00999898, 0x00989898, 0x008c8c8c, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8d, 0x00545454, 0x00202020, 0x00202020, 0x00484848, 0x00545454, 0x00707070, 0x00707070, 0x00545454, 0x00555454, 0x00383838, 0x00383838, 0x00383838, 0x00383839, 0x00383838, 0x00383838, 0x00383839, 0x00202020, 0x00383838, 0x00383838, 0x007c7c7c, 0x00646464, 0x008c8c8c, 0x007c7c7c, 0x00a8a8a8, 0x00a8a8a8, 0x007c7c7c, 0x008c8c8c, 0x00a8a8a8, 0x007c7c7c, 0x00484848, 0x00707070, 0x008c8c8c, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x007c7c7c, 0x00646464,
-		0x008c8c8c, 0x008c8c8c, 0x008d8c8c, 0x008c8c8c, 0x00707070, 0x00545454, 0x00484848, 0x00484848, 0x00202020, 0x002c2c2c, 0x00484848, 0x00dcdcdd, 0x00ececec, 0x00a8a8a8, 0x007c7c7c, 0x00989898, 0x007c7c7c, 0x00ccc400, 0x00b4ac00, 0x00707070, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a9, 0x008c8c8c, 0x008d8c8c, 0x00545454, 0x002c2c2c, 0x00202020, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383839, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00202020, 0x00202020, 0x00383838, 0x00383838, 0x00383838, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x008c8c8d, 0x009c9c00, 0x007c7c7c, 0x00989898, 0x007c7c7c, 0x007c7c7c, 0x00989898, 0x00646464, 0x00707070, 0x00989898, 0x008c8c8c, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c,
-		0x00707070, 0x00707070, 0x00707070, 0x00707070, 0x00545454, 0x00484848, 0x00383838, 0x00383838, 0x00202020, 0x002c2c2c, 0x00484848, 0x00dcdcdc, 0x00dcdcdc, 0x008c8c8c, 0x007c7c7c, 0x00989898, 0x00989898, 0x00ccc401, 0x009c9c00, 0x00707070, 0x00a8a8a8, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x00a8a8a9, 0x008c8c8c, 0x00545454, 0x002c2c2c, 0x00202021, 0x00383838, 0x00484848, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202120, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00383938, 0x00383838, 0x00383838, 0x007c7c7c, 0x00b4b4b4, 0x007c7c7c, 0x009c9c01, 0x00484848, 0x008c8c8c, 0x00a8a8a8, 0x00e4d800, 0x007c7c7c, 0x008c8c8c, 0x00707070, 0x008c8c8c, 0x00707070, 0x00999898, 0x00646464, 0x00707070, 0x008c8c8c, 0x00646464, 0x00646464,
-		0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x00484848, 0x00a8a8a8, 0x00dcdcdc, 0x00a8a8a8, 0x00989898, 0x007c7c7c, 0x00ccc400, 0x00b4ac00, 0x009c9c00, 0x00707070, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x008c8c8c, 0x00707070, 0x00646464, 0x00383838, 0x00202020, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00707070, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00dcdcdc, 0x00dcdcdc, 0x00706c00, 0x00383838, 0x00383838, 0x00383938, 0x00707070, 0x00b4b4b4, 0x008c8c8c, 0x007c7c7c, 0x00646464, 0x00646464, 0x007c7c7c, 0x009c9c00, 0x00383838, 0x00545454, 0x00545454, 0x00646464, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848,
-		0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00545454, 0x008c8c8c, 0x00dcdcdc, 0x00d0d0d0, 0x008c8c8c, 0x007c7c7c, 0x008c8c8c, 0x009c9c00, 0x00717070, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x007c7c7c, 0x008c8c8c, 0x009c9c00, 0x008c8c8c, 0x00545454, 0x00383838, 0x00202020, 0x00383838, 0x00484848, 0x00707070, 0x00a8a9a8, 0x00fcf420, 0x00fcf420, 0x00dcdcdc, 0x00dcdcdc, 0x00dcdcdc, 0x00d0d0d0, 0x00d0d0d0, 0x00dcdcdc, 0x00ccc400, 0x00706c00, 0x00383838, 0x00383838, 0x00545454, 0x008c8c8c, 0x00707070, 0x00646464, 0x00646464, 0x00545454, 0x00494848, 0x00585400, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c,
-		0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00545454, 0x00707070, 0x00a8a8a8, 0x00d0d0d0, 0x008c8c8c, 0x00a8a8a9, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x00989898, 0x008c8c8c, 0x00646464, 0x00646464, 0x00545454, 0x00383838, 0x00202020, 0x002c2c2c, 0x00383838, 0x00a8a8a8, 0x00fcf420, 0x00ccc400, 0x009c9c00, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x00a8a8a8, 0x009c9c00, 0x00707070, 0x00585400, 0x00202020, 0x00383938, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020,
-		0x00383838, 0x00383838, 0x00383838, 0x00383839, 0x00383838, 0x00383838, 0x00383838, 0x00393838, 0x00383838, 0x00383838, 0x00545454, 0x00484848, 0x008c8c8c, 0x00d0d0d0, 0x00a8a8a9, 0x008c8c8c, 0x00a8a8a8, 0x00989898, 0x00707070, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x008c8c8c, 0x00a8a8a8, 0x00848400, 0x00545454, 0x00545455, 0x00383838, 0x00202020, 0x002c2c2c, 0x00484848, 0x00a8a8a8, 0x00ccc400, 0x00848400, 0x007c7c7c, 0x00a8a8a8, 0x008c8c8c, 0x00e4d800, 0x00e4d800, 0x008c8c8c, 0x009c9c00, 0x00545454, 0x00706c00, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002d2c2c, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00393838, 0x00383838, 0x00383838,
-		0x00545454, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00545454, 0x00484848, 0x00707070, 0x00c0c0c0, 0x008c8c8c, 0x00a8a8a8, 0x00989898, 0x00ccc400, 0x009c9c01, 0x00707070, 0x00a9a8a8, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x00706c00, 0x00545454, 0x00707070, 0x00484848, 0x00202020, 0x002c2c2c, 0x00484848, 0x00a8a8a8, 0x00e4d800, 0x00848400, 0x007c7c7c, 0x008c8c8c, 0x00ccc400, 0x00e4d800, 0x007c7c7c, 0x008c8c8c, 0x00848400, 0x00545454, 0x00585400, 0x00383839, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00202020, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484849, 0x00484848, 0x00484848, 0x00484848, 0x00484848,
-		0x00989898, 0x00989898, 0x00999898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x002c2c2c, 0x00202020, 0x00555454, 0x00484849, 0x00c0c0c0, 0x00c0c0c0, 0x00848401, 0x008c8c8c, 0x009c9c00, 0x00848400, 0x00a8a8a8, 0x00707070, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00707070, 0x00646464, 0x00545454, 0x00545454, 0x00202020, 0x00202020, 0x00484848, 0x00e4d800, 0x00e4d800, 0x007c7c7c, 0x007c7c7c, 0x00a8a8a8, 0x00e4d800, 0x00e5d800, 0x00707070, 0x008c8c8c, 0x00706c00, 0x00545454, 0x00383838, 0x00383838, 0x00484848, 0x00e4d800, 0x00b4ad00, 0x00b4ac00, 0x00646464, 0x00545454, 0x00484848, 0x00545554, 0x007c7c7c, 0x00989898, 0x00989898, 0x00989898, 0x00999898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898, 0x00989898,
-		0x00d0d0d1, 0x00ccc400, 0x00b4ac00, 0x00dcdcdc, 0x00dcdcdc, 0x00ccc400, 0x009c9c00, 0x00707070, 0x00707070, 0x00383838, 0x00202020, 0x00545454, 0x00494848, 0x008c8c8c, 0x00c0c0c0, 0x00706c00, 0x00646464, 0x00989898, 0x00646464, 0x008c8d8c, 0x00707070, 0x00707070, 0x00a8a8a8, 0x008c8c8c, 0x00707070, 0x008c8c8c, 0x00707070, 0x00484848, 0x00202020, 0x00202020, 0x00484848, 0x00e4d800, 0x007c7c7c, 0x008c8c8c, 0x007c7c7c, 0x008c8c8c, 0x009c9c00, 0x00706c00, 0x00646564, 0x00a8a8a8, 0x008c8c8c, 0x00545454, 0x00383838, 0x00383838, 0x00383838, 0x00b4ac00, 0x00b4ac00, 0x00848400, 0x00646464, 0x002c2c2c, 0x00484848, 0x007c7c7c, 0x00c0c0c0, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00dcdcdc, 0x00b4ac00, 0x00a8a8a8, 0x00a8a8a8, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00dcdcdc,
-		0x00ccc400, 0x00b4ac00, 0x00848400, 0x00b4ac00, 0x00b4ac00, 0x009c9c00, 0x00706c00, 0x00545454, 0x00707070, 0x00383839, 0x00202020, 0x00545454, 0x00484848, 0x00707070, 0x00989898, 0x00646464, 0x00646464, 0x008c8c8c, 0x008c8c8c, 0x00707070, 0x008c8c8c, 0x00545454, 0x008c8d8c, 0x00707070, 0x00545454, 0x00707070, 0x00545454, 0x00484848, 0x00202020, 0x00202020, 0x00484848, 0x007c7c7c, 0x008c8c8c, 0x007c7c7c, 0x008c8c8c, 0x00e4d800, 0x00646464, 0x00646464, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x00383838, 0x00202020, 0x00383838, 0x009c9c00, 0x00848400, 0x00545454, 0x00646464, 0x00202020, 0x00484849, 0x00989898, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x007c7c7c, 0x00e4d800, 0x009c9c00, 0x007c7c7c, 0x00a8a8a8, 0x00ccc400, 0x009c9c00, 0x00848400, 0x00707070,
-		0x00b4ac00, 0x00848400, 0x00a8a8a8, 0x00b4ac00, 0x009c9c01, 0x00848400, 0x00706d00, 0x00545454, 0x00707070, 0x00383838, 0x00202020, 0x00484848, 0x00545454, 0x00484848, 0x00989898, 0x00989898, 0x00707070, 0x008c8c8c, 0x00646464, 0x00707070, 0x00707070, 0x00707070, 0x00707070, 0x00545454, 0x00717070, 0x00545454, 0x00484848, 0x002c2c2d, 0x00202020, 0x00202020, 0x002c2c2c, 0x00a8a8a8, 0x008c8c8c, 0x00707070, 0x008c8c8c, 0x00717070, 0x00545454, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00202020, 0x00646464, 0x009c9c00, 0x00848400, 0x00707070, 0x00545454, 0x00202020, 0x00484848, 0x00989898, 0x00ccc400, 0x00ccc400, 0x007c7c7c, 0x00989898, 0x009c9c00, 0x009c9c00, 0x007c7c7c, 0x00989898, 0x00ccc400, 0x009c9c00, 0x00848400, 0x00707070,
-		0x00848400, 0x00a8a8a8, 0x008c8c8c, 0x00b5ac01, 0x009c9c00, 0x00706c00, 0x00706c00, 0x00545454, 0x00545454, 0x00383838, 0x00202020, 0x00484848, 0x00545454, 0x00484848, 0x00646464, 0x00545454, 0x00545455, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00212020, 0x002c2c2c, 0x008c8c8c, 0x00707070, 0x00383838, 0x00393838, 0x00383838, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00646464, 0x008c8c8c, 0x00848400, 0x008c8c8c, 0x00545454, 0x00202021, 0x00484848, 0x00989898, 0x00a8a8a8, 0x007c7c7c, 0x008c8c8d, 0x00989898, 0x009c9c00, 0x007c7c7c, 0x007c7c7c, 0x00a8a8a8, 0x00ccc400, 0x009c9c00, 0x00848400, 0x00989898,
-		0x00a9a8a8, 0x008c8c8c, 0x00a8a8a8, 0x00b4ac00, 0x00706c00, 0x00545454, 0x00545454, 0x008c8c8c, 0x00545454, 0x00383838, 0x00202020, 0x00484848, 0x00545454, 0x00484848, 0x002c2c2c, 0x002c2c2c, 0x002c2d2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x00383838, 0x00545454, 0x00383838, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2d, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x00a8a8a8, 0x00545454, 0x00202020, 0x00484848, 0x008c8c8c, 0x00a8a8a8, 0x00989898, 0x00a8a8a8, 0x00989898, 0x00a8a8a8, 0x007c7c7c, 0x00a8a8a8, 0x007c7c7c, 0x00a8a8a8, 0x009c9c00, 0x00706c00, 0x00707070,
-		0x008c8d8c, 0x00a8a8a8, 0x007c7c7c, 0x007c7c7c, 0x00545454, 0x00717070, 0x008c8c8c, 0x00707070, 0x00545454, 0x00383838, 0x00202020, 0x00383838, 0x00545454, 0x00545454, 0x00484848, 0x00383838, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202021, 0x00202020, 0x00202020, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x008c8c8c, 0x008c8c8d, 0x00989898, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009d9c00, 0x009c9c00, 0x007c7c7c, 0x00545454, 0x002c2c2c, 0x00383838, 0x00646464, 0x00c0c0c0, 0x00dddcdc, 0x00a8a8a8, 0x00c0c0c0, 0x00646464, 0x00202020, 0x00484848, 0x008c8c8c, 0x008c8c8c, 0x00a8a9a8, 0x00e4d800, 0x00989898, 0x008c8c8c, 0x00a8a8a8, 0x00989898, 0x00a8a8a8, 0x00a8a8a8, 0x007c7c7c, 0x007c7c7c, 0x00989898,
-		0x008c8c8c, 0x00ccc400, 0x009c9c01, 0x007c7c7c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00646464, 0x00484848, 0x00383838, 0x00202020, 0x00383838, 0x008c8c8c, 0x00ccc400, 0x00ccc400, 0x00b4ac00, 0x009c9c01, 0x008c8c8c, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00646464, 0x00383838, 0x00484848, 0x00646465, 0x009c9c00, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00b4ac00, 0x00d0d0d0, 0x00ececec, 0x00ececec, 0x00ececec, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00b4ac00, 0x009c9c00, 0x00848400, 0x00202020, 0x00383838, 0x007c7c7c, 0x00dcdcdc, 0x00c0c0c0, 0x00dcdcdc, 0x00a8a8a8, 0x00707070, 0x00202020, 0x00484848, 0x007c7c7c, 0x00989898, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x00a8a8a8, 0x00989898, 0x00e4d800, 0x00989898, 0x007c7c7c, 0x00a8a8a8, 0x00989898, 0x00a9a8a8,
-		0x008c8c8c, 0x009c9c00, 0x00858400, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00646464, 0x00484848, 0x00383838, 0x00202020, 0x00383838, 0x00ccc400, 0x00b4ac00, 0x00b4ac00, 0x009c9c00, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007d7c7c, 0x00383838, 0x00545454, 0x00484848, 0x009c9c00, 0x00ccc400, 0x00b4ac00, 0x00707070, 0x00989898, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x00a8a8a8, 0x00999898, 0x009c9c00, 0x007c7c7c, 0x009c9c01, 0x00848400, 0x009c9c00, 0x00848400, 0x00706c00, 0x00202020, 0x00383938, 0x008c8c8c, 0x00dcdcdc, 0x00a8a8a8, 0x00a8a8a8, 0x00c0c0c0, 0x00e4d800, 0x00202020, 0x00484848, 0x00e4d800, 0x00a8a8a8, 0x00989898, 0x00a8a8a8, 0x00999898, 0x00e4d800, 0x00e4d800, 0x007c7c7c, 0x00a8a8a8, 0x00989898, 0x00989898, 0x00a8a8a8, 0x00989898,
-		0x00989899, 0x00848400, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00707070, 0x00545454, 0x00383838, 0x00383838, 0x00202020, 0x00383838, 0x00b4ac00, 0x009c9c00, 0x00848400, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00212020, 0x00545454, 0x00484848, 0x00989898, 0x00ececec, 0x00989898, 0x00989898, 0x009c9c00, 0x00989898, 0x00ccc400, 0x00a8a8a8, 0x00989898, 0x00989898, 0x007c7c7c, 0x00a8a8a8, 0x00848400, 0x007c7c7c, 0x009c9c00, 0x00706c00, 0x00585400, 0x00202020, 0x00383838, 0x008c8c8c, 0x00e4d800, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x009c9c00, 0x00202020, 0x00484848, 0x009c9c00, 0x00585400, 0x00707070, 0x00646464, 0x00e4d800, 0x00b4ac00, 0x00848400, 0x00706d00, 0x00585400, 0x00707070, 0x00707070, 0x00545454, 0x00707170,
-		0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00545454, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00202020, 0x00383838, 0x00b4ac00, 0x00848400, 0x00646464, 0x00646464, 0x00989998, 0x00848400, 0x009c9c00, 0x00706c00, 0x00646464, 0x00202020, 0x00494848, 0x00484848, 0x00989898, 0x00ececec, 0x00e4d800, 0x00a8a8a8, 0x00989898, 0x00ccc400, 0x00848400, 0x00989898, 0x00ccc400, 0x00ccc400, 0x00a9a8a8, 0x00989898, 0x00848400, 0x00a8a8a8, 0x00848400, 0x00646464, 0x00585400, 0x00202020, 0x00383838, 0x008c8c8c, 0x00b4ac00, 0x00707070, 0x008c8c8c, 0x00a8a8a8, 0x00706c00, 0x00202020, 0x00484848, 0x00585400, 0x00383838, 0x00383838, 0x00494848, 0x00585400, 0x00585400, 0x00585400, 0x00585400, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454,
-		0x00545454, 0x00484848, 0x00484948, 0x00383838, 0x00383838, 0x00383838, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x00383838, 0x00b4ac00, 0x00848400, 0x00646464, 0x00989898, 0x00989898, 0x007c7c7c, 0x00848400, 0x00706c00, 0x00646564, 0x00202020, 0x00484848, 0x00484848, 0x00989898, 0x00ececec, 0x00ccc400, 0x00a8a8a8, 0x00ccc400, 0x009c9c00, 0x007c7c7c, 0x00989898, 0x00ccc400, 0x00848400, 0x00989898, 0x00a8a8a8, 0x00989898, 0x00989898, 0x007c7c7c, 0x00646464, 0x00404000, 0x00202020, 0x00383838, 0x008c8d8c, 0x00707070, 0x008c8c8c, 0x00a8a8a8, 0x00dcdcdc, 0x00585400, 0x00202020, 0x00484848, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00383838, 0x00383838, 0x00484848,
-		0x00202120, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2d, 0x002c2c2c, 0x00484848, 0x00484848, 0x00484848, 0x00ececec, 0x00646464, 0x00999898, 0x00a8a8a8, 0x00848400, 0x008c8c8c, 0x00848400, 0x00706c00, 0x00646464, 0x00202020, 0x00383838, 0x00484848, 0x00989898, 0x00ececec, 0x00b4ac00, 0x00989898, 0x00ccc400, 0x00706c00, 0x007c7c7c, 0x00a8a8a8, 0x00989898, 0x00a8a8a8, 0x00989898, 0x007c7d7c, 0x00b4ac00, 0x00848400, 0x007c7c7c, 0x00646464, 0x00404000, 0x00202020, 0x00383838, 0x00e4d800, 0x00ececec, 0x00a8a8a8, 0x00dcdcdc, 0x00a8a8a8, 0x00545454, 0x00202020, 0x00484848, 0x00383838, 0x00393838, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020,
-		0x00484848, 0x00656464, 0x00646465, 0x00707070, 0x008c8c8c, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00484848, 0x00202020, 0x00ececec, 0x00989898, 0x00989898, 0x00a8a8a8, 0x00848400, 0x008c8c8c, 0x00646464, 0x007c7c7c, 0x00646464, 0x00404000, 0x00202020, 0x00484848, 0x00989898, 0x00ececec, 0x00b4ac00, 0x00a8a8a8, 0x009c9c00, 0x00706c00, 0x007c7c7c, 0x00989898, 0x007c7c7c, 0x00989898, 0x00a9a8a8, 0x00989898, 0x00b4ac00, 0x00848400, 0x007c7c7c, 0x00545454, 0x00404000, 0x00202020, 0x00383838, 0x00b4ac00, 0x00ececec, 0x00c0c0c0, 0x00c0c0c0, 0x00a8a8a8, 0x00545454, 0x00202020, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00393838, 0x00383838, 0x00383838, 0x00383838, 0x00383838,
-		0x00646564, 0x008c8c8c, 0x00b4b4b4, 0x00b4ac00, 0x00b4ac00, 0x008c8c8c, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00646464, 0x00202020, 0x00ececec, 0x00a8a8a8, 0x00d0d0d0, 0x008c8c8c, 0x00706c00, 0x00a8a8a8, 0x008c8c8c, 0x007c7c7c, 0x00646464, 0x00404000, 0x00202020, 0x00484848, 0x00989898, 0x00ececec, 0x00a8a8a8, 0x00ccc400, 0x009c9c00, 0x00706d00, 0x007c7c7c, 0x00989898, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x00a8a8a8, 0x00b5ac00, 0x00848400, 0x008c8c8c, 0x00545454, 0x00404000, 0x00202020, 0x00706c00, 0x009c9c00, 0x00dcdcdc, 0x00a8a8a8, 0x00a8a8a8, 0x00b4ac00, 0x00545454, 0x00202020, 0x00484848, 0x00706c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x00b4ad00, 0x00b4ac00, 0x00848400, 0x00848400, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454,
-		0x00646464, 0x00b4b4b4, 0x00b4ac00, 0x00b4ac00, 0x00848400, 0x00646464, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00484848, 0x00202020, 0x00ecedec, 0x00a8a8a8, 0x00989898, 0x00a8a8a8, 0x007c7c7d, 0x008c8c8c, 0x007c7c7c, 0x008c8c8c, 0x00646464, 0x00404000, 0x00202120, 0x00484848, 0x007c7c7c, 0x00989898, 0x00ccc400, 0x009c9c00, 0x00706c00, 0x00707070, 0x007c7c7c, 0x00a8a8a8, 0x00989898, 0x00989898, 0x007c7c7c, 0x00989898, 0x00b5ac00, 0x00848400, 0x00646464, 0x00545454, 0x00404000, 0x00202020, 0x00383838, 0x009c9c00, 0x00dcdcdc, 0x00dcdcdc, 0x00b4ac00, 0x009c9c00, 0x00545454, 0x00202020, 0x00484848, 0x00707070, 0x009c9c00, 0x00706c00, 0x009c9c00, 0x009c9c01, 0x009c9c00, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00848400, 0x00989898, 0x00383839, 0x00545454,
-		0x00646464, 0x00b5ac00, 0x009c9c00, 0x00848400, 0x00646464, 0x008c8c8c, 0x00a8a8a9, 0x00b4ac00, 0x00b4ac00, 0x00707070, 0x00646464, 0x00202020, 0x00ececec, 0x00d0d0d0, 0x00a8a8a8, 0x00989898, 0x00a8a8a8, 0x00848400, 0x008c8c8c, 0x00a8a8a8, 0x00646464, 0x00404000, 0x00202020, 0x00383938, 0x00545454, 0x00989899, 0x009c9c00, 0x00706c00, 0x007c7c7c, 0x007c7c7c, 0x008c8d8c, 0x00989898, 0x00a8a8a8, 0x007c7c7c, 0x00989898, 0x007c7c7c, 0x00b4ac00, 0x00848400, 0x00707070, 0x00484848, 0x00383838, 0x00202020, 0x00383838, 0x009c9c00, 0x00dcdcdc, 0x00a8a8a9, 0x00b4ac00, 0x00706c00, 0x00545454, 0x00202020, 0x00484848, 0x00989898, 0x00707070, 0x00707070, 0x009c9c00, 0x009c9c00, 0x00848400, 0x00848400, 0x00706c00, 0x00706c00, 0x00706c00, 0x007c7c7c, 0x00383838, 0x00545454,
-		0x00646464, 0x00b4ac00, 0x009c9c00, 0x00707070, 0x00707070, 0x00a8a8a8, 0x00707070, 0x00b4ac00, 0x00848400, 0x00707070, 0x00646465, 0x00202020, 0x00ececec, 0x00989898, 0x008c8c8c, 0x00989898, 0x00a8a8a8, 0x008c8c8c, 0x008c8d8c, 0x007c7c7c, 0x00656464, 0x00404000, 0x00202020, 0x002c2c2c, 0x00545454, 0x00a8a8a8, 0x00ececec, 0x00a8a8a8, 0x00ccc400, 0x00ccc400, 0x009c9c00, 0x008c8c8c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00b4ac00, 0x00848400, 0x00646464, 0x00494848, 0x002c2c2c, 0x00202020, 0x00706c00, 0x008c8c8c, 0x00d0d0d0, 0x00c0c0c0, 0x00b4ac00, 0x00585400, 0x00555454, 0x00202020, 0x00484848, 0x00dcdcdc, 0x00a8a8a8, 0x00a8a8a8, 0x009c9c00, 0x00706c00, 0x00707070, 0x00707070, 0x00585400, 0x00646464, 0x00707070, 0x00646464, 0x00383838, 0x00484848,
-		0x00646464, 0x00707070, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x00707070, 0x008c8c8c, 0x00b4ad00, 0x00706c00, 0x00707070, 0x00545454, 0x00202020, 0x00dcdcdc, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00989899, 0x00a8a8a8, 0x00a8a8a8, 0x007c7c7c, 0x00646464, 0x00404000, 0x00202020, 0x002c2c2c, 0x00545454, 0x008c8c8c, 0x00ececec, 0x00c0c0c0, 0x00ccc400, 0x00848400, 0x00706c00, 0x007c7c7c, 0x00989898, 0x00989898, 0x008c8c8c, 0x00a8a8a8, 0x009c9c00, 0x00848400, 0x00646464, 0x00484848, 0x00202020, 0x00202020, 0x009c9c00, 0x008c8c8c, 0x00d0d0d0, 0x00a8a8a8, 0x00848400, 0x00706c00, 0x00404000, 0x00202020, 0x00484848, 0x00d0d0d0, 0x00a8a8a8, 0x008c8c8c, 0x009c9c00, 0x00706c00, 0x008c8c8c, 0x007c7c7c, 0x00989898, 0x00646464, 0x00989898, 0x00646464, 0x00383838, 0x00484848,
-		0x00646464, 0x00a8a8a8, 0x00a8a8a8, 0x008c8c8c, 0x00a8a8a8, 0x00a8a8a8, 0x00b4ac00, 0x009c9c00, 0x00706c00, 0x00707070, 0x00545454, 0x00202020, 0x00dcdddc, 0x00c0c0c0, 0x007c7c7c, 0x00989898, 0x00ccc400, 0x00b4ac00, 0x007c7c7c, 0x008c8c8c, 0x00646464, 0x00404000, 0x00202020, 0x00202020, 0x00494848, 0x00707070, 0x00d0d0d0, 0x00c0c0c0, 0x00848400, 0x00706c00, 0x00646464, 0x007d7c7c, 0x008c8c8c, 0x00a8a8a8, 0x00989898, 0x00b4ac00, 0x009c9d00, 0x00646464, 0x00646464, 0x00383838, 0x00202020, 0x00202020, 0x00484848, 0x008c8c8c, 0x00d0d0d0, 0x008c8c8c, 0x00706c00, 0x00585400, 0x00404000, 0x00202020, 0x00484848, 0x00c0c0c0, 0x00a8a8a8, 0x00a8a8a8, 0x009c9c00, 0x00706c00, 0x007c7c7c, 0x008c8c8c, 0x00989898, 0x00989898, 0x00a8a8a8, 0x00545454, 0x00383838, 0x00484848,
-		0x00646465, 0x00dcdcdc, 0x00989898, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x00848400, 0x00706c00, 0x00706c00, 0x00707070, 0x00545454, 0x00202020, 0x00c0c0c1, 0x00dcdcdc, 0x008c8c8c, 0x00989898, 0x00b4ac00, 0x00848400, 0x008c8c8c, 0x00a8a8a8, 0x00646464, 0x00404000, 0x00404000, 0x00202020, 0x00484848, 0x00545454, 0x00b4b4b4, 0x00dcdcdc, 0x00706c00, 0x00646464, 0x007c7c7c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x00848400, 0x00646464, 0x00646464, 0x00646464, 0x00707070, 0x00383838, 0x00202020, 0x00383838, 0x00484848, 0x007c7c7c, 0x00a8a8a8, 0x007c7c7c, 0x00706c00, 0x00404000, 0x00585400, 0x00383838, 0x00484848, 0x00a8a8a8, 0x00a8a8a8, 0x008c8c8c, 0x009c9c00, 0x00848400, 0x00707070, 0x00989898, 0x007c7c7c, 0x00707070, 0x00989898, 0x00545454, 0x00383838, 0x00383838,
-		0x00646464, 0x00dcdcdc, 0x00a8a8a8, 0x00a8a8a8, 0x008c8c8c, 0x00989898, 0x00706c00, 0x00706c00, 0x00707070, 0x00707070, 0x00545454, 0x00202020, 0x00b4b4b4, 0x00dcdcdc, 0x007c7c7c, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00646464, 0x00404100, 0x00404000, 0x00202020, 0x00383838, 0x00545454, 0x008c8c8c, 0x00c0c0c0, 0x00989898, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00707070, 0x00707070, 0x00646464, 0x00646464, 0x00707070, 0x00707070, 0x00545454, 0x00383838, 0x00202020, 0x00383838, 0x00484848, 0x00545454, 0x00383838, 0x00383838, 0x00585400, 0x00585400, 0x00383838, 0x00383838, 0x00484848, 0x00707070, 0x00545454, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00383838, 0x00383838,
-		0x00646465, 0x00dcdcdc, 0x00b4b4b4, 0x008c8c8c, 0x00b4ac00, 0x00848400, 0x008c8c8c, 0x00707070, 0x008c8c8c, 0x00989898, 0x00545454, 0x00202020, 0x00989898, 0x00dcdcdc, 0x00a8a8a8, 0x007c7c7c, 0x00a8a8a8, 0x00a8a8a8, 0x007c7c7c, 0x008c8c8c, 0x00646464, 0x00545454, 0x00404000, 0x00202020, 0x00383838, 0x00545454, 0x00484848, 0x008c8c8c, 0x008c8c8c, 0x00707070, 0x00707070, 0x00545454, 0x00545454, 0x00484848, 0x00202020, 0x00404000, 0x00484848, 0x00545454, 0x00484848, 0x00202020, 0x00202020, 0x00383838, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00484948, 0x00484848, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00383838,
-		0x00646464, 0x00dddcdc, 0x00b4b4b4, 0x00a8a9a8, 0x008c8c8c, 0x00989898, 0x008c8c8c, 0x00b4ad00, 0x009c9c00, 0x00707070, 0x00545454, 0x00202020, 0x007c7c7c, 0x00dcdcdc, 0x00989898, 0x00989898, 0x00a8a9a8, 0x008c8c8c, 0x00646464, 0x008c8c8c, 0x007c7c7c, 0x00545454, 0x00404000, 0x00202020, 0x002c2c2c, 0x00484848, 0x00484848, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383938, 0x00383838, 0x00383838,
-		0x00646464, 0x00dcdcdc, 0x00b4ac00, 0x00b4ac00, 0x00989898, 0x008d8c8c, 0x00b5ac00, 0x009c9c00, 0x00848400, 0x00707070, 0x00545454, 0x00202021, 0x00545454, 0x00ececec, 0x00a8a8a8, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x007c7c7c, 0x00545454, 0x00585400, 0x00202020, 0x002c2c2c, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383938, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00646464, 0x00646464, 0x00646464, 0x00707070, 0x00707070, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00848400, 0x00848400, 0x00848400, 0x00848400, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007d7c7c, 0x007c7c7c, 0x007c7c7c, 0x00383838, 0x00545454,
-		0x00646464, 0x00b4ac00, 0x00b4ac00, 0x00848400, 0x00a8a8a8, 0x00989898, 0x009c9c00, 0x00706c00, 0x00706c00, 0x00656464, 0x00545454, 0x00202020, 0x00484848, 0x00ececec, 0x00989898, 0x008c8c8c, 0x009c9c00, 0x007c7c7c, 0x008c8c8c, 0x007c7c7c, 0x007c7c7c, 0x00545454, 0x00585400, 0x00202020, 0x002c2d2c, 0x00383838, 0x00646464, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x00848400, 0x007c7c7c, 0x007c7c7c, 0x008c8c8c, 0x00989898, 0x00989898, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00b4b4b4, 0x00b4b4b4, 0x00ccc400, 0x00ccc400, 0x00cdc400, 0x00b4ac00, 0x00848400, 0x00c0c0c0, 0x00c0c0c0, 0x00e4d800, 0x00b4ac00, 0x00c0c0c0, 0x00ccc400, 0x00b4ac00, 0x00848400, 0x00c0c0c0, 0x007c7c7c, 0x00383938, 0x00545454,
-		0x00646464, 0x00b5ad00, 0x00848400, 0x007c7c7c, 0x00989898, 0x00989898, 0x008c8c8c, 0x00706c00, 0x00706d00, 0x00646464, 0x00202020, 0x002c2c2c, 0x00484848, 0x00ececec, 0x00a9a8a8, 0x008c8c8c, 0x00848400, 0x00646464, 0x00a8a8a8, 0x008c8c8c, 0x00646464, 0x00545454, 0x00585400, 0x00202020, 0x00202020, 0x00383838, 0x00706c00, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00ccc401, 0x00ccc400, 0x00ccc400, 0x009c9c00, 0x00a8a8a8, 0x00c0c0c0, 0x00a8a8a8, 0x00c0c0c0, 0x00989898, 0x00c0c0c0, 0x00a8a8a8, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ccc400, 0x00b4ac00, 0x00848400, 0x00848400, 0x00848400, 0x00b4b4b4, 0x00b4b4b4, 0x00e4d800, 0x00b4ac00, 0x00c0c0c0, 0x00c0c0c0, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00848400, 0x00646464, 0x002c2c2c, 0x00484848,
-		0x00646465, 0x00b4ac00, 0x00848400, 0x007c7c7c, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00545454, 0x00202020, 0x002c2c2c, 0x00484848, 0x00ececec, 0x008c8c8c, 0x00a8a8a8, 0x00646464, 0x00646464, 0x008c8c8c, 0x008c8c8c, 0x00646464, 0x00545454, 0x00585400, 0x00202020, 0x00202020, 0x00383838, 0x00706c01, 0x00ccc400, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00848400, 0x00a8a8a8, 0x00c0c0c0, 0x00a8a8a8, 0x00a8a8a8, 0x00c0c1c0, 0x00ccc400, 0x009c9c00, 0x00989898, 0x00a8a8a8, 0x00989898, 0x00b4ac00, 0x00848400, 0x00a8a8a8, 0x00989898, 0x00ccc400, 0x00ccc400, 0x00b4ac00, 0x007c7c7c, 0x008c8c8c, 0x00c0c0c0, 0x00b4ac00, 0x009c9c00, 0x00b4ac00, 0x00848400, 0x007c7c7c, 0x00545454, 0x002c2c2c, 0x00484948,
-		0x00646464, 0x00b4ac00, 0x00848400, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x00545454, 0x00202020, 0x00383838, 0x00484848, 0x00dcdcdc, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x008c8c8c, 0x00a8a8a8, 0x00646464, 0x00545554, 0x00404000, 0x00202020, 0x00202020, 0x00383838, 0x002c2c2c, 0x00b4ac00, 0x00b4ac00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x00848400, 0x00706c00, 0x008c8c8c, 0x00c0c0c0, 0x00a8a8a8, 0x00a8a8a8, 0x009c9c00, 0x009d9c00, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x00c0c0c0, 0x00989898, 0x00a8a8a8, 0x00ccc400, 0x00b4ac00, 0x00b4ac00, 0x007c7c7c, 0x008c8c8c, 0x00989898, 0x00a8a8a8, 0x00707070, 0x00707070, 0x00b4ac00, 0x00707070, 0x00707071, 0x00545454, 0x002c2c2c, 0x00383838,
-		0x00484848, 0x00848400, 0x007c7c7c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x00646464, 0x00545454, 0x00202020, 0x00393838, 0x00484848, 0x00d0d0d0, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00646464, 0x00545454, 0x00383838, 0x00202020, 0x00202020, 0x00383838, 0x002c2c2c, 0x008d8c8c, 0x008c8c8c, 0x008c8c8c, 0x009c9c00, 0x00848400, 0x009c9c00, 0x00848400, 0x00848400, 0x00706c00, 0x00706c00, 0x00707070, 0x00a8a8a8, 0x00c0c1c0, 0x00a8a8a8, 0x008c8c8c, 0x007c7d7c, 0x00989898, 0x00c0c0c0, 0x00989898, 0x00989899, 0x00a8a8a8, 0x00ccc400, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00989898, 0x00a8a8a9, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x00b4ac00, 0x00707070, 0x00707070, 0x00545454, 0x002c2c2c, 0x00383838,
-		0x00484849, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x00646464, 0x00545454, 0x00545454, 0x00202020, 0x002c2c2c, 0x00383838, 0x00484848, 0x00b4b4b4, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x007c7c7c, 0x00646464, 0x00545454, 0x00383838, 0x00202020, 0x00202020, 0x00383838, 0x002c2c2c, 0x00c0c0c0, 0x00dcdcdc, 0x00c0c0c0, 0x009c9c00, 0x00706c00, 0x00706c00, 0x00706c00, 0x00706c00, 0x00707070, 0x00707070, 0x008c8c8c, 0x00a8a8a8, 0x00c0c0c0, 0x008c8c8c, 0x00b4b4b4, 0x008c8c8c, 0x00989898, 0x00989898, 0x00ccc400, 0x00ccc400, 0x00989998, 0x008c8c8c, 0x007c7c7d, 0x00707070, 0x008c8c8c, 0x008c8c8c, 0x00e4d800, 0x00b4ac00, 0x00b4b4b4, 0x00a8a8a8, 0x008c8c8c, 0x00b4ac00, 0x00707070, 0x00707070, 0x00545454, 0x002c2c2c, 0x00383838,
-		0x00484848, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00202020, 0x002c2c2c, 0x00383838, 0x00484848, 0x00989898, 0x00989898, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00707070, 0x00646464, 0x00545454, 0x00383838, 0x00202020, 0x00202020, 0x00383838, 0x002c2c2c, 0x00b5b4b4, 0x00dcdcdc, 0x00d0d0d0, 0x00848400, 0x00707070, 0x00707070, 0x00707070, 0x00707070, 0x007c7c7c, 0x00989898, 0x008c8c8c, 0x009c9d00, 0x00a9a8a8, 0x00b4b4b4, 0x00a8a8a8, 0x008c8c8c, 0x00b4b4b4, 0x00ccc400, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x00989898, 0x00b4b4b4, 0x00b4ac00, 0x00848400, 0x00a8a8a8, 0x00989898, 0x00989898, 0x00707070, 0x00707070, 0x00707070, 0x00545454, 0x00202020, 0x00383938,
-		0x00484848, 0x00393838, 0x00202020, 0x00545454, 0x00545454, 0x00555454, 0x00555454, 0x00545454, 0x00545454, 0x00202020, 0x00383838, 0x00484848, 0x00484848, 0x007c7c7c, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00545454, 0x00555454, 0x00383838, 0x00202020, 0x00202020, 0x00383838, 0x002c2c2c, 0x00a8a8a8, 0x00dcdddc, 0x00d0d0d0, 0x00707070, 0x007c7c7c, 0x008c8c8c, 0x008c8c8c, 0x00b4ac00, 0x00b4ac00, 0x00848400, 0x00b4b4b4, 0x008c8c8c, 0x008c8c8c, 0x00b4b4b4, 0x00989898, 0x00a8a8a8, 0x00b4b4b4, 0x00a8a8a8, 0x008c8c8c, 0x00b4ac00, 0x00a8a8a8, 0x00b4ac00, 0x00a8a8a8, 0x00989898, 0x00b4b4b4, 0x00b4ac00, 0x00848400, 0x00989898, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x00b4ac00, 0x00b4ac00, 0x00707070, 0x00545454, 0x00202020, 0x00383838,
-		0x00545454, 0x00545454, 0x00545454, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00202120, 0x002c2c2c, 0x00383838, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x008c8c8c, 0x00d0d0d0, 0x00b4b4b4, 0x008c8c8c, 0x00b4b4b4, 0x00989898, 0x00b4b4b4, 0x00b4ac00, 0x00b4ac00, 0x00706c00, 0x008c8c8c, 0x00b4b4b4, 0x008c8c8c, 0x00b4b4b4, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x00e4d800, 0x00b4ac00, 0x00706c00, 0x00989898, 0x00a8a8a8, 0x00c0c0c0, 0x00989998, 0x00a8a8a8, 0x00989898, 0x00989898, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x00b4b4b4, 0x007c7c7c, 0x00707070, 0x00545454, 0x00202020, 0x00383838,
-		0x00484948, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00484848, 0x00383838, 0x00383838, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x008c8c8c, 0x00989898, 0x00707070, 0x00707070, 0x00707070, 0x00707070, 0x00707070, 0x00848400, 0x00706c00, 0x00706c00, 0x008c8c8c, 0x00a8a8a8, 0x00707070, 0x007c7c7c, 0x008c8c8c, 0x00b4b4b4, 0x00e4d800, 0x00b4ac00, 0x00706c00, 0x00a8a8a8, 0x008c8c8c, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x00b4b4b4, 0x007c7c7c, 0x008c8c8c, 0x008c8c8c, 0x00ccc400, 0x00989898, 0x008c8c8c, 0x00989898, 0x00707070, 0x00545454, 0x00202020, 0x00383838,
-		0x00484848, 0x007c7c7c, 0x00a8a8a8, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x009c9c00, 0x008c8c8c, 0x00646464, 0x00484848, 0x00484848, 0x00545454, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2d, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00545454, 0x00484848, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00545454, 0x00707070, 0x00707070, 0x007c7c7c, 0x008c8c8c, 0x00b4ac00, 0x00b4b4b4, 0x00706c00, 0x00706c00, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00646465, 0x007c7c7c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x007c7c7c, 0x00b4b4b4, 0x007c7c7c, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00545454, 0x00202020, 0x00383838,
-		0x00484848, 0x00a8a8a8, 0x00cdc400, 0x00e4d800, 0x00ccc400, 0x00ccc500, 0x00ccc400, 0x00ccc400, 0x00b4ac00, 0x009c9c00, 0x00a8a8a8, 0x008c8c8d, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x002c2c2c, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00202020, 0x002c2c2c, 0x00383838,
-		0x00484848, 0x00a8a8a8, 0x00ccc400, 0x00e4d800, 0x00b4ac00, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00989898, 0x00a8a8a8, 0x00c0c0c0, 0x00b4ac00, 0x00e4d800, 0x00e4d801, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00848400, 0x00707070, 0x007c7c7c, 0x00707070, 0x00646464, 0x00646464, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x00383838, 0x00484848,
-		0x00484848, 0x00a8a8a8, 0x00c0c0c0, 0x00989898, 0x00b4ac00, 0x00989898, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00c0c0c0, 0x00b4b4b4, 0x00c0c0c0, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x00848400, 0x008c8c8c, 0x008c8c8c, 0x00c0c0c0, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a9a8a8, 0x00a8a8a8, 0x008c8c8c, 0x00484848, 0x00545454, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2d2c, 0x002c2c2c, 0x00383838, 0x00383838, 0x00484849, 0x00484848,
-		0x00484948, 0x00a8a8a8, 0x00c0c0c0, 0x00c0c0c0, 0x00989898, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x00c0c0c0, 0x00a8a8a8, 0x00b4b4b4, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00848400, 0x00848400, 0x00858400, 0x008c8c8c, 0x00989898, 0x00c0c0c0, 0x00dcdcdc, 0x00e4d800, 0x00e4d800, 0x008c8c8c, 0x00c0c0c0, 0x007c7c7c, 0x00383838, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00393838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383839, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00545454,
-		0x00484948, 0x00a8a8a8, 0x00b4b4b4, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00c0c0c0, 0x00e4d800, 0x00b4ac00, 0x00848400, 0x00b5b4b4, 0x00b4b4b4, 0x00d0d0d0, 0x00a8a8a8, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00ccc400, 0x009c9c00, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00b4b4b4, 0x00a8a8a8, 0x008c8c8c, 0x00e4d800, 0x00848400, 0x008c8c8c, 0x007c7c7c, 0x00646464, 0x00202020, 0x00383838, 0x00545454, 0x00484848, 0x00848400, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00646464, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00706c00, 0x00b4ac00, 0x009c9c00, 0x00848400, 0x00706c00, 0x00706c00, 0x00585400, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454,
-		0x00484848, 0x00a8a8a8, 0x00c0c0c0, 0x00c0c0c0, 0x00a8a8a8, 0x008c8c8c, 0x007c7c7c, 0x00b4ac00, 0x00848400, 0x00585400, 0x00c0c0c0, 0x00a8a8a8, 0x00c0c0c0, 0x00d0d0d1, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00a8a8a8, 0x00c0c0c0, 0x00a8a8a8, 0x00d0d0d0, 0x00a8a8a8, 0x007c7c7c, 0x00a8a8a8, 0x00d0d0d0, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x00646464, 0x00545455, 0x00202020, 0x00383838, 0x00484848, 0x00484848, 0x00b4ac00, 0x00848400, 0x00848400, 0x00848400, 0x00646464, 0x00dcdcdc, 0x00dcdcdc, 0x00b4b4b4, 0x00545454, 0x00545454, 0x009c9c00, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x009c9c00, 0x007c7d7c, 0x00ccc400, 0x00a8a8a8, 0x00a8a8a8, 0x00d0d0d0, 0x00ccc400, 0x00b4b4b4, 0x00989898, 0x007c7c7c, 0x00484848, 0x00484848, 0x00545454,
-		0x00484848, 0x00a8a9a8, 0x008c8c8c, 0x00707070, 0x00646464, 0x00646464, 0x00646464, 0x00848400, 0x00585400, 0x00707070, 0x007c7c7c, 0x00707070, 0x00646464, 0x00707070, 0x007c7c7c, 0x00707070, 0x00646464, 0x00646464, 0x00646564, 0x00707070, 0x007c7c7c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x007c7c7c, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00545454, 0x00545454, 0x00383838, 0x00202020, 0x00383838, 0x00484848, 0x00646464, 0x00848400, 0x00848400, 0x00706c00, 0x00646464, 0x00b4b4b4, 0x00b4b4b4, 0x00b4b4b4, 0x00646464, 0x00545454, 0x008c8c8c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00a8a8a8, 0x00a8a8a8, 0x008c8c8c, 0x00ccc400, 0x009c9c00, 0x00707070, 0x00a8a8a8, 0x00dcdcdc, 0x00989898, 0x00202020, 0x00545554,
-		0x00484848, 0x008c8c8c, 0x00646464, 0x00484848, 0x00383838, 0x00393838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00393838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00202020, 0x002c2c2c, 0x00484848, 0x00b4b4b4, 0x00848400, 0x00706c00, 0x00646464, 0x00989898, 0x00646464, 0x00989898, 0x008c8c8c, 0x00646464, 0x00484848, 0x008c8c8c, 0x008c8c8c, 0x00a8a8a8, 0x008c8c8c, 0x00a8a8a8, 0x00ccc400, 0x00ccc400, 0x00a8a8a8, 0x00a8a8a8, 0x009c9c00, 0x00848400, 0x00707070, 0x008c8c8c, 0x00a8a8a8, 0x00545454, 0x00202020, 0x00545454,
-		0x00484848, 0x00383838, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x00484848, 0x00383838, 0x00404000, 0x00585400, 0x00545454, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00484848, 0x00646464, 0x00646464, 0x00989898, 0x00a8a8a8, 0x00ccc400, 0x00ccc400, 0x009c9c00, 0x007c7c7c, 0x00a8a8a8, 0x00848400, 0x00707070, 0x00707070, 0x008c8c8c, 0x008c8c8c, 0x00545454, 0x00202020, 0x00545454,
-		0x00545454, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2d, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002d2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00484848, 0x00404000, 0x00404000, 0x00383838, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00383838, 0x00494848, 0x00545554, 0x00545454, 0x00706c00, 0x00585400, 0x00545454, 0x00545454, 0x00545454, 0x00706c00, 0x00585400, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00202020, 0x00545454,
-		0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383839, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383938, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00545454,
-		0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383938, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00393838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00393838, 0x00383838, 0x00383838, 0x00383838};
-	// 'pillar', 64x64px
-	const unsigned int pillar[] = {
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00707070, 0x00707070, 0x00707070, 0x00717070, 0x00646464, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00a9a8a8, 0x00a8a8a8, 0x00dcdcdc, 0x00dddcdc, 0x00d0d0d0, 0x00d0d0d0, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x00707071, 0x00707170, 0x00646464, 0x00545454, 0x00484848, 0x00545454, 0x00545454, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00ececec, 0x00ececec, 0x00dcdcdc, 0x00dcdcdc, 0x00dcdcdc, 0x00d0d0d0, 0x00d0d0d0, 0x00d0d1d0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x00707070, 0x00c0c0c0, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x00383838, 0x002c2d2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00edecec, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00ececec, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00dcdcdc, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x007c7c7c, 0x00484848, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x00383838, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00dcdcdc, 0x00ececec, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00fdfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00383838, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00dcdcdc, 0x00dcdcdc, 0x00ececec, 0x00ececed, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00ececec, 0x00d0d0d0, 0x00d0d0d0, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00a8a8a8, 0x00d0d0d0, 0x00a8a9a8, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x007c7c7c, 0x00707170, 0x00646464, 0x00646464, 0x00545454, 0x00404040, 0x00484848, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00c0c0c0, 0x00dcdcdc, 0x00dcdcdc, 0x00fcfcfc, 0x00ecedec, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00ececec, 0x00ececec, 0x00dcdcdc, 0x00dcdcdc, 0x00d0d0d0, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x00999898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x002c2c2c, 0x00383838, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00c0c0c0, 0x00c0c0c0, 0x00fcfcfc, 0x00ececec, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00dcdcdc, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x008d8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x002c2d2c, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00b4b4b4, 0x00ececec, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdd, 0x00d0d0d0, 0x00c0c0c0, 0x00a8a8a8, 0x00b4b4b4, 0x00989898, 0x008d8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x002c2c2c, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00b4b4b4, 0x00c0c0c0, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dddcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00545454, 0x00646464, 0x00484848, 0x00414040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202120, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8d8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c1c0c0, 0x00fcfcfc, 0x00fdfcfc, 0x00fcfcfc, 0x00ecedec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x008c8c8c, 0x00a8a8a8, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x002c2c2c, 0x00383838, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x008c8c8c, 0x00989898, 0x00a8a8a8, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00999898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646564, 0x00404040, 0x00646464, 0x00404040, 0x00383838, 0x002c2c2c, 0x00212020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b5b4, 0x00a9a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7d, 0x00707070, 0x00646464, 0x00545454, 0x00646464, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00ececec, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a9a8a8, 0x00989998, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00484848, 0x002c2c2d, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x008c8c8c, 0x00a8a8a8, 0x00b4b4b4, 0x00a8a9a8, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00707070, 0x00646464, 0x00646564, 0x00545454, 0x00494848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00212020, 0x00202020, 0x00202020, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00dcdcdc, 0x00fcfcfc, 0x00dcdcdc, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00545454, 0x00646464, 0x00484848, 0x00383838, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00c0c0c0, 0x00dcdddc, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00545454, 0x00393838, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00383838, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00c0c0c0, 0x00dcdcdc, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfd, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00d0d0d0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x007c7c7c, 0x008c8c8c, 0x00707070, 0x00646465, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2d, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c1, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ecedec, 0x00dcdcdc, 0x00b4b4b4, 0x00ececec, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x00707070, 0x007c7c7c, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfd, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00c0c0c0, 0x00ececec, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x002c2c2c, 0x00383838, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00d0d0d0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00545454, 0x00646464, 0x00484948, 0x00404040, 0x00383838, 0x002c2c2c, 0x00000000, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a9, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x002c2c2c, 0x00484848, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00a8a8a8, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00b4b4b4, 0x00fcfcfc, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00dcdcdc, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececed, 0x00dcdcdc, 0x00d1d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x007c7c7c, 0x00989898, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00383838, 0x00404040, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00b4b4b4, 0x00dcdcdc, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7d7c, 0x00707070, 0x00646465, 0x00484848, 0x00545454, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dddcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x008c8c8c, 0x00989898, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x002c2c2c, 0x00383838, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007c7c7c, 0x00989898, 0x00dcdcdc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00494848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007c7c7c, 0x00989898, 0x00a8a8a9, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00707070, 0x00646464, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00a8a8a8, 0x00d0d0d0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfdfc, 0x00fcfcfc, 0x00c0c0c0, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00383839, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00ececec, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00999898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202120, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x008c8c8c, 0x00989898, 0x007c7c7c, 0x00646464, 0x007c7c7c, 0x00545454, 0x00484848, 0x00404040, 0x002c2c2c, 0x00404040, 0x00000000, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00b4b4b4, 0x00ececec, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00404040, 0x00484848, 0x00383838, 0x002c2c2d, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00dcdcdc, 0x00fcfcfc, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00494848, 0x00545454, 0x00404040, 0x00383838, 0x00202020, 0x002c2c2c, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00ececec, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00b4b4b5, 0x00c0c0c0, 0x00a8a8a8, 0x00b4b4b4, 0x00989898, 0x007c7c7c, 0x008c8c8c, 0x00707070, 0x00646464, 0x00545454, 0x00545454, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00b4b4b4, 0x00fcfcfc, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00383838, 0x00404040, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00fcfcfc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989998, 0x008c8c8c, 0x00707070, 0x007c7c7c, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989899, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00dddcdc, 0x00fcfcfc, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x008c8c8c, 0x00989898, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00404040, 0x00484848, 0x002c2c2c, 0x00383838, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00b4b4b4, 0x00dcdcdc, 0x00a8a8a8, 0x00989898, 0x008c8c8d, 0x007c7c7c, 0x00707070, 0x00545454, 0x00646464, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00d0d0d0, 0x00edecec, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x00707070, 0x007c7c7c, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x002c2d2c, 0x00383838, 0x00202020, 0x00202021, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007c7c7c, 0x00c0c0c0, 0x00ecedec, 0x00fcfcfc, 0x00ececec, 0x00edecec, 0x00dcdcdc, 0x00d0d0d0, 0x00c1c0c0, 0x00b4b4b4, 0x00989898, 0x00989898, 0x008c8d8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00484848, 0x00545454, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00383838, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00a8a8a8, 0x00d0d0d0, 0x00dcdcdc, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b5, 0x00a8a8a8, 0x00989898, 0x00707070, 0x00989898, 0x00707071, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00a8a8a8, 0x00ececec, 0x00b4b4b4, 0x00c0c0c0, 0x00d0d0d0, 0x00c0c0c0, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00545454, 0x00646464, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383839, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00d0d0d0, 0x00fcfcfc, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b5b4, 0x008c8c8c, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00383838, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x007c7c7c, 0x00989898, 0x00707070, 0x00656464, 0x00545454, 0x00484848, 0x00404040, 0x002c2c2c, 0x00404040, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00d0d0d0, 0x00fcfcfc, 0x00d0d0d0, 0x00c0c0c0, 0x00989898, 0x00dcdcdc, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x007c7c7c, 0x00989898, 0x00707070, 0x00646464, 0x00484848, 0x00545454, 0x00404140, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfdfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00545454, 0x00646464, 0x00484848, 0x00404040, 0x00383839, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c1c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00989898, 0x00c0c0c0, 0x00989898, 0x008c8c8c, 0x007d7c7c, 0x00646464, 0x00707070, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00a8a8a8, 0x00dcdcdc, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00404040, 0x00545454, 0x00383838, 0x002c2c2c, 0x00202120, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00ececec, 0x00fcfdfc, 0x00fcfcfc, 0x00d0d0d0, 0x00fcfcfc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00989898, 0x00c0c0c0, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00d0d0d0, 0x00fcfcfc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00484848, 0x00545454, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00b4b4b4, 0x00dcdcdc, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00989898, 0x00b4b4b4, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x002c2c2c, 0x00383838, 0x00202020, 0x00202020, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00b4b4b4, 0x00ececec, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x002c2c2c, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00c0c0c0, 0x00c0c0c0, 0x00fdfcfc, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00dcdcdc, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545554, 0x00404040, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00404040, 0x00484848, 0x004c4c4c, 0x00545454, 0x00555454, 0x005c5c5c, 0x005c5c5c, 0x00646464, 0x00646464, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00c0c0c0, 0x00dcdcdc, 0x00dddcdc, 0x00fcfcfc, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00ececec, 0x00ececec, 0x00dcdcdc, 0x00dcdcdc, 0x00d0d0d0, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x002c2c2c, 0x00383838, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00383838, 0x00404040, 0x00484848, 0x00484848, 0x004c4c4c, 0x00545454, 0x00545454, 0x005c5c5c, 0x00646464, 0x00646464, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00dcdcdc, 0x00dcdcdc, 0x00ececec, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00ececec, 0x00d0d0d0, 0x00d0d0d0, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x00a8a8a8, 0x008c8c8c, 0x00a8a8a8, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00646464, 0x00545454, 0x00404040, 0x00484848, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00404040, 0x00484848, 0x00484948, 0x004c4c4c, 0x00545454, 0x005c5c5c, 0x005c5c5c, 0x00646464, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00dcdcdc, 0x00ececec, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00fdfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfdfc, 0x00ececec, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x008c8c8c, 0x007c7d7c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00646464, 0x00707070, 0x00646464, 0x004c4c4c, 0x004c4c4c, 0x00383838, 0x002c2c2c, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00404040, 0x00484848, 0x00484848, 0x004c4c4c, 0x00545454, 0x005c5c5c, 0x005c5c5c, 0x00646464, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfd, 0x00ececec, 0x00ececec, 0x00ececec, 0x00fcfcfc, 0x00fcfcfc, 0x00fcfcfc, 0x00dcdcdc, 0x00dcdcdc, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x005c5c5c, 0x00404040, 0x005c5c5c, 0x00383838, 0x00383838, 0x00202020, 0x002c2c2c, 0x00383839, 0x00383838, 0x00383838, 0x00404040, 0x00404040, 0x00484848, 0x004c4c4c, 0x004c4c4c, 0x00545454, 0x005c5c5c, 0x005c5c5c, 0x00646464, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00ececec, 0x00ececec, 0x00dcdcdc, 0x00dcdcdc, 0x00dcdcdc, 0x00d0d0d0, 0x00d0d0d1, 0x00d0d0d0, 0x00c0c0c0, 0x00b4b4b4, 0x00d0d0d0, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x00989898, 0x008c8c8c, 0x007c7c7c, 0x008c8c8c, 0x00707070, 0x00646464, 0x005d5c5c, 0x00484848, 0x00404041, 0x00383838, 0x00383838, 0x002c2c2c, 0x00404040, 0x00404040, 0x00404140, 0x00484848, 0x00484848, 0x00484848, 0x004c4c4c, 0x00545454, 0x005c5c5c, 0x005c5c5c, 0x00646464, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00a8a8a8, 0x00a8a8a8, 0x00dcdcdc, 0x00dcdcdc, 0x00d0d0d0, 0x00d0d0d0, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00404040, 0x00484848, 0x00545454, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x008c8d8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00707070, 0x00707070, 0x00707070, 0x00707070, 0x00646464, 0x00545454, 0x00404040, 0x00404040, 0x00484848, 0x00545454, 0x005c5c5c, 0x00646464, 0x00646464, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000};
-	// 'purplestone', 64x64px
-	const unsigned int purplestone[] = {
-		0x006c0070, 0x006c0070, 0x006c0070, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00580058, 0x006c0070, 0x00840084, 0x00580058, 0x006c0070, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x00580059, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00580058, 0x006c0070, 0x00840084, 0x00850084, 0x006c0070, 0x00580058, 0x00580058, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058,
-		0x005c4020, 0x00840084, 0x00840184, 0x006c0070, 0x00400040, 0x00400040, 0x00400040, 0x00580058, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058, 0x00400040, 0x00400140, 0x00400040, 0x00400040, 0x00400040, 0x006c0070, 0x00840084, 0x009c009c, 0x006c4824, 0x006c4824, 0x006c4824, 0x005c4020, 0x006c0070, 0x00580058, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00500050, 0x00580058, 0x006c0170, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00840184, 0x006c0070, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400041, 0x00400040, 0x00400040, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824,
-		0x006c4824, 0x005c4020, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00400040, 0x00580058, 0x006c0070, 0x006c0070, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0070, 0x00580058, 0x00400040, 0x00400040, 0x00500050, 0x00580058, 0x00840084, 0x009c009c, 0x006c4824, 0x006d4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00580058, 0x00580058, 0x00500050, 0x00410040, 0x00400040, 0x00500050, 0x00500050, 0x00580058, 0x00500050, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x00580058, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400140, 0x00400040, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x00840184, 0x00840084, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824,
-		0x005c4020, 0x005c4120, 0x005c4020, 0x00840084, 0x006c0070, 0x00580058, 0x00580158, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058, 0x00400040, 0x00480048, 0x00500051, 0x00500050, 0x00580058, 0x00840084, 0x009c009c, 0x006c4824, 0x005c4020, 0x00840084, 0x006c0070, 0x006c0070, 0x005c4020, 0x006c0070, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00580058, 0x00580058, 0x00500050, 0x00580058, 0x006c0070, 0x00840084, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x00580058, 0x00590058, 0x00580058, 0x00500050, 0x00500050, 0x00480048, 0x00500050, 0x00500050, 0x00480048, 0x00500050, 0x00500050, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00580058,
-		0x00840084, 0x005c4020, 0x00483818, 0x006c0070, 0x00840084, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00500050, 0x00480048, 0x00480048, 0x00500050, 0x00500050, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x00580058, 0x006c0070, 0x00840084, 0x006c4824, 0x006c0070, 0x00500050, 0x00580058, 0x005c4020, 0x005c4020, 0x005c4020, 0x00840084, 0x006c0070, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x006c0070, 0x00580058, 0x00580058, 0x005c4020, 0x005c4020, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00500050, 0x00500050, 0x00500050, 0x006c0070, 0x00840084, 0x006c4824, 0x006c4824, 0x006c4824, 0x00403019, 0x00580058, 0x00543c1c, 0x006c0070,
-		0x00840084, 0x005c4020, 0x00493818, 0x00840084, 0x00840084, 0x006c0070, 0x006c0070, 0x00580058, 0x006c0070, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x00543d1c, 0x00500050, 0x00580058, 0x005c4020, 0x006c4824, 0x006c4824, 0x006c4824, 0x005c4020, 0x00840084, 0x006c0070, 0x00580058, 0x00580059, 0x006c0070, 0x00483818, 0x00483818, 0x005c4020, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x005c4020, 0x005c4021, 0x005c4020, 0x00483818, 0x005c4021, 0x00483818, 0x00500050, 0x00500050, 0x006c0070, 0x00840084, 0x006c0070, 0x006c4824, 0x005c4020, 0x00403018, 0x006c0070, 0x00543c1c, 0x00840084,
-		0x006c0070, 0x00840084, 0x005c4020, 0x006c0070, 0x00840084, 0x006c0070, 0x00840084, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x006c4824, 0x006c0070, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058, 0x006c0070, 0x00580058, 0x00840084, 0x006c0070, 0x006c0070, 0x00403018, 0x00580058, 0x005c4020, 0x006c4824, 0x006c4824, 0x00553c1c, 0x00543c1c, 0x005c4020, 0x00840084, 0x006c0070, 0x00580058, 0x00403018, 0x00483818, 0x006c4824, 0x006c4824, 0x00754c28, 0x006c4824, 0x006c4824, 0x006c4824, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00403018, 0x00543c1c, 0x00403018, 0x00403018, 0x005c4020, 0x00483818, 0x00500050, 0x00580058, 0x006c0070, 0x00840084, 0x006c4824, 0x005c4020, 0x00403018, 0x00840084, 0x00543c1c, 0x006d0070,
-		0x00840084, 0x00840084, 0x005c4020, 0x00840084, 0x006c0070, 0x006c0070, 0x006c0070, 0x00840084, 0x005d4020, 0x00744c28, 0x00840084, 0x006c4824, 0x005c4020, 0x006c0070, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0070, 0x00840084, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x00580158, 0x006c0070, 0x00580058, 0x00483818, 0x00580058, 0x006c4824, 0x005c4020, 0x00543c1c, 0x00580058, 0x00580058, 0x00543c1c, 0x006c0070, 0x00580058, 0x00403018, 0x00543c1c, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483818, 0x00543c1c, 0x00483818, 0x00400040, 0x00543c1c, 0x00580058, 0x00580058, 0x005c4020, 0x00403018, 0x00483818, 0x00500050, 0x00580058, 0x00840084, 0x006c4824, 0x005c4021, 0x00403018, 0x00840084, 0x00543c1c, 0x00580058,
-		0x006c0070, 0x00840084, 0x005c4020, 0x006c0070, 0x00580058, 0x006c0070, 0x00840084, 0x005c4020, 0x00744c28, 0x00744c28, 0x006c4824, 0x005c4020, 0x00553c1c, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00580058, 0x006c0070, 0x00580058, 0x00580058, 0x006c0070, 0x006d0070, 0x005c4020, 0x006c0070, 0x005c4020, 0x005c4020, 0x00580058, 0x00840084, 0x006c0070, 0x00483818, 0x00840084, 0x006c0070, 0x00403018, 0x006c4824, 0x00744c28, 0x00744c28, 0x0080502c, 0x0080502d, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483818, 0x00400040, 0x00483818, 0x00580058, 0x00543c1c, 0x006c0070, 0x006c0070, 0x00543c1c, 0x00580058, 0x00483818, 0x00500050, 0x00500050, 0x006c0070, 0x005c4020, 0x00543c1c, 0x00403018, 0x006c0070, 0x00543c1c, 0x00500050,
-		0x00580058, 0x006c0070, 0x005c4020, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x00744c28, 0x00744c28, 0x006c4824, 0x005c4020, 0x005c4020, 0x00543c1c, 0x006c0070, 0x00580058, 0x00580058, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0170, 0x006d0070, 0x00543c1c, 0x00580058, 0x005c4020, 0x005c4020, 0x006c0070, 0x00840084, 0x00840084, 0x00403018, 0x006c0070, 0x00403018, 0x006c4824, 0x00543c1c, 0x00483818, 0x0080502d, 0x0080502c, 0x00744c28, 0x00744c28, 0x006c4824, 0x005c4020, 0x00403018, 0x00580058, 0x00403018, 0x00580058, 0x00543c1c, 0x00840184, 0x00840084, 0x00543c1c, 0x006c0070, 0x00483818, 0x00580058, 0x00500050, 0x00580058, 0x005c4020, 0x00543c1c, 0x00403018, 0x00840084, 0x00543c1c, 0x00500050,
-		0x00580058, 0x00580058, 0x00403018, 0x006c0070, 0x006c0070, 0x00840084, 0x009c009c, 0x00744c28, 0x006c4824, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x006c0070, 0x00580058, 0x006c0070, 0x006c0070, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x00483818, 0x00500050, 0x00483818, 0x00580058, 0x00840084, 0x006c0070, 0x006d0070, 0x00403018, 0x00500050, 0x00403018, 0x00543c1c, 0x006c4824, 0x006c0070, 0x0080502c, 0x00754c28, 0x006c4824, 0x006c4824, 0x005c4021, 0x00543c1c, 0x00403018, 0x00580058, 0x00580058, 0x00580058, 0x00840084, 0x00840084, 0x00543c1c, 0x00543d1c, 0x006c0170, 0x00483818, 0x00403018, 0x00580058, 0x00500050, 0x00580058, 0x00543c1c, 0x00403018, 0x006c0070, 0x00580058, 0x00500050,
-		0x00580058, 0x00580058, 0x00403018, 0x006c0070, 0x00840084, 0x00840184, 0x009c009c, 0x00744c28, 0x005c4020, 0x005c4020, 0x00493818, 0x00483818, 0x00483818, 0x006c0070, 0x00580058, 0x006c0070, 0x005c4020, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x005c4020, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00500050, 0x00483818, 0x006c0070, 0x00840084, 0x00580058, 0x006c0070, 0x00403019, 0x00480048, 0x00403018, 0x00543c1c, 0x00483818, 0x006c0170, 0x0080502c, 0x006c4824, 0x006c4824, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00403018, 0x00840084, 0x00580058, 0x00840084, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00483918, 0x00403018, 0x006c0070, 0x00580058, 0x00500050, 0x00543c1c, 0x00403018, 0x00500050, 0x00580058, 0x00500050,
-		0x00580058, 0x00580058, 0x00403018, 0x006c0070, 0x00840084, 0x009c009c, 0x009c009c, 0x006c0071, 0x005c4020, 0x00483818, 0x00403018, 0x006c0070, 0x00403018, 0x00580058, 0x006c0070, 0x00580058, 0x006c4824, 0x006c4824, 0x005c4020, 0x006c0070, 0x005c4020, 0x006c4824, 0x00840084, 0x006c0070, 0x00580058, 0x00500050, 0x00480048, 0x00480048, 0x00403018, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00480048, 0x00480048, 0x00580058, 0x00543c1c, 0x00483818, 0x00840084, 0x006c4924, 0x006c4824, 0x005c4020, 0x00543c1c, 0x00580058, 0x006c0070, 0x00543c1c, 0x00543c1c, 0x00403018, 0x00840084, 0x00840084, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x00483818, 0x00403018, 0x006c0070, 0x006c0070, 0x00580058, 0x00543c1c, 0x00403018, 0x00500150, 0x00500050, 0x00480048,
-		0x00580058, 0x00580058, 0x00403018, 0x006c0070, 0x009c009c, 0x00840084, 0x006c4824, 0x006c4824, 0x006c4824, 0x005c4020, 0x00403018, 0x00500050, 0x00403018, 0x00500050, 0x00500050, 0x005c4020, 0x006c4824, 0x005c4020, 0x006c0071, 0x006c0070, 0x00840084, 0x005c4020, 0x00840084, 0x006c0070, 0x00500050, 0x00400040, 0x00400040, 0x00480048, 0x00500050, 0x00500050, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00580058, 0x00500050, 0x00543c1c, 0x00483818, 0x00840084, 0x006c4824, 0x005c4020, 0x00543c1c, 0x00580058, 0x006c0070, 0x00840084, 0x006c0070, 0x00543c1c, 0x00403018, 0x005c4020, 0x006c4824, 0x00483818, 0x00403018, 0x00403118, 0x00840084, 0x00483818, 0x00403018, 0x006c0070, 0x00840084, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00480048, 0x00480148,
-		0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x006c4825, 0x006c4824, 0x005c4020, 0x006c0170, 0x006c0070, 0x006c0070, 0x006c0070, 0x00382c14, 0x00480048, 0x00500050, 0x005c4020, 0x006c4824, 0x005c4020, 0x00580058, 0x00840084, 0x006c0071, 0x005c4020, 0x00840084, 0x006c0070, 0x00500050, 0x00480048, 0x00480048, 0x00500050, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x00840085, 0x006c0070, 0x00500050, 0x00500050, 0x00483818, 0x00483818, 0x00840084, 0x006c4824, 0x00580058, 0x00543c1c, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x006c4824, 0x005d4020, 0x006c4824, 0x00543c1c, 0x00403018, 0x006c0070, 0x006c0070, 0x006c0070, 0x00483818, 0x00403018, 0x006c0070, 0x00840084, 0x006c0070, 0x00580058, 0x00500050, 0x00500050, 0x00480048, 0x00480048,
-		0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x006c4824, 0x005d4020, 0x006c0070, 0x00840084, 0x009c009c, 0x009c009c, 0x00840084, 0x00382c14, 0x00400040, 0x00500050, 0x005c4020, 0x006c4824, 0x005c4020, 0x00580058, 0x00840084, 0x00580058, 0x00543c1c, 0x006c0070, 0x00580058, 0x00480048, 0x00580058, 0x00483818, 0x00483818, 0x00493918, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x00500050, 0x00480048, 0x00483818, 0x00580058, 0x00840084, 0x006c4824, 0x00840084, 0x00543c1c, 0x00580058, 0x00483818, 0x00543c1c, 0x006c4824, 0x006d4924, 0x006c4824, 0x00543c1c, 0x00403018, 0x006c0070, 0x00840084, 0x006c0070, 0x00580058, 0x006c0070, 0x00483818, 0x00403018, 0x006c0071, 0x006c0070, 0x00500050, 0x00480048, 0x00480048, 0x00480048, 0x00480048,
-		0x00580058, 0x00580058, 0x00580058, 0x006d0070, 0x00840084, 0x006c4824, 0x006c0070, 0x00840084, 0x009c009c, 0x00840084, 0x006c0070, 0x006c0170, 0x00382c14, 0x00400040, 0x00500050, 0x006c4824, 0x00850084, 0x00543c1c, 0x00580058, 0x006c0070, 0x00580058, 0x00483818, 0x00500050, 0x00500050, 0x00500050, 0x005c4120, 0x006c4824, 0x006c4824, 0x005c4020, 0x005c4020, 0x00483818, 0x00580058, 0x006c0070, 0x00580058, 0x00480048, 0x00480048, 0x00483818, 0x00580058, 0x00840084, 0x006c4824, 0x00840084, 0x00543c1c, 0x00483818, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x00543c1c, 0x00403018, 0x006c0170, 0x006c0070, 0x00580058, 0x00840084, 0x00483818, 0x00483818, 0x00403018, 0x006c0070, 0x00500050, 0x00480048, 0x00480048, 0x00480048, 0x00480048,
-		0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x006c4824, 0x006c0070, 0x009c009c, 0x00840084, 0x00580058, 0x00580058, 0x00400040, 0x00382c14, 0x00400040, 0x00500050, 0x006c4824, 0x00840084, 0x00483818, 0x00580058, 0x006c0070, 0x00580058, 0x00403018, 0x00500051, 0x00580058, 0x006c4824, 0x0080502c, 0x0080502c, 0x0080502c, 0x0080502c, 0x006c4824, 0x005c4020, 0x00580058, 0x00580058, 0x006c0070, 0x00480048, 0x00480048, 0x00403019, 0x006c0070, 0x00840084, 0x00580058, 0x00840084, 0x00543c1c, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00403019, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x006c0070, 0x00483818, 0x00403018, 0x00403018, 0x00500050, 0x00480048, 0x00480048, 0x00500051, 0x00580058,
-		0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x006c4824, 0x006c0070, 0x009c009c, 0x00580058, 0x006c0070, 0x00840084, 0x00580058, 0x00382c14, 0x00480048, 0x00500150, 0x00840084, 0x00840084, 0x006c0070, 0x00840084, 0x006c0070, 0x00580058, 0x00500050, 0x00500050, 0x00840084, 0x0080502c, 0x006c4924, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x006c4824, 0x00543c1c, 0x00580058, 0x00580058, 0x00500050, 0x00480048, 0x00403018, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058, 0x00543c1c, 0x006c4824, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00382c14, 0x00543c1c, 0x00382c14, 0x00543c1c, 0x00403018, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058, 0x00840084, 0x006c0070, 0x00403118, 0x00500050, 0x00400040, 0x00500050, 0x00500150, 0x00500050, 0x00580058,
-		0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00840084, 0x006c0070, 0x00580059, 0x00840084, 0x006c0070, 0x00580058, 0x00382c14, 0x00500050, 0x00580058, 0x006c0170, 0x00840084, 0x00840084, 0x006c0070, 0x00580058, 0x00500050, 0x00500050, 0x00580058, 0x00840084, 0x005c4020, 0x006c0070, 0x00b400b4, 0x009c009c, 0x00840084, 0x009c009c, 0x005c4020, 0x00543c1c, 0x00483818, 0x00403018, 0x00580058, 0x00500050, 0x00403018, 0x006c0071, 0x00840084, 0x00580058, 0x00543c1c, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x00483818, 0x00382c14, 0x00580058, 0x00543c1c, 0x00580059, 0x00543c1c, 0x00382c14, 0x006c0070, 0x00580058, 0x006c0070, 0x00580058, 0x00840084, 0x006c0070, 0x00403018, 0x00500050, 0x00480048, 0x00500050, 0x00580058, 0x00580058, 0x006c0070,
-		0x006c0070, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00840084, 0x006c0071, 0x00580058, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x00580058, 0x00500050, 0x00500050, 0x00580058, 0x00840084, 0x006c4824, 0x00b400b4, 0x00b400b4, 0x009c009c, 0x00840084, 0x00840084, 0x00543c1c, 0x00850084, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00580058, 0x00580058, 0x00403018, 0x006c0070, 0x006c0071, 0x00580058, 0x00580058, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x00382c14, 0x00580058, 0x006c0071, 0x00580058, 0x006c0070, 0x00543c1c, 0x00382c14, 0x006c0070, 0x00580058, 0x006c0070, 0x00580058, 0x006c0070, 0x006c0070, 0x00483818, 0x00500050, 0x00500050, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070,
-		0x006d4824, 0x00840084, 0x00840084, 0x006c0070, 0x00580058, 0x006c0070, 0x006c0070, 0x00580058, 0x006c0070, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x006c0070, 0x00840084, 0x006c4824, 0x00744c28, 0x00840084, 0x009c009c, 0x00840084, 0x006c4924, 0x00543c1c, 0x00543c1c, 0x00403018, 0x00543c1c, 0x00403018, 0x00403018, 0x00403018, 0x00580058, 0x00483818, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x00543c1c, 0x00840184, 0x00543c1c, 0x00382c14, 0x006c0070, 0x006d0070, 0x00580058, 0x00580058, 0x00382c14, 0x00580058, 0x00580058, 0x006c0070, 0x00580058, 0x00500050, 0x006c0070, 0x00580058, 0x00483818, 0x00580058, 0x006c0070, 0x00840084, 0x00744c28, 0x00744c28, 0x006c4824,
-		0x006c4824, 0x006c4824, 0x005c4020, 0x00840084, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x00580058, 0x00580058, 0x00400040, 0x00400040, 0x00500050, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00840084, 0x006d4824, 0x00744c28, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x005c4020, 0x00403018, 0x00580158, 0x006c0070, 0x00403018, 0x00580058, 0x00403018, 0x00403018, 0x00483818, 0x00543c1c, 0x00483819, 0x00580058, 0x00580058, 0x006c0070, 0x00543c1c, 0x00840084, 0x00483918, 0x00382c14, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00580058, 0x006c0070, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00483818, 0x00543c1c, 0x00840084, 0x00840084, 0x00744c28, 0x00744c28, 0x006c4824, 0x006c4824,
-		0x005c4020, 0x005c4020, 0x006c4824, 0x00483918, 0x006c0070, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00580058, 0x00400040, 0x00400040, 0x005c4020, 0x005c4020, 0x00403018, 0x00580058, 0x006c0070, 0x00840084, 0x006c4824, 0x00744c28, 0x006c0070, 0x00840084, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00580058, 0x006c0070, 0x00840084, 0x00580058, 0x00403018, 0x00403018, 0x00543c1c, 0x005c4020, 0x006c4824, 0x005c4020, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00840084, 0x00403018, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00840084, 0x006c0070, 0x00580058, 0x00580058, 0x00500050, 0x00480048, 0x00400040, 0x00483818, 0x005c4020, 0x006c4824, 0x006c4824, 0x00744c28, 0x00744c28, 0x006c4824, 0x006c4824,
-		0x005c4020, 0x00543c1c, 0x00543c1c, 0x00483818, 0x006c0071, 0x00840084, 0x006c0070, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00500050, 0x00400040, 0x00543d1c, 0x005c4020, 0x00543c1c, 0x00483818, 0x00580058, 0x006c0070, 0x00840084, 0x006d4824, 0x00744c28, 0x006c0070, 0x00840084, 0x006c4824, 0x00543c1c, 0x00403018, 0x00580058, 0x00840084, 0x00580058, 0x00403018, 0x00403018, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x006c0070, 0x006c0070, 0x006c0070, 0x00850084, 0x00403018, 0x00840084, 0x006c0070, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x00840084, 0x006c0070, 0x00480048, 0x00400040, 0x00500050, 0x00500050, 0x005c4020, 0x006c4824, 0x00744c28, 0x00744c28, 0x00840084, 0x00840084, 0x00840084, 0x005c4020,
-		0x00580058, 0x00580058, 0x00483818, 0x00403018, 0x00403018, 0x006c0070, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00590058, 0x00410040, 0x00500050, 0x006c4825, 0x006c0070, 0x00580058, 0x00483818, 0x00580058, 0x006c0070, 0x00840084, 0x006c4824, 0x00744c28, 0x006c4824, 0x006c4824, 0x00543c1c, 0x00403018, 0x00403018, 0x006c0070, 0x00840084, 0x00543c1c, 0x00483818, 0x00483818, 0x00403018, 0x00403018, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00403018, 0x00840084, 0x006c0070, 0x006c0070, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x006d0070, 0x00580058, 0x006c0070, 0x00400040, 0x00400140, 0x00480048, 0x00580058, 0x006c0070, 0x006c4924, 0x00744c28, 0x00744c28, 0x009c009d, 0x00840084, 0x006c0071, 0x006c0070, 0x006d0070,
-		0x00580058, 0x00580058, 0x00580059, 0x00483818, 0x00483818, 0x006c0070, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0070, 0x00580058, 0x00483818, 0x006c4824, 0x006c4824, 0x006c4824, 0x00580058, 0x006c0070, 0x00403018, 0x00403018, 0x006c0070, 0x00840084, 0x006c4824, 0x006c4824, 0x006d0070, 0x00580058, 0x00580059, 0x006c0070, 0x006c0070, 0x00840084, 0x00840084, 0x00543c1c, 0x00483818, 0x00403018, 0x00483818, 0x00580058, 0x00580058, 0x006d0070, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00403019, 0x00403018, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x00840084, 0x006c0070, 0x00580058, 0x00500050, 0x00480048, 0x00400040, 0x00400040, 0x00480048, 0x006c0070, 0x00840084, 0x00744c28, 0x00744c28, 0x009c009c, 0x009c009c, 0x00840084, 0x00580058, 0x006c0070, 0x00580058,
-		0x00840084, 0x00840084, 0x00840084, 0x00543c1c, 0x00543c1c, 0x00580058, 0x00840084, 0x006c0070, 0x00580058, 0x00580058, 0x00483818, 0x00543c1c, 0x00543c1c, 0x005c4020, 0x00580058, 0x00580058, 0x00580058, 0x00403018, 0x00500050, 0x006c0070, 0x00840084, 0x00840084, 0x006c4824, 0x006c0070, 0x00580058, 0x006c0070, 0x006c4824, 0x006c4824, 0x006c4824, 0x00543c1c, 0x00403018, 0x00403018, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00840084, 0x009c009c, 0x00543c1c, 0x006c0070, 0x00543c1c, 0x00483818, 0x00413018, 0x00403018, 0x006c0070, 0x00580058, 0x00580058, 0x006c0070, 0x00580058, 0x00500050, 0x00500050, 0x00480048, 0x00480048, 0x00480048, 0x00580058, 0x00840084, 0x00744c28, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00580058, 0x00580058,
-		0x00580058, 0x006c0070, 0x006c0070, 0x005c4020, 0x005c4020, 0x00580058, 0x006c0070, 0x00580058, 0x00500050, 0x00500050, 0x00483818, 0x006c0170, 0x006d0070, 0x005c4020, 0x006c0070, 0x006c0070, 0x00840084, 0x006d0070, 0x00500050, 0x00580058, 0x006c0070, 0x00840084, 0x006c4824, 0x00840084, 0x009c009c, 0x009c009c, 0x009c009c, 0x009c009c, 0x009c009c, 0x00543c1c, 0x00403018, 0x006c0070, 0x006c0070, 0x00483918, 0x00543d1c, 0x00840084, 0x00840084, 0x00543c1c, 0x006c0070, 0x00543c1c, 0x00543c1c, 0x00483819, 0x00413018, 0x00580058, 0x00500050, 0x00500050, 0x00580058, 0x00500050, 0x005c4020, 0x005c4020, 0x005c4020, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x006c4824, 0x00744c29, 0x005c4020, 0x005c4020, 0x005c4020, 0x00744c28, 0x00744c28, 0x006c4824, 0x006c0070,
-		0x00580058, 0x006c0170, 0x00840084, 0x006c4824, 0x005c4020, 0x00840084, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00580058, 0x006c0070, 0x00483818, 0x00840084, 0x00850084, 0x006c0070, 0x00580058, 0x00480048, 0x00500050, 0x00580059, 0x00840084, 0x00840084, 0x009c009c, 0x009c009c, 0x009c009c, 0x00840084, 0x00840084, 0x00840084, 0x00543c1c, 0x00403018, 0x00580058, 0x009c009c, 0x00840084, 0x00403018, 0x00580058, 0x006c0070, 0x00543c1c, 0x006c0070, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00403018, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x005c4020, 0x005c4020, 0x005d4020, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x009c009c, 0x006c4824, 0x005c4020, 0x00840084, 0x00b400b4, 0x00b400b4, 0x005c4020, 0x006c4824, 0x006c4824, 0x00840084,
-		0x006c0070, 0x00840084, 0x006c0070, 0x005c4020, 0x005c4020, 0x006c0070, 0x00580058, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00403018, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00480048, 0x00480048, 0x00580058, 0x00840084, 0x00840084, 0x009c009c, 0x009c009c, 0x00840084, 0x00840084, 0x006c0070, 0x005c4020, 0x00543c1c, 0x00403018, 0x006c0070, 0x00840084, 0x00840084, 0x00403018, 0x00580058, 0x00580058, 0x00543c1c, 0x00580058, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00403018, 0x006c0070, 0x00580058, 0x00483819, 0x00500050, 0x005c4020, 0x005c4020, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x009c009c, 0x006c4824, 0x00840084, 0x00b500b4, 0x00840084, 0x00840084, 0x009c009c, 0x009c009c, 0x006c4824, 0x005c4020,
-		0x006c0070, 0x00840084, 0x006c0070, 0x00543c1c, 0x00543c1c, 0x00840084, 0x006c0070, 0x00840084, 0x006c0070, 0x00580058, 0x006c0070, 0x00840084, 0x009c009c, 0x009c009c, 0x00840084, 0x00840084, 0x006c0070, 0x00543c1c, 0x00403018, 0x00403018, 0x006c0070, 0x00840084, 0x009c009c, 0x00840084, 0x005c4020, 0x006c4824, 0x006c4824, 0x00543c1c, 0x00403018, 0x00553c1d, 0x006c0070, 0x009c009d, 0x006d0070, 0x006c0070, 0x00403018, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0070, 0x00543c1c, 0x00543d1c, 0x00483818, 0x00403018, 0x006c0070, 0x00580058, 0x00500050, 0x00500150, 0x005c4020, 0x00840084, 0x00840184, 0x00840084, 0x006c0070, 0x006c0070, 0x00840084, 0x009c009c, 0x006c4824, 0x00840084, 0x00b400b4, 0x006c0070, 0x006c0070, 0x009c009c, 0x009c019c, 0x005c4020, 0x005c4020,
-		0x00580058, 0x00840084, 0x006c0070, 0x00483818, 0x00483818, 0x00840084, 0x00590058, 0x006c0070, 0x00580058, 0x00580058, 0x00840084, 0x00b400b4, 0x00b400b4, 0x009c009c, 0x005c4020, 0x005c4020, 0x005c4020, 0x00840084, 0x00483818, 0x00500050, 0x00840084, 0x00840084, 0x00840084, 0x005c4020, 0x006c4824, 0x005c4020, 0x00543c1c, 0x00483818, 0x00543c1c, 0x006c0070, 0x009c009c, 0x00840084, 0x006c0070, 0x00840084, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00403018, 0x006c0070, 0x00580058, 0x00480048, 0x00500050, 0x00483818, 0x006c0070, 0x00840084, 0x00840184, 0x006c0070, 0x00580059, 0x00840084, 0x00840084, 0x006c4824, 0x00840084, 0x009d009c, 0x006c0070, 0x00580058, 0x00840084, 0x00840084, 0x00543c1c, 0x00543c1c,
-		0x00580058, 0x006c0070, 0x00840084, 0x00543c1c, 0x00543c1c, 0x006c0070, 0x006c0070, 0x006c0070, 0x00580058, 0x006c0070, 0x009c009c, 0x00b500b4, 0x009c009c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x006c0070, 0x00580058, 0x00840084, 0x00840084, 0x00850084, 0x006c4824, 0x005c4020, 0x00403018, 0x00480048, 0x00483818, 0x00543c1c, 0x00483818, 0x009c009c, 0x00840084, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0071, 0x00840084, 0x00840084, 0x00840084, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00403018, 0x006c0070, 0x00580058, 0x00480048, 0x00500050, 0x00483818, 0x006c0070, 0x006c0070, 0x006c0070, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x006c4824, 0x00840084, 0x009c009c, 0x006c0070, 0x00580058, 0x006c0070, 0x00483818, 0x00483818, 0x00483818,
-		0x00580058, 0x006c0070, 0x00840084, 0x006c4824, 0x005c4020, 0x006c0070, 0x00840084, 0x00840084, 0x00580058, 0x00840084, 0x009c019c, 0x009c009c, 0x005c4020, 0x005c4020, 0x00483818, 0x00483818, 0x006c0070, 0x00483818, 0x00840084, 0x00580058, 0x00840084, 0x00840084, 0x006c0170, 0x006c4824, 0x00483818, 0x00500050, 0x00580058, 0x00580058, 0x00483818, 0x00483818, 0x00840084, 0x006c0070, 0x00480048, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x00580058, 0x00543c1c, 0x00403018, 0x00483818, 0x00403018, 0x006c0070, 0x00580058, 0x00480148, 0x00500050, 0x00483818, 0x00580058, 0x00580058, 0x006c0070, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x005c4020, 0x006c0070, 0x00840084, 0x006c0070, 0x00500050, 0x006c0070, 0x00483818, 0x00483818, 0x00483818,
-		0x00840084, 0x00580058, 0x00840084, 0x005c4020, 0x00483818, 0x006c0070, 0x00840084, 0x006c0070, 0x00580058, 0x00840084, 0x00840084, 0x009c009c, 0x006c0070, 0x005c4020, 0x00483818, 0x00483818, 0x00840084, 0x00483818, 0x006c0070, 0x00580058, 0x00840084, 0x00840084, 0x00580058, 0x00483818, 0x00480048, 0x00580058, 0x006c0070, 0x00580058, 0x00483818, 0x00403118, 0x006c0070, 0x00580158, 0x00480048, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x00580058, 0x00543c1c, 0x00403018, 0x00580058, 0x006c0070, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00483818, 0x00500050, 0x00580058, 0x00580058, 0x00500050, 0x00580058, 0x00580058, 0x006c0070, 0x005c4020, 0x006c0070, 0x00840084, 0x006c0070, 0x00580059, 0x00500050, 0x00500050, 0x00543c1c, 0x00543c1c,
-		0x00580058, 0x00580058, 0x00840084, 0x00483818, 0x00483818, 0x006c0070, 0x006c0071, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x006c0170, 0x00483818, 0x00483818, 0x00483818, 0x006c0070, 0x00483818, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x006c0070, 0x00483818, 0x00480048, 0x006c0070, 0x006c0070, 0x00580058, 0x00403018, 0x00403018, 0x00500050, 0x00480048, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x00580058, 0x00580058, 0x00543c1c, 0x00403018, 0x00580058, 0x006c0070, 0x00580058, 0x00500050, 0x00580058, 0x00580058, 0x00483818, 0x00500050, 0x00500050, 0x00500050, 0x00500051, 0x00500050, 0x00500050, 0x00580058, 0x00543c1c, 0x00580058, 0x006c0170, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058, 0x005c4020, 0x005c4020,
-		0x00580058, 0x00580058, 0x006c0070, 0x00483818, 0x006c0070, 0x00580058, 0x00580058, 0x00500050, 0x00500050, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x00483818, 0x00483818, 0x00483818, 0x00580058, 0x00483818, 0x00480048, 0x00500050, 0x00590058, 0x006c0070, 0x006c0070, 0x005c4020, 0x00400040, 0x00580058, 0x00580058, 0x00480048, 0x00403018, 0x00403018, 0x00480048, 0x00480048, 0x006c0170, 0x00580058, 0x00580058, 0x00840084, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00403018, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x00483818, 0x00500050, 0x00500050, 0x00500050, 0x00580058, 0x00580058, 0x00500050, 0x00500050, 0x00543c1c, 0x00400040, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c4824, 0x006c4824,
-		0x00580058, 0x00580058, 0x00840084, 0x006c0070, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00580058, 0x006c0070, 0x006c0070, 0x00840084, 0x006c0070, 0x00483818, 0x00580058, 0x00500050, 0x00483818, 0x00480048, 0x00480048, 0x00500050, 0x00580058, 0x00580058, 0x00483818, 0x00400040, 0x006c0070, 0x00580058, 0x00480048, 0x00403018, 0x00403018, 0x00490048, 0x00580058, 0x00580058, 0x00480048, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00580058, 0x006c0070, 0x00403018, 0x00580058, 0x006c0070, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x00483818, 0x00500050, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x00580058, 0x00543c1c, 0x00500050, 0x00400040, 0x00500050, 0x00580058, 0x00580058, 0x00500050, 0x006c4824, 0x006c4824,
-		0x00580058, 0x00580058, 0x006c0170, 0x00580058, 0x00580059, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00580058, 0x006c0070, 0x006c0070, 0x00580058, 0x00483818, 0x00580058, 0x00500150, 0x00500050, 0x00500050, 0x00500050, 0x00480048, 0x00500050, 0x00500050, 0x00403018, 0x00480048, 0x00580058, 0x00580058, 0x00840084, 0x006c0070, 0x00403018, 0x00400040, 0x00480048, 0x00480048, 0x00580058, 0x00580058, 0x006d0070, 0x00840084, 0x00840084, 0x00580058, 0x006c0070, 0x00580058, 0x00403018, 0x00580058, 0x006c0170, 0x00840084, 0x00840084, 0x006c0070, 0x00483818, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00590058, 0x00590058, 0x00480048, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x005c4020, 0x005c4020,
-		0x00580058, 0x00590058, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x00580058, 0x006c0070, 0x00580058, 0x00500050, 0x00580058, 0x006c0070, 0x00840085, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00510050, 0x00580058, 0x00500050, 0x00500050, 0x00580058, 0x00403018, 0x00480048, 0x00480048, 0x00480048, 0x006c0070, 0x00580058, 0x00382c14, 0x00400040, 0x00480048, 0x00480048, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x006c0170, 0x00580058, 0x00580058, 0x00580058, 0x00403018, 0x00580058, 0x00840084, 0x006c0070, 0x00580058, 0x00580058, 0x00483818, 0x00483818, 0x005c4020, 0x005c4020, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x006c0070, 0x00580058, 0x00480048, 0x00480048, 0x00400040, 0x00410040, 0x00543c1c, 0x00483818,
-		0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x006c4824, 0x006c4824, 0x00840084, 0x006c0071, 0x00840084, 0x006c0070, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x00580058, 0x006c0070, 0x00580058, 0x00580058, 0x00382c14, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00490048, 0x00382c14, 0x00400041, 0x00480048, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x006c0070, 0x00580058, 0x00580058, 0x006d0070, 0x00580058, 0x00500050, 0x00580058, 0x00500050, 0x00580058, 0x00840084, 0x00483818, 0x005c4020, 0x005c4020, 0x006c4824, 0x006c4824, 0x005c4020, 0x005c4020, 0x00840084, 0x006c0070, 0x006c0070, 0x00840084, 0x006c0070, 0x00580058, 0x00480048, 0x00480048, 0x00400040, 0x00483818, 0x00483918,
-		0x00500050, 0x00580058, 0x006c0070, 0x006c4824, 0x005c4020, 0x005c4020, 0x00553c1c, 0x006c0070, 0x006c0070, 0x00580058, 0x006c0070, 0x006c0070, 0x00840084, 0x00840084, 0x006c4824, 0x006d4824, 0x00543c1c, 0x00543d1c, 0x006c0070, 0x006c0070, 0x00840084, 0x006c0070, 0x00500050, 0x00382c14, 0x00500050, 0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00403018, 0x00400040, 0x00580058, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00580058, 0x00500050, 0x00480048, 0x00500050, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x005c4020, 0x006c4824, 0x005c4020, 0x00543c1c, 0x00580058, 0x00543c1c, 0x006c0070, 0x00840084, 0x006d0070, 0x00840084, 0x00840084, 0x006c0070, 0x00580058, 0x00480048, 0x00480048, 0x00403018, 0x00403018,
-		0x00500050, 0x00580058, 0x00840084, 0x005c4020, 0x006c0070, 0x006c0070, 0x00543c1c, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x006c4824, 0x006c4824, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00580058, 0x00590058, 0x006c0070, 0x00580059, 0x00480048, 0x00403018, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00500050, 0x00483818, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x00580058, 0x00580058, 0x00500050, 0x00500050, 0x00480048, 0x00480048, 0x00500050, 0x00580058, 0x006c0070, 0x00840084, 0x009c009c, 0x006c4824, 0x006c4824, 0x00543c1c, 0x00483818, 0x00400040, 0x00483818, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00840084, 0x006c0070, 0x00580058, 0x00500050, 0x00403018, 0x00382c14,
-		0x00500050, 0x00580058, 0x00850084, 0x00543c1c, 0x006c0070, 0x00840084, 0x00543c1c, 0x00840084, 0x006c0070, 0x00840084, 0x00840084, 0x006c4824, 0x006c4824, 0x006c4824, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00580058, 0x00580058, 0x00580058, 0x00500051, 0x00400040, 0x00483818, 0x00580058, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x005c4020, 0x00840084, 0x00840084, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058, 0x00500050, 0x00500050, 0x00500050, 0x00580058, 0x006c0070, 0x00840084, 0x009c009c, 0x00543c1c, 0x00840084, 0x00483818, 0x00580058, 0x00400040, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x006d0070, 0x00580058, 0x006c0070, 0x00580058, 0x006c0070, 0x00580058, 0x00382c14, 0x00400040,
-		0x00500050, 0x00580058, 0x006c0070, 0x00543c1c, 0x006c0070, 0x00580058, 0x00543c1c, 0x006c0070, 0x006c0070, 0x00840084, 0x00840084, 0x005c4020, 0x00840085, 0x006c4824, 0x00580058, 0x00580058, 0x00543c1c, 0x00403018, 0x00580058, 0x006c0070, 0x00580058, 0x00500050, 0x00400040, 0x00483818, 0x00543c1c, 0x006c4824, 0x006c4824, 0x005c4020, 0x005c4020, 0x006c4824, 0x009c009c, 0x009c009c, 0x00840084, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x006c4824, 0x009c009c, 0x00543c1c, 0x00840084, 0x00483818, 0x00400040, 0x00400040, 0x00590058, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x006c0070, 0x00382c14, 0x00400040,
-		0x00500050, 0x00580058, 0x00580058, 0x00483818, 0x006c0070, 0x00840084, 0x00840085, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x00553c1c, 0x00580058, 0x00840084, 0x00500050, 0x00580058, 0x00580058, 0x00403018, 0x006c0070, 0x00840084, 0x006c0070, 0x00500051, 0x00480048, 0x00543c1c, 0x006c4824, 0x0080502c, 0x00744c28, 0x006c4824, 0x005c4120, 0x006c4824, 0x00840084, 0x00b400b4, 0x009d009c, 0x006c4824, 0x00483818, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x00840184, 0x006c0070, 0x00580058, 0x006d0070, 0x00840084, 0x006c4824, 0x006c4824, 0x00840084, 0x00483818, 0x006c0070, 0x00580058, 0x00400040, 0x00580058, 0x00580058, 0x00483818, 0x005c4020, 0x009c009c, 0x00840184, 0x006c0070, 0x006c0070, 0x006c0070, 0x00840084, 0x006c0070, 0x00382c14, 0x00400040,
-		0x00480048, 0x00500050, 0x00580058, 0x00483818, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x00580058, 0x00840084, 0x00580058, 0x00500050, 0x006c0070, 0x00840084, 0x009c009c, 0x00403018, 0x00840084, 0x006c0070, 0x00500050, 0x00500050, 0x005c4020, 0x0080502c, 0x00744c28, 0x00744c28, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c0070, 0x009c009c, 0x00840084, 0x005c4020, 0x006c4824, 0x00483818, 0x00840084, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x00580058, 0x006c0070, 0x006c4824, 0x006c4824, 0x006c4824, 0x00840084, 0x00483819, 0x006c0070, 0x00580058, 0x00580058, 0x00483818, 0x00483818, 0x005c4020, 0x006c4824, 0x00744c28, 0x00840084, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058,
-		0x00500050, 0x00480048, 0x00500050, 0x00403018, 0x006c0070, 0x006c0070, 0x006c0070, 0x00580058, 0x006c0070, 0x00840085, 0x006c0070, 0x00580058, 0x00580058, 0x00500050, 0x006c0070, 0x006c0070, 0x009c009c, 0x006c0070, 0x00403018, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x006c4824, 0x00744c28, 0x006c4824, 0x006c4824, 0x005c4020, 0x006c4924, 0x006c4824, 0x006c4824, 0x00840084, 0x009c009c, 0x00840084, 0x005c4020, 0x005c4020, 0x006c0070, 0x00840084, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x00590058, 0x00483818, 0x00483818, 0x005c4020, 0x005c4020, 0x006c4824, 0x00744c28, 0x005c4020, 0x006c0070, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x00840084, 0x006c0070, 0x00403018,
-		0x00500050, 0x00480048, 0x00500050, 0x00403018, 0x00500050, 0x00580158, 0x00580058, 0x00590058, 0x00580058, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x00580058, 0x006c0070, 0x006c0070, 0x00403018, 0x006c0070, 0x00840084, 0x006d0070, 0x00580058, 0x006c4824, 0x006c4824, 0x005c4020, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x005d4020, 0x006c4824, 0x006c4824, 0x006c4824, 0x00840084, 0x009c009c, 0x00840084, 0x005c4020, 0x00483818, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x00840084, 0x006c4824, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4021, 0x005d4020, 0x006c4824, 0x00840084, 0x00840084, 0x00744c28, 0x00744c28, 0x00744c28, 0x005c4020, 0x00483818, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0070, 0x00840084, 0x006c0070, 0x00403018,
-		0x00480048, 0x00400040, 0x00480048, 0x00382d14, 0x00480048, 0x00500050, 0x00500150, 0x00500050, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00500050, 0x00580058, 0x00500050, 0x00480048, 0x00400040, 0x00403018, 0x00580058, 0x006c0070, 0x00580058, 0x00580058, 0x00850084, 0x006c4824, 0x00543c1c, 0x005c4020, 0x005c4020, 0x00483818, 0x00553c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x006c0070, 0x00840084, 0x00840084, 0x005c4020, 0x00483818, 0x00500050, 0x00580058, 0x00580058, 0x006c0070, 0x006c4824, 0x006c4825, 0x005c4020, 0x005c4020, 0x00490048, 0x00500050, 0x00500050, 0x00580058, 0x006c0070, 0x006c0070, 0x005c4020, 0x00483818, 0x00580058, 0x005c4020, 0x00483818, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x00840084, 0x006c0070, 0x00403018,
-		0x00400040, 0x00400040, 0x00400040, 0x00382c14, 0x00480048, 0x00400040, 0x00480048, 0x00480048, 0x00500050, 0x00500051, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00490048, 0x00480048, 0x00403018, 0x00500050, 0x00580058, 0x00483818, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x005c4020, 0x00483818, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x005c4020, 0x006c4924, 0x00840084, 0x005c4020, 0x00483818, 0x00480048, 0x00500050, 0x00580058, 0x00580058, 0x006c4824, 0x005c4020, 0x006c0070, 0x00543c1c, 0x00500050, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x005c4020, 0x00483818, 0x006c0071, 0x005c4020, 0x00483819, 0x006c0070, 0x00840084, 0x00840084, 0x006c0070, 0x00580058, 0x006c0070, 0x00590058, 0x00580058,
-		0x00480048, 0x00400040, 0x00400040, 0x00400040, 0x00410040, 0x00480048, 0x00500150, 0x00500050, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00500050, 0x00500050, 0x00403018, 0x00382c14, 0x00483818, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00483818, 0x005c4020, 0x00483818, 0x005c4020, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483918, 0x00483818, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x00480048, 0x00500050, 0x00580058, 0x00543c1c, 0x00840084, 0x006c0070, 0x00483818, 0x00580058, 0x00483818, 0x005c4020, 0x005c4020, 0x00483818, 0x00403018, 0x005c4020, 0x00840084, 0x00840084, 0x006c0070, 0x00483818, 0x00840084, 0x00840084, 0x00543c1c, 0x005c4020, 0x00483818, 0x00580058, 0x00580058, 0x00413018,
-		0x00500050, 0x00400040, 0x00400040, 0x00382c14, 0x00480048, 0x00500050, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00580058, 0x00413018, 0x00483818, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00403018, 0x00382c14, 0x00493818, 0x00483818, 0x005c4020, 0x00483818, 0x00483818, 0x00480048, 0x00580058, 0x00580058, 0x006c0070, 0x006c0070, 0x00543c1c, 0x00543c1c, 0x005c4020, 0x005c4020, 0x00483818, 0x00403018, 0x00580058, 0x00483818, 0x006c0070, 0x00840084, 0x00483818, 0x006c0070, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00403018, 0x005c4020, 0x00840084, 0x006c0070, 0x006c0070, 0x00483818, 0x006c0070, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483918, 0x00580058, 0x00403018,
-		0x00480048, 0x00400040, 0x00480048, 0x00480048, 0x00500050, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x00840084, 0x006c0070, 0x00580058, 0x00483818, 0x005c4020, 0x00543c1c, 0x00403018, 0x00480048, 0x00382c14, 0x00403018, 0x00480048, 0x00483818, 0x00483818, 0x00413018, 0x00580058, 0x00840084, 0x006c0070, 0x006c0070, 0x00580058, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00483818, 0x00480048, 0x00403018, 0x00580158, 0x006c0070, 0x00483818, 0x00840084, 0x006c0070, 0x00483818, 0x00480048, 0x00483818, 0x00403018, 0x005c4020, 0x006c0070, 0x00580058, 0x00580058, 0x00403018, 0x00840084, 0x006c0070, 0x006c0070, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00500050, 0x00500050,
-		0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00500150, 0x006c0070, 0x00840084, 0x009c009c, 0x009c009c, 0x005c4020, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x006c4824, 0x00840084, 0x00580058, 0x00483818, 0x005c4020, 0x00403018, 0x00480049, 0x00480048, 0x00382c14, 0x00403018, 0x00480048, 0x00483818, 0x00483818, 0x00403019, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x00403018, 0x00403018, 0x00382c14, 0x00382c14, 0x00543c1c, 0x00483818, 0x00500050, 0x00403018, 0x00480048, 0x00580058, 0x00403018, 0x00840084, 0x006c0070, 0x00483818, 0x00480048, 0x00403018, 0x00403018, 0x00580058, 0x00580058, 0x006c0070, 0x00580058, 0x00403018, 0x006c0070, 0x00580058, 0x006d0070, 0x00483818, 0x00483818, 0x00483818, 0x00500050, 0x00500050,
-		0x00480048, 0x00480048, 0x00480048, 0x00480048, 0x00580058, 0x006c0070, 0x00840084, 0x009c009c, 0x009c009c, 0x006c4824, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0070, 0x00543c1c, 0x00543c1c, 0x006c0070, 0x00580058, 0x00483818, 0x005c4020, 0x00403018, 0x00480048, 0x00480048, 0x00490048, 0x00413018, 0x00480048, 0x00480048, 0x00580058, 0x00403018, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x00382c14, 0x00403018, 0x00382c14, 0x00480048, 0x00483818, 0x00403018, 0x00580058, 0x00580058, 0x00500050, 0x00480048, 0x00403018, 0x006c0070, 0x006c0071, 0x00403018, 0x00480048, 0x00483818, 0x00483818, 0x00580058, 0x00580058, 0x00840084, 0x00580058, 0x00403018, 0x00580058, 0x00580058, 0x00580058, 0x00483818, 0x00483818, 0x00483818, 0x00500050, 0x00500050,
-		0x00500050, 0x00480048, 0x00480048, 0x00500051, 0x00580058, 0x006c0071, 0x00850084, 0x009c009c, 0x00580058, 0x00543c1c, 0x006c0070, 0x00840084, 0x006c0070, 0x00840084, 0x006c0070, 0x00543c1c, 0x006c0070, 0x00580058, 0x00392c14, 0x00840084, 0x00840084, 0x00580058, 0x00580058, 0x00840084, 0x00403018, 0x00580058, 0x00840084, 0x00580058, 0x00403018, 0x00580058, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x00382c14, 0x00382c14, 0x00480048, 0x00500050, 0x00403018, 0x00382d14, 0x00500050, 0x00580058, 0x00500050, 0x00480048, 0x00403018, 0x00500050, 0x00500050, 0x00403018, 0x00500050, 0x00543c1c, 0x00543c1c, 0x00403018, 0x00580058, 0x00580058, 0x00580058, 0x00403018, 0x00580058, 0x006c0070, 0x00580058, 0x00580058, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00580058,
-		0x00500051, 0x00480048, 0x00480048, 0x00500051, 0x00580058, 0x006c0070, 0x00840084, 0x00543c1c, 0x00543c1c, 0x00403018, 0x00543c1c, 0x00543c1c, 0x00840084, 0x006c0070, 0x00840084, 0x00493818, 0x006c0070, 0x006c0070, 0x00382c14, 0x00580058, 0x00840084, 0x00840084, 0x00580058, 0x00580058, 0x00403018, 0x00580058, 0x00580058, 0x00580058, 0x00403018, 0x006c0070, 0x00580058, 0x006c0170, 0x00580058, 0x00480048, 0x00480048, 0x00382c14, 0x00500050, 0x006c0070, 0x00403018, 0x00382c14, 0x00480148, 0x006c0070, 0x00480048, 0x00500050, 0x00403018, 0x00580058, 0x00500050, 0x00500050, 0x00580058, 0x005c4020, 0x006c0070, 0x005c4020, 0x00403018, 0x00580058, 0x00580058, 0x00403018, 0x006c0070, 0x00580058, 0x00580058, 0x005c4020, 0x0080502c, 0x006c4824, 0x006c4824, 0x00543c1c,
-		0x00500050, 0x00480048, 0x00480048, 0x00500050, 0x00543c1c, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x00483818, 0x006c0070, 0x00840084, 0x00382c14, 0x00580058, 0x00580058, 0x00580158, 0x00580058, 0x00580058, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058, 0x00580058, 0x00480048, 0x00392c14, 0x006c0070, 0x00580058, 0x00403018, 0x00382c14, 0x00480048, 0x00500050, 0x00500150, 0x00580058, 0x00403018, 0x006c0070, 0x006c0070, 0x00580058, 0x00840084, 0x00543c1c, 0x00840084, 0x006c0070, 0x00403018, 0x00403018, 0x00580058, 0x00403018, 0x00580058, 0x00580058, 0x005c4020, 0x0080502c, 0x006c4824, 0x005c4020, 0x005c4020, 0x00840084,
-		0x00403018, 0x00500050, 0x00500050, 0x006c0070, 0x006c4824, 0x006c4824, 0x005c4020, 0x005c4020, 0x006c4824, 0x006c0070, 0x006c0070, 0x00840084, 0x00840084, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00580058, 0x00580058, 0x00840084, 0x00580058, 0x00403018, 0x00483818, 0x00483818, 0x00483818, 0x00493818, 0x00483818, 0x00483818, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00382c14, 0x00403018, 0x00580058, 0x00403018, 0x00382c14, 0x00480048, 0x006c0070, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00580058, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x006c4824, 0x0080502c, 0x005c4020, 0x006c0070, 0x00403018, 0x00403018,
-		0x00403018, 0x00403018, 0x00403018, 0x00840084, 0x006c4824, 0x00500050, 0x006c0070, 0x00840184, 0x00543c1c, 0x00840084, 0x00580058, 0x006c0070, 0x00403018, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00403018, 0x00403018, 0x005c4020, 0x00840084, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00403018, 0x00403018, 0x00382c14, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x00483818, 0x00483818, 0x00483819, 0x00543c1d, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x005c4020, 0x005d4020, 0x005c4020, 0x006c4824, 0x0080502c, 0x005c4020, 0x00483818, 0x00840084, 0x006c0070, 0x00403018,
-		0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x005c4020, 0x006c0070, 0x00840084, 0x00580058, 0x00483818, 0x00403018, 0x00403018, 0x00403018, 0x00483818, 0x005c4020, 0x005c4020, 0x006c4824, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x006c4824, 0x00744c28, 0x0080502c, 0x00744c28, 0x006c4824, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005d4020, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x005c4020, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x005c4020, 0x00483918, 0x00403018, 0x00403018, 0x00403018, 0x00403019,
-		0x00646464, 0x00484948, 0x00383838, 0x00403018, 0x00403018, 0x00403019, 0x00403018, 0x00403018, 0x00403118, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00383838, 0x00484848, 0x00646464, 0x00646464, 0x00545454, 0x00383838, 0x00403018, 0x00413018, 0x00403018, 0x00403018, 0x00403118, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403118, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00383838, 0x00484948, 0x00545454, 0x00545454, 0x00484848, 0x00383838, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403118, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403019, 0x00403018, 0x00383838, 0x00484848, 0x00646464};
-	// 'redbrick', 64x64px
-	const unsigned int redbrick[] = {
-		0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383938, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838,
-		0x00545454, 0x00383838, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00383838, 0x00484948, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383839,
-		0x00383838, 0x00ec0000, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00a40000, 0x00484848, 0x00484848, 0x00545454, 0x00ec0000, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00a40100, 0x00484848, 0x00383838, 0x00545454, 0x00ec0000, 0x00ec0000, 0x00ec0000, 0x00ec0000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00c80000, 0x00c80000, 0x00c90000, 0x00c80000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00a40000, 0x00484848,
-		0x00484848, 0x00ec0000, 0x00c80000, 0x00b00000, 0x00b00000, 0x00d40000, 0x00880000, 0x00a40000, 0x00d40000, 0x00880000, 0x00c80000, 0x00a40000, 0x00650000, 0x002c2c2c, 0x00484848, 0x00545454, 0x00ec0000, 0x00bc0000, 0x00880000, 0x00bc0000, 0x00880000, 0x00bc0000, 0x00880000, 0x00bc0000, 0x007c0000, 0x00bc0000, 0x00980000, 0x00bc0000, 0x00980000, 0x00bc0100, 0x007c0000, 0x00bc0000, 0x007c0000, 0x00bc0000, 0x00c80000, 0x00a40000, 0x00700000, 0x002c2c2c, 0x00484848, 0x00383838, 0x00d40000, 0x00a40000, 0x00c80000, 0x00b00000, 0x00c80000, 0x00b00001, 0x00b00000, 0x00c80000, 0x00700000, 0x00c80000, 0x007c0000, 0x00c80000, 0x00b00000, 0x00c80000, 0x00890000, 0x00b00000, 0x00a40000, 0x007c0000, 0x00c80000, 0x00980000, 0x00c80000, 0x00a40000, 0x007c0000, 0x002c2c2d,
-		0x00484848, 0x00d40000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00880000, 0x00a40000, 0x00980000, 0x00700000, 0x00a40000, 0x00880000, 0x00700000, 0x00640000, 0x002c2c2c, 0x00484848, 0x00545454, 0x00d40000, 0x00bc0000, 0x00880000, 0x00880000, 0x00a40000, 0x00880000, 0x00700000, 0x00a40000, 0x00a40000, 0x00700000, 0x00980000, 0x00a40000, 0x00a40000, 0x00700000, 0x00980000, 0x00a40000, 0x00700000, 0x00a40000, 0x00980000, 0x00700000, 0x00580000, 0x002c2c2c, 0x00484848, 0x00545454, 0x00d40000, 0x00a40000, 0x00a40000, 0x007c0000, 0x00640000, 0x00a40000, 0x00880000, 0x00700000, 0x00880000, 0x00a40000, 0x007c0000, 0x00880000, 0x00a40000, 0x00a40000, 0x00890000, 0x00a40000, 0x007c0000, 0x00880000, 0x00a40000, 0x00580000, 0x00a40000, 0x00700000, 0x00640000, 0x002c2c2c,
-		0x00484848, 0x00d40000, 0x007c0000, 0x00a40000, 0x00a40000, 0x00700000, 0x00980000, 0x00a40000, 0x00a40000, 0x00700000, 0x00a40000, 0x00580000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00545454, 0x00d40000, 0x00880000, 0x00bc0000, 0x00a40000, 0x00880000, 0x00a40000, 0x00700000, 0x00a40000, 0x00880000, 0x00a40000, 0x00700000, 0x00a40000, 0x00700000, 0x00880000, 0x007c0000, 0x00a40000, 0x00700000, 0x00980000, 0x007c0000, 0x00700000, 0x00580000, 0x002c2c2c, 0x00484848, 0x00484948, 0x00d40001, 0x00700000, 0x00a40000, 0x00640000, 0x00880000, 0x00a40000, 0x00640000, 0x00a40000, 0x00700000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00880000, 0x00a40000, 0x00640000, 0x00a40000, 0x00980000, 0x007c0000, 0x00a40100, 0x007c0000, 0x00a40000, 0x00700000, 0x004c0000, 0x002c2c2c,
-		0x00484848, 0x00c80000, 0x00a40000, 0x007c0000, 0x00880000, 0x00980000, 0x007c0000, 0x00a40000, 0x00700000, 0x00880000, 0x00a40000, 0x00700000, 0x00400000, 0x002c2c2c, 0x00484849, 0x00545454, 0x00bc0000, 0x00bc0000, 0x00880000, 0x00a40000, 0x00880000, 0x00880000, 0x00980000, 0x00a40000, 0x00700000, 0x00880000, 0x00700000, 0x00a40000, 0x00880000, 0x00700000, 0x00980000, 0x007c0000, 0x00880000, 0x00700000, 0x00a40000, 0x00700000, 0x00400000, 0x002c2c2c, 0x00383838, 0x00484848, 0x00bc0000, 0x00700000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00880000, 0x00640000, 0x00a40000, 0x00700000, 0x00700000, 0x00a40000, 0x00a40000, 0x00700000, 0x00a40000, 0x00880000, 0x00a40000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00580000, 0x00a40000, 0x00880000, 0x004c0000, 0x002c2c2c,
-		0x00484848, 0x00bc0000, 0x007c0000, 0x00a40000, 0x00a40000, 0x00700000, 0x00a40000, 0x00980100, 0x00700000, 0x00980000, 0x00700000, 0x00580001, 0x00400000, 0x002c2c2c, 0x00484848, 0x00484848, 0x00bc0000, 0x00c80000, 0x00880000, 0x00a50000, 0x00700000, 0x00a40000, 0x00700000, 0x00a40000, 0x00700000, 0x00a40000, 0x00700000, 0x00980100, 0x00880000, 0x00700000, 0x007c0000, 0x00a40000, 0x00700000, 0x00980000, 0x007c0000, 0x00700000, 0x00580000, 0x002c2c2c, 0x00383838, 0x00484848, 0x00bc0000, 0x00980000, 0x00a40000, 0x00640000, 0x00880000, 0x00a40000, 0x007c0000, 0x00880000, 0x00700000, 0x00880000, 0x007c0000, 0x00a40000, 0x00880000, 0x00a40000, 0x00640000, 0x00a40000, 0x007c0000, 0x00880000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00700000, 0x00400100, 0x002c2c2c,
-		0x00484848, 0x00bc0000, 0x00a40100, 0x00700000, 0x00880000, 0x00580000, 0x00700000, 0x007c0000, 0x00580000, 0x00700000, 0x00880000, 0x00700000, 0x00400000, 0x002c2c2c, 0x00383838, 0x00545454, 0x00980000, 0x00980000, 0x00700000, 0x00700000, 0x004c0000, 0x00880000, 0x00700000, 0x00700000, 0x00880000, 0x00700000, 0x004c0000, 0x00700100, 0x00880000, 0x00700000, 0x00880000, 0x00700000, 0x004c0000, 0x00880000, 0x00700000, 0x00700001, 0x00400000, 0x002c2c2c, 0x00383838, 0x00484848, 0x00bc0000, 0x00700000, 0x00700000, 0x00580000, 0x00700000, 0x00700000, 0x004c0000, 0x00880000, 0x004c0000, 0x00700000, 0x00580000, 0x00880000, 0x004c0001, 0x00700000, 0x004c0000, 0x00880000, 0x00640000, 0x004c0000, 0x00700000, 0x00880000, 0x00700000, 0x00880000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x007c0000, 0x00640000, 0x00640000, 0x00640000, 0x00400000, 0x00400000, 0x00400000, 0x00400000, 0x00400000, 0x00400000, 0x00400000, 0x00400000, 0x002c2c2c, 0x00383838, 0x00484848, 0x007c0000, 0x00640000, 0x00640000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00400000, 0x00400000, 0x00400000, 0x00400000, 0x00400000, 0x00400000, 0x00400000, 0x00400000, 0x00400000, 0x002c2c2c, 0x00383838, 0x00484848, 0x00880000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00580000, 0x00580000, 0x00590000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00400000, 0x00400000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00484848, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x00383838, 0x00545454, 0x00484848, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00484848, 0x00545454, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202120, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c,
-		0x00545454, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00484948, 0x00383838, 0x00484948, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484849, 0x00484848, 0x00545454, 0x00383838, 0x00484848, 0x00555454, 0x00545454, 0x00545454, 0x00545454, 0x005c5d5c, 0x00646464, 0x00646464, 0x005c5c5c, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00404040, 0x00383838, 0x00404040, 0x00545454, 0x00383838, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00383838,
-		0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40100, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00a40000, 0x00484848, 0x00545454, 0x00484848, 0x00ec0000, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00c80100, 0x00c80000, 0x00c80100, 0x00c80000, 0x00c80000, 0x00c80000, 0x00c80000, 0x00bc0001, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00a40000, 0x00484848, 0x00404040, 0x00545454, 0x00ec0000, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000,
-		0x00b00000, 0x00880000, 0x00880000, 0x00b00000, 0x00980000, 0x007c0000, 0x00b00000, 0x007c0000, 0x00980000, 0x00880000, 0x00b00000, 0x00640000, 0x00b00000, 0x00880000, 0x00a40000, 0x00400000, 0x00383838, 0x00484848, 0x00545454, 0x00ec0000, 0x00700000, 0x00b00000, 0x00c80000, 0x007c0000, 0x00bc0000, 0x00640000, 0x00880000, 0x00bc0000, 0x00880000, 0x00880000, 0x00c80000, 0x00980000, 0x00a40000, 0x00880000, 0x007c0000, 0x00890000, 0x00a40000, 0x00880000, 0x00a40000, 0x00880000, 0x00a40000, 0x007c0000, 0x00c80000, 0x00640000, 0x00c80000, 0x00880000, 0x00980000, 0x00bc0000, 0x00c80000, 0x00980000, 0x00c80000, 0x00a40000, 0x00400100, 0x00383838, 0x00484848, 0x00383838, 0x00ec0000, 0x00c80000, 0x007c0000, 0x00b00000, 0x00880000, 0x00b00000, 0x00880000, 0x00b00000,
-		0x00880000, 0x00a40000, 0x00880000, 0x00a40000, 0x007d0000, 0x00880000, 0x00880000, 0x00640000, 0x00a40000, 0x00890000, 0x00640000, 0x00880000, 0x00a40000, 0x00a40000, 0x00700001, 0x00400000, 0x002c2c2c, 0x00484848, 0x00484848, 0x00d40000, 0x00b00000, 0x00700000, 0x00a40000, 0x007c0001, 0x00a40000, 0x00a40000, 0x00880000, 0x00a40000, 0x00640000, 0x00a40000, 0x00700000, 0x00640000, 0x00880000, 0x00a50000, 0x007c0000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00650000, 0x00a40000, 0x00a40000, 0x00890000, 0x00640000, 0x00a40000, 0x00880000, 0x00a40000, 0x00700000, 0x00880000, 0x00a40000, 0x00700000, 0x00a40000, 0x00700000, 0x00400000, 0x00383838, 0x00484849, 0x00545454, 0x00c80000, 0x00b00000, 0x007c0000, 0x00a40000, 0x00880000, 0x007c0000, 0x00a40000, 0x00980000,
-		0x00700000, 0x00a40000, 0x00a40000, 0x00880000, 0x00980000, 0x00640000, 0x00a40000, 0x007c0000, 0x00880000, 0x00880000, 0x00980000, 0x00640000, 0x00a40000, 0x00880000, 0x00700000, 0x00400000, 0x002c2c2c, 0x00383838, 0x00484848, 0x00d40000, 0x00700000, 0x00a40000, 0x00880000, 0x00980000, 0x00880100, 0x00880000, 0x00640000, 0x00880000, 0x00880000, 0x00700000, 0x00a40000, 0x00880000, 0x00640000, 0x00a40000, 0x00880000, 0x007c0000, 0x00640000, 0x007c0000, 0x00880000, 0x00880000, 0x00a40000, 0x00590000, 0x00880000, 0x007c0000, 0x00a40000, 0x00700000, 0x00a40000, 0x00700000, 0x00a40000, 0x00a40000, 0x00700000, 0x00700000, 0x00400000, 0x002c2c2c, 0x00404040, 0x00484848, 0x00c80000, 0x007c0000, 0x00a40000, 0x00a40000, 0x00a40000, 0x007c0000, 0x00a40000, 0x007c0000,
-		0x00a40000, 0x00880000, 0x00880000, 0x00a40000, 0x00880000, 0x007c0001, 0x007c0000, 0x00880000, 0x007c0000, 0x00a40000, 0x00980000, 0x00640000, 0x00a40000, 0x00640000, 0x00700000, 0x00400000, 0x002c2c2c, 0x00383838, 0x00484848, 0x00d40000, 0x00700000, 0x00a40000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00640000, 0x00880000, 0x00a40000, 0x00640000, 0x00700000, 0x00a40000, 0x00640000, 0x00880000, 0x00a40000, 0x007c0000, 0x00880000, 0x007c0000, 0x00a40000, 0x00640000, 0x00a40000, 0x00880000, 0x00580000, 0x00a40000, 0x00640000, 0x00a40000, 0x00700000, 0x00880100, 0x00700000, 0x00a40000, 0x00700000, 0x00a40000, 0x00700000, 0x00400000, 0x002c2c2c, 0x00383838, 0x00484848, 0x00c80000, 0x00b00000, 0x007c0000, 0x00a40001, 0x007c0000, 0x00a40000, 0x00980000, 0x007c0000,
-		0x00700000, 0x00a40000, 0x00640000, 0x00a40000, 0x00700000, 0x00880000, 0x007c0100, 0x00980000, 0x00640000, 0x00a40000, 0x00640000, 0x00880000, 0x00a40000, 0x00a40000, 0x00700000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00545454, 0x00d40000, 0x00b00000, 0x00590000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00880000, 0x00640000, 0x00880000, 0x00580000, 0x00880000, 0x00700000, 0x00640000, 0x00a40100, 0x00880000, 0x007c0000, 0x00580000, 0x007c0000, 0x00a40000, 0x00640000, 0x00880000, 0x00580000, 0x00880000, 0x00a40000, 0x00640000, 0x00880000, 0x00a40000, 0x00700000, 0x00880000, 0x00a40000, 0x00700000, 0x00a40000, 0x00700000, 0x00400000, 0x00202020, 0x00383838, 0x00484848, 0x00b00000, 0x007c0000, 0x00a40000, 0x00a40000, 0x00580000, 0x00a40000, 0x007c0000, 0x00880000,
-		0x00700000, 0x00b00000, 0x00640000, 0x00700000, 0x004c0000, 0x007c0000, 0x00700000, 0x00980000, 0x00700000, 0x00980000, 0x00700000, 0x00580000, 0x00980001, 0x00700000, 0x00700000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00545454, 0x00b00000, 0x00a40000, 0x00700000, 0x00880000, 0x00580001, 0x00700000, 0x00980000, 0x00700000, 0x00880001, 0x00640000, 0x00700000, 0x00880000, 0x00580000, 0x00700000, 0x00980000, 0x00700000, 0x00980000, 0x00650000, 0x00880000, 0x00700000, 0x00880000, 0x00880000, 0x00580000, 0x00980000, 0x00700000, 0x00700000, 0x00880000, 0x004c0000, 0x00700000, 0x00980000, 0x00700000, 0x00880000, 0x00700000, 0x00400000, 0x00202020, 0x00404040, 0x00545454, 0x00b00000, 0x00a40000, 0x007c0000, 0x00700000, 0x00580000, 0x00700000, 0x00980000, 0x00700000,
-		0x00400000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x00400000, 0x00400000, 0x00400000, 0x00383838, 0x00484848, 0x00545454, 0x00a40000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00650000, 0x00640000, 0x00650000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580100, 0x00580000, 0x00580000, 0x00580000, 0x00580100, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00400000, 0x00400000, 0x00202020, 0x00484848, 0x00383838, 0x00a40000, 0x00640100, 0x00400000, 0x00640000, 0x00400000, 0x00400000, 0x00640000, 0x00400000,
-		0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x00383838, 0x00484848, 0x00383838, 0x00484848, 0x00383838, 0x00343434, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00343434, 0x00343434, 0x00383838, 0x00383838, 0x00343434, 0x002d2c2c, 0x002c2c2c, 0x002d2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202021, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00212020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00484848, 0x00545454, 0x00494848, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c,
-		0x00545454, 0x00545454, 0x00484848, 0x00383838, 0x00383838, 0x00484848, 0x00545454, 0x00383838, 0x00545454, 0x00383838, 0x00484848, 0x00484948, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00404040, 0x00383838, 0x00404040, 0x00383838, 0x00404040, 0x00383838, 0x00404040, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00383838, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x00383838, 0x00383838, 0x00404040, 0x00414040, 0x00484848, 0x00484848, 0x00545454, 0x00404040, 0x00383838, 0x00383838, 0x00404040, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00545454, 0x00383838, 0x00545454, 0x00404040, 0x00383838, 0x00404040, 0x00545454, 0x00484848, 0x00484848, 0x00484848,
-		0x00545454, 0x00ec0000, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00bc0000, 0x00bc0100, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0001, 0x00bc0000, 0x00a40000, 0x00484948, 0x00545554, 0x00545454, 0x00ec0000, 0x00ec0001, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40100, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00bc0000, 0x00bd0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00a40000, 0x00484848,
-		0x00545454, 0x00ec0000, 0x00880000, 0x00b00000, 0x00bc0000, 0x007c0000, 0x00bc0000, 0x007c0000, 0x00bc0000, 0x007c0001, 0x00b00000, 0x00880001, 0x00b00000, 0x00880000, 0x00b00000, 0x00c80000, 0x00880000, 0x00b00000, 0x00880000, 0x00b10000, 0x00880000, 0x00bc0000, 0x00b00000, 0x00640000, 0x00b00000, 0x00c80000, 0x00700000, 0x00400000, 0x00383838, 0x00484848, 0x00545454, 0x00ec0000, 0x00bc0000, 0x00700000, 0x00d40000, 0x00a40000, 0x00b00000, 0x00880000, 0x00a40000, 0x00b00000, 0x00880000, 0x00b00000, 0x00980000, 0x00b00000, 0x007c0000, 0x00640000, 0x00a40000, 0x00880000, 0x00700000, 0x00880000, 0x00a40000, 0x007c0000, 0x00880000, 0x00a40000, 0x00980000, 0x00880000, 0x00a40000, 0x007c0000, 0x00880000, 0x00a40000, 0x00580000, 0x00a40000, 0x00400000, 0x002c2c2c,
-		0x00383838, 0x00ec0000, 0x00b00000, 0x00880000, 0x00a40000, 0x00980000, 0x00a40000, 0x007c0000, 0x00700000, 0x00880000, 0x00a40000, 0x00a40000, 0x00880000, 0x00980000, 0x00880000, 0x00a40000, 0x00880000, 0x00640000, 0x00a40000, 0x00700000, 0x00a40000, 0x00880000, 0x00640000, 0x00880000, 0x00a40000, 0x00700000, 0x00b00000, 0x00400000, 0x002c2c2c, 0x00484848, 0x005c5c5c, 0x00d40000, 0x00bc0000, 0x00980000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640000, 0x00880000, 0x00700000, 0x00980000, 0x00880000, 0x00640000, 0x00a40000, 0x00640000, 0x00880000, 0x00a40000, 0x00640000, 0x00a40000, 0x00710000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00880000, 0x00a40000, 0x00640000, 0x00a40000, 0x00980000, 0x007c0100, 0x00a40000, 0x007c0000, 0x00700000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00bc0000, 0x00640000, 0x00a40000, 0x00a40000, 0x00700000, 0x00880000, 0x00580000, 0x00a40000, 0x00640000, 0x00a40000, 0x00700000, 0x00a40000, 0x00880000, 0x00980000, 0x00a40000, 0x00640000, 0x00880000, 0x00a40000, 0x00700000, 0x00880000, 0x00a40000, 0x00880000, 0x00640000, 0x007c0000, 0x00a40000, 0x00700000, 0x00400000, 0x002c2c2c, 0x00545454, 0x00646464, 0x00d40000, 0x00bc0000, 0x007c0000, 0x00a40000, 0x007c0001, 0x00a40000, 0x00650000, 0x00a40000, 0x00700000, 0x00980000, 0x00a40000, 0x007c0000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00880000, 0x00640000, 0x00a40000, 0x00700000, 0x00700000, 0x00a40000, 0x00980000, 0x00700000, 0x00980000, 0x00880000, 0x00a40000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00580000, 0x00700000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00bc0000, 0x00b00000, 0x00880000, 0x00a40000, 0x004c0000, 0x00a40000, 0x00580000, 0x00700000, 0x00880000, 0x00a40000, 0x00880000, 0x00700000, 0x007c0000, 0x00a40000, 0x007c0000, 0x00880000, 0x00640000, 0x007c0000, 0x00a40000, 0x00640000, 0x00a40000, 0x00880000, 0x00640000, 0x00a40000, 0x00700000, 0x00580000, 0x00400000, 0x002c2c2c, 0x00545454, 0x005c5c5c, 0x00d40000, 0x00700000, 0x00a40000, 0x00700000, 0x00980000, 0x00880000, 0x00640000, 0x00880000, 0x00980000, 0x00700000, 0x00a40000, 0x00640000, 0x00880000, 0x00640000, 0x00880000, 0x00a40000, 0x007c0000, 0x00880000, 0x00700100, 0x00880000, 0x007c0000, 0x00a40000, 0x00880001, 0x00a40000, 0x00640000, 0x00a40000, 0x007c0000, 0x00880000, 0x00a40000, 0x007c0000, 0x00710000, 0x00400000, 0x002c2c2c,
-		0x00545454, 0x00bc0000, 0x00700000, 0x00640000, 0x00a40000, 0x004c0000, 0x00890000, 0x007c0000, 0x00a40000, 0x00640000, 0x00a40000, 0x00590000, 0x00a40000, 0x00640000, 0x00a40000, 0x00880000, 0x00640000, 0x00880000, 0x00a40000, 0x00880000, 0x00640000, 0x00a40000, 0x00640001, 0x00880000, 0x007c0000, 0x007c0001, 0x00b00000, 0x00400000, 0x002c2d2c, 0x00484848, 0x00545454, 0x00d40000, 0x00c80000, 0x00700000, 0x00a40000, 0x00700000, 0x00a40000, 0x00880100, 0x00a40000, 0x00880000, 0x00710000, 0x00a50000, 0x00640000, 0x00a40000, 0x00580000, 0x00700000, 0x00700000, 0x004c0000, 0x00a40000, 0x004c0000, 0x00a40000, 0x00580000, 0x00a40000, 0x004c0000, 0x00a40000, 0x00a40000, 0x00880000, 0x00640000, 0x004c0000, 0x00700000, 0x00880000, 0x00700000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00c80000, 0x00a40000, 0x00640000, 0x00700000, 0x00700000, 0x00700000, 0x00580000, 0x00700000, 0x004c0000, 0x00700000, 0x00700000, 0x00880000, 0x00640000, 0x00880000, 0x00700000, 0x00700000, 0x00880000, 0x00700000, 0x00710000, 0x00640000, 0x00700000, 0x00980000, 0x00700000, 0x00980000, 0x00700000, 0x00700000, 0x00400000, 0x002c2d2c, 0x00383838, 0x00545454, 0x00c80000, 0x00a40000, 0x00700000, 0x00980000, 0x00700000, 0x00880001, 0x00580000, 0x00700000, 0x00700000, 0x00700000, 0x00700000, 0x00640000, 0x00880100, 0x00700000, 0x00880001, 0x004c0100, 0x00a40000, 0x00580000, 0x00700000, 0x00a40000, 0x004c0000, 0x00700000, 0x00880000, 0x004d0000, 0x00a40000, 0x00580000, 0x00a40000, 0x004c0100, 0x00a40000, 0x00700000, 0x00700000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00a40100, 0x00980001, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640001, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0100, 0x004c0000, 0x004c0000, 0x004c0000, 0x00400000, 0x00400000, 0x002c2c2c, 0x00383838, 0x00545454, 0x00a40000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00650000, 0x00640000, 0x00640100, 0x00580000, 0x00580001, 0x00580100, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00400000, 0x00580000, 0x007c0000, 0x00580000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00484848, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00484848, 0x00484848, 0x00484848, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x00383838, 0x00383838, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2d2c, 0x002c2c2c, 0x002c2c2c,
-		0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00383838, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00545454, 0x00646464, 0x00646464, 0x00545454, 0x00545454, 0x00545455, 0x00484848, 0x00484848, 0x00484848, 0x00404040, 0x00404040, 0x00383838, 0x00383838, 0x00404040, 0x00383838, 0x00383838, 0x00404041, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00383838, 0x00545454, 0x00484848, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x00414040, 0x00383838, 0x00404040, 0x00484848, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00404040, 0x00383838, 0x00404040, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00393838, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00383838,
-		0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00a40000, 0x00484948, 0x00383838, 0x00545454, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00a40000, 0x00484848, 0x00545554, 0x00545454, 0x00c80000, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0001,
-		0x00a50000, 0x00b00000, 0x00a40000, 0x00b00000, 0x00980000, 0x00c80000, 0x00b00000, 0x00b00000, 0x00c80000, 0x00a40000, 0x00400000, 0x00383838, 0x00484848, 0x00383838, 0x00d40000, 0x00a40000, 0x00640000, 0x00a40000, 0x00700000, 0x00a40000, 0x00a40000, 0x00640000, 0x00a40000, 0x00880000, 0x00a40000, 0x00a40000, 0x00700000, 0x00a40000, 0x00880000, 0x00640000, 0x00a40000, 0x00a40000, 0x00640000, 0x00a40000, 0x00a40000, 0x00700000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00400000, 0x00383838, 0x00484848, 0x00545454, 0x00d40000, 0x00a40000, 0x007c0000, 0x00a40001, 0x00700000, 0x00a40000, 0x00a40000, 0x00640000, 0x00a40000, 0x007c0000, 0x00880000, 0x007c0000, 0x00a40000, 0x00700000, 0x00a40000, 0x00880000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00700000, 0x00a40000,
-		0x00a40000, 0x007c0000, 0x00880000, 0x00a40000, 0x00980000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00880000, 0x00700000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00545454, 0x00d40000, 0x00640000, 0x00a40000, 0x007c0000, 0x00880000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00980000, 0x00700000, 0x00a40000, 0x00880000, 0x00880000, 0x00710000, 0x00880000, 0x00880000, 0x00a40000, 0x00880000, 0x00640000, 0x00a40000, 0x00700000, 0x00880000, 0x00a40000, 0x00640000, 0x00a40000, 0x00400000, 0x00383838, 0x00545454, 0x00545454, 0x00d40000, 0x00a40000, 0x00580000, 0x00a40000, 0x00700000, 0x00a40000, 0x00880000, 0x00640000, 0x00a50000, 0x00880000, 0x00a40000, 0x007c0000, 0x00880000, 0x00880000, 0x00980000, 0x00700000, 0x00980000, 0x007c0000, 0x00980000, 0x00880000, 0x00700000,
-		0x00880001, 0x007c0000, 0x00a40000, 0x00980000, 0x007c0000, 0x00a40000, 0x007c0000, 0x00980100, 0x00a40000, 0x00700000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00383838, 0x00d40000, 0x00640000, 0x00a40000, 0x00a40000, 0x007c0000, 0x00980100, 0x00a40000, 0x00700000, 0x00a40000, 0x00700000, 0x00a40000, 0x00880000, 0x00a40000, 0x00580000, 0x00a40000, 0x004c0000, 0x00880000, 0x00880000, 0x00a40000, 0x00880000, 0x00700000, 0x00980000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00400000, 0x00383838, 0x00555454, 0x00646464, 0x00d40000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00700000, 0x00a40000, 0x00880000, 0x00a40000, 0x00880000, 0x00a40000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00700000, 0x00980000, 0x00880000, 0x00a40000, 0x00980000, 0x007c0000, 0x00a40000, 0x00700000,
-		0x00a40000, 0x00880000, 0x007c0000, 0x00a40000, 0x00980000, 0x00a40000, 0x00980000, 0x007c0000, 0x00880000, 0x00700000, 0x00400000, 0x00383838, 0x00484848, 0x00555455, 0x00d40000, 0x00980000, 0x00640000, 0x00a40100, 0x007c0000, 0x00a40000, 0x007c0000, 0x00580001, 0x00980000, 0x00880000, 0x00880000, 0x00880000, 0x00700000, 0x00880000, 0x00a40000, 0x00640000, 0x00a40000, 0x00880000, 0x00640000, 0x00880000, 0x00980000, 0x00700000, 0x00880000, 0x00a40000, 0x007c0000, 0x00400000, 0x00383838, 0x00545454, 0x00646464, 0x00d40000, 0x007c0000, 0x00a40000, 0x00a40000, 0x00700000, 0x00a40000, 0x00640000, 0x00a40000, 0x00a40000, 0x007c0000, 0x007c0000, 0x00a40100, 0x007c0000, 0x00a40000, 0x00880000, 0x00980000, 0x00980000, 0x00880000, 0x007c0000, 0x00700000, 0x00880000,
-		0x00a40000, 0x00880000, 0x007c0000, 0x00a40000, 0x007c0000, 0x00a40000, 0x007c0000, 0x00980000, 0x00a40000, 0x00700100, 0x00400000, 0x00383838, 0x00484848, 0x00484848, 0x00d40001, 0x00640000, 0x00a40000, 0x007c0000, 0x00580000, 0x00980000, 0x00a40000, 0x00700000, 0x00880000, 0x00880000, 0x00a40000, 0x00880000, 0x00a40100, 0x00700000, 0x00880000, 0x004c0000, 0x00640000, 0x00980000, 0x00640000, 0x00a40000, 0x00980000, 0x00700000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00400000, 0x00383838, 0x00484848, 0x00545454, 0x00c80000, 0x00a40000, 0x007c0100, 0x00a40000, 0x00a40000, 0x00700000, 0x00a40000, 0x00880000, 0x00880000, 0x007c0000, 0x00a40000, 0x007c0001, 0x00a40000, 0x00700000, 0x00980000, 0x00880000, 0x00a40000, 0x007c0000, 0x00880100, 0x00a40000, 0x00700000,
-		0x00700000, 0x00700000, 0x00880000, 0x00980000, 0x00700000, 0x00700000, 0x00980000, 0x00700000, 0x00700000, 0x00700000, 0x00400000, 0x00383838, 0x00484848, 0x00484848, 0x00980000, 0x00640000, 0x00a40000, 0x00a40000, 0x00580000, 0x00a40000, 0x007c0000, 0x00700000, 0x00a40000, 0x00700100, 0x00a40000, 0x00640000, 0x00a40000, 0x00580000, 0x00880000, 0x00640000, 0x00a40000, 0x00880000, 0x00640000, 0x00980000, 0x00700000, 0x00980000, 0x00a40000, 0x00640000, 0x007c0000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00545454, 0x00c80000, 0x00a40000, 0x00590000, 0x00a40000, 0x00700000, 0x00a40000, 0x00a50000, 0x00880001, 0x00a40000, 0x00880000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00700000, 0x00980000, 0x00700000, 0x00980000, 0x007c0000, 0x00a40000, 0x00a40000, 0x00700000,
-		0x00400000, 0x00400000, 0x004c0001, 0x004c0000, 0x004c0100, 0x004c0000, 0x004c0000, 0x004c0001, 0x004c0000, 0x00400000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00484848, 0x00a40000, 0x00640000, 0x00640100, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640100, 0x00640000, 0x00640000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00400000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00484848, 0x00a40000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640100, 0x00640000, 0x00640100, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00580000, 0x00580000, 0x00580000, 0x00580000, 0x00400000,
-		0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00484848, 0x00545454, 0x00484848, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00383839, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202120, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00383838, 0x00484848, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c,
-		0x00545454, 0x00484848, 0x00545454, 0x00383838, 0x00484848, 0x00383838, 0x00393838, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00484849, 0x00484948, 0x00383838, 0x00383838, 0x00383838, 0x00484849, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00383838, 0x00484849, 0x00383838, 0x00484848, 0x00383838, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00545454, 0x00383838, 0x00545454, 0x00484848, 0x00545454, 0x005c5c5c, 0x00646464, 0x00545454, 0x004c4c4c, 0x00484848, 0x00484848, 0x00383839, 0x00545454, 0x00484848, 0x00545454, 0x00484848, 0x00545454, 0x00383938, 0x00545454, 0x00383838,
-		0x00383838, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bd0000, 0x00bc0000, 0x00bc0000, 0x00a40000, 0x00383838, 0x00545454, 0x00383838, 0x00ec0000, 0x00ec0000, 0x00d40001, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bd0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00a40000, 0x00484848,
-		0x00545454, 0x00d40000, 0x00a40000, 0x00880000, 0x00880000, 0x00a40001, 0x00640000, 0x00a40000, 0x00a40000, 0x007c0000, 0x00980000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00700000, 0x00880000, 0x00a40000, 0x00640000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00880000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640000, 0x00a40001, 0x00a40000, 0x007c0000, 0x00700000, 0x00a40000, 0x00400000, 0x00383838, 0x00494848, 0x00545454, 0x00ec0000, 0x00a40000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640000, 0x00a40000, 0x00580000, 0x00a40000, 0x00700000, 0x00a40000, 0x00580000, 0x00a40000, 0x00880000, 0x00580000, 0x00980000, 0x00880000, 0x00700000, 0x00a40000, 0x00880000, 0x007c0000, 0x00a40000, 0x007c0000, 0x00980000, 0x00700000, 0x00880000, 0x00a40000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00d40000, 0x00a40000, 0x00640000, 0x00a40000, 0x00880000, 0x00640000, 0x00a40000, 0x00880000, 0x00980000, 0x007c0000, 0x00a40000, 0x00640000, 0x00880000, 0x00580000, 0x00a40000, 0x00980000, 0x00640000, 0x00a40000, 0x00580000, 0x00880000, 0x00980000, 0x00880000, 0x00640000, 0x00a40100, 0x007c0000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00700000, 0x00980000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00484848, 0x00d40000, 0x00880000, 0x00a40000, 0x00640000, 0x00880000, 0x00640000, 0x007c0000, 0x00580000, 0x00880000, 0x00580000, 0x00980000, 0x007c0000, 0x00a50000, 0x00580000, 0x00a40000, 0x00640000, 0x00a40000, 0x00700000, 0x00880000, 0x00700000, 0x00a40000, 0x00880001, 0x007c0000, 0x00980000, 0x00a40000, 0x00640000, 0x00880000, 0x00400000, 0x002c2c2c,
-		0x00484848, 0x00d40000, 0x00880000, 0x00640000, 0x00a40000, 0x00640000, 0x00880000, 0x00700000, 0x00640000, 0x00a40000, 0x00640100, 0x00a40000, 0x00880000, 0x007c0000, 0x00880000, 0x00a40100, 0x00640000, 0x00980000, 0x00880000, 0x00880000, 0x00580000, 0x007c0000, 0x00a40000, 0x004c0000, 0x00980000, 0x00580000, 0x00880100, 0x00640000, 0x00880000, 0x00880000, 0x00710000, 0x00400000, 0x002c2c2c, 0x00383838, 0x00484848, 0x00d40000, 0x00880000, 0x00a50000, 0x00640000, 0x00640000, 0x00880000, 0x00a40000, 0x007c0000, 0x00580100, 0x00a40000, 0x007c0000, 0x00580100, 0x00980000, 0x00a40000, 0x00580000, 0x00a40001, 0x00700000, 0x00700000, 0x00a40000, 0x00700000, 0x00a40000, 0x007c0000, 0x00a40001, 0x00700000, 0x00880100, 0x00640000, 0x00a40000, 0x00400000, 0x002c2c2c,
-		0x00383838, 0x00d40000, 0x00a40000, 0x00880000, 0x00a40000, 0x00880000, 0x00650000, 0x00a40000, 0x00880000, 0x007c0000, 0x00980000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00580000, 0x00880000, 0x00a40000, 0x00640000, 0x00a40000, 0x00580000, 0x00880000, 0x00a40000, 0x00580100, 0x00980000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00a40000, 0x00a40000, 0x00700000, 0x007c0000, 0x00400000, 0x002d2c2c, 0x00383838, 0x00484848, 0x00d40000, 0x00a40000, 0x00640000, 0x00a40000, 0x00880100, 0x00640000, 0x00a40000, 0x00580000, 0x00a40000, 0x00700000, 0x00980000, 0x007c0000, 0x007c0000, 0x00580000, 0x00880000, 0x00640000, 0x00a40000, 0x007c0000, 0x00880000, 0x00980000, 0x00880001, 0x00980000, 0x007c0000, 0x00700000, 0x00a40000, 0x00880000, 0x00a40100, 0x00400000, 0x002c2c2c,
-		0x00545454, 0x00d40000, 0x00a40000, 0x00640000, 0x00880000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640000, 0x00a40000, 0x00700000, 0x00a40000, 0x00640000, 0x00640000, 0x00a40001, 0x00590000, 0x00880000, 0x007c0000, 0x00a40000, 0x007c0000, 0x00880000, 0x00640000, 0x00980000, 0x00640000, 0x00880000, 0x00700000, 0x00a40001, 0x00400000, 0x00202020, 0x00383838, 0x00545454, 0x00d40000, 0x00a40000, 0x00640000, 0x00640000, 0x00a40000, 0x00640000, 0x007c0000, 0x00580000, 0x00a40000, 0x00580000, 0x00a40000, 0x00580100, 0x00980000, 0x00580000, 0x00a40000, 0x00640000, 0x00880000, 0x00700000, 0x00a40000, 0x00700000, 0x007c0000, 0x00a40000, 0x007c0000, 0x00980000, 0x00880000, 0x00640000, 0x00700000, 0x00400000, 0x002c2c2c,
-		0x00383838, 0x00c80000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640000, 0x00880000, 0x00700000, 0x00880000, 0x00980000, 0x007c0000, 0x00a40000, 0x00880000, 0x00880000, 0x00890000, 0x00a40000, 0x00980000, 0x00640000, 0x00880000, 0x007c0000, 0x00580000, 0x00640000, 0x00a40000, 0x004c0000, 0x00a40000, 0x00700000, 0x00980000, 0x007c0000, 0x00a40000, 0x00700000, 0x00a40000, 0x00400000, 0x00212020, 0x00383838, 0x00545454, 0x00c80000, 0x00700000, 0x00a40000, 0x00640000, 0x00880000, 0x00640000, 0x00a40000, 0x00580000, 0x007c0000, 0x00a40000, 0x007c0000, 0x00580000, 0x00980000, 0x00700000, 0x00880000, 0x00640000, 0x00a40100, 0x00700000, 0x00a40000, 0x00700000, 0x00a40000, 0x007c0000, 0x00980000, 0x00700000, 0x00a40000, 0x00640000, 0x00a40000, 0x00400000, 0x002c2c2c,
-		0x00545454, 0x00a40000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0100, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00545454, 0x00a50000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00640000, 0x00580000, 0x00590000, 0x00580000, 0x00580000, 0x00580000, 0x004c0001, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x00400000, 0x00400000, 0x002c2c2c,
-		0x00383838, 0x00484848, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002d2c2c, 0x002c2c2c, 0x002c2d2c, 0x002c2c2c, 0x00383838, 0x00383838, 0x00383838, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x00484848, 0x00383838, 0x00484848, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2d2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x002c2d2c, 0x00343434, 0x00383838, 0x00343434, 0x002c2c2c, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x002c2d2c, 0x002c2d2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c,
-		0x00545454, 0x00383838, 0x00545454, 0x00383838, 0x00545454, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00646464, 0x00646464, 0x00545454, 0x00484848, 0x00545454, 0x00383838, 0x00545454, 0x00484848, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x00383838, 0x00383838, 0x00404040, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00383838, 0x00484848, 0x00484848, 0x00545454, 0x00383838, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x004c4c4c, 0x00545454, 0x00545454, 0x00545454, 0x004c4c4c, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00303030, 0x00202020, 0x00202020, 0x00303030, 0x00383838, 0x00484848, 0x00484848, 0x00545454, 0x00484848,
-		0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00bd0000, 0x00bc0000, 0x00bc0001, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0001, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00a40000, 0x00484848, 0x00545454, 0x00484848, 0x00ec0000, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00a40000, 0x00484848, 0x00383838, 0x00545454, 0x00ed0000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00bc0000, 0x00bc0000, 0x00bc0001, 0x00bc0001, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00bc0000,
-		0x007c0000, 0x00a40000, 0x00580000, 0x00a40000, 0x00a40000, 0x00640000, 0x00980000, 0x00640000, 0x00a40100, 0x007c0000, 0x00c80000, 0x007c0000, 0x00a40000, 0x00640000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00484848, 0x00d40000, 0x00a40000, 0x00a40000, 0x00a40000, 0x00a50000, 0x00640000, 0x00a40000, 0x004c0000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640100, 0x00a40000, 0x00980000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640000, 0x00a40000, 0x00580000, 0x00a40000, 0x00700000, 0x00640000, 0x00400000, 0x00383838, 0x00484848, 0x00545454, 0x00d40000, 0x00a40000, 0x00640000, 0x00880000, 0x00a40000, 0x00580000, 0x00a40000, 0x00700000, 0x00a40000, 0x00710000, 0x00a40000, 0x00640000, 0x00a40000, 0x00700000,
-		0x00a40000, 0x007c0000, 0x007c0000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00640000, 0x00980000, 0x007c0000, 0x00640000, 0x00a40000, 0x00580000, 0x007c0000, 0x00640000, 0x00880000, 0x00640000, 0x00880000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00484848, 0x00d40000, 0x007c0000, 0x00a40000, 0x00700000, 0x00a40000, 0x00640000, 0x00700000, 0x004c0000, 0x007c0000, 0x00980000, 0x007c0000, 0x00a40000, 0x00880000, 0x00640000, 0x00880000, 0x00980000, 0x00640000, 0x007c0000, 0x00890000, 0x00700000, 0x00880000, 0x00580000, 0x00a40000, 0x00640000, 0x00a40100, 0x00400100, 0x00353434, 0x00484848, 0x00545454, 0x00d40000, 0x00640000, 0x00a40000, 0x00580000, 0x00a40000, 0x00700001, 0x00a40000, 0x00710000, 0x00880000, 0x00a40000, 0x00700001, 0x00a40000, 0x00880000, 0x004c0000,
-		0x00a40000, 0x007c0000, 0x00580000, 0x007d0000, 0x00a40000, 0x00640000, 0x00980000, 0x00640000, 0x007c0000, 0x00a40000, 0x007c0100, 0x00580000, 0x00a40000, 0x00880000, 0x00640000, 0x00980000, 0x007d0000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00404041, 0x00d40000, 0x007c0000, 0x007c0000, 0x00700000, 0x00a40000, 0x00640000, 0x007c0000, 0x007c0000, 0x00a40000, 0x00580000, 0x00a40000, 0x004c0000, 0x00a40000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640000, 0x00880000, 0x00580000, 0x00880000, 0x00880000, 0x00640000, 0x00700001, 0x00400000, 0x002c2d2c, 0x00484848, 0x00545454, 0x00d40000, 0x00640000, 0x00a40000, 0x00700000, 0x00700000, 0x00a40000, 0x00a40000, 0x00880000, 0x00700000, 0x00880000, 0x00700000, 0x00640000, 0x00700000, 0x00880000,
-		0x007c0000, 0x00980000, 0x00580000, 0x00980000, 0x00640000, 0x00640000, 0x00a40000, 0x00640000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00580000, 0x007c0000, 0x00700000, 0x00640000, 0x00a40000, 0x00650000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00404040, 0x00d40000, 0x00a40000, 0x004c0000, 0x00700000, 0x00a40000, 0x00640000, 0x00a40000, 0x004c0000, 0x00a40000, 0x007d0000, 0x00980000, 0x00640000, 0x00a40000, 0x00640000, 0x00880000, 0x007c0000, 0x00640000, 0x00a50000, 0x00640000, 0x00a40000, 0x00880000, 0x00580000, 0x00700000, 0x00980000, 0x00640000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00545454, 0x00d40000, 0x00a40000, 0x00640000, 0x00580000, 0x00a40000, 0x00880000, 0x00700000, 0x00710000, 0x00a40000, 0x00700001, 0x00a40000, 0x00640000, 0x00700000, 0x00a40000,
-		0x00640000, 0x00a40000, 0x007c0000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640000, 0x00880000, 0x00a40000, 0x00640000, 0x00a40000, 0x007c0000, 0x00580000, 0x00880000, 0x00a40000, 0x007c0000, 0x00880000, 0x00400000, 0x002c2c2c, 0x00494848, 0x00404040, 0x00d40000, 0x004c0001, 0x00a40000, 0x00a40000, 0x00640000, 0x00a40000, 0x007c0100, 0x00700000, 0x00880000, 0x00580000, 0x007c0000, 0x004c0000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640000, 0x007c0000, 0x007c0000, 0x00640000, 0x00880000, 0x00700000, 0x00580000, 0x00880000, 0x00700000, 0x00640000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00484848, 0x00d40000, 0x00640000, 0x00a40100, 0x00880000, 0x00a40000, 0x00700000, 0x00a40000, 0x00880000, 0x00700000, 0x00700000, 0x00580000, 0x00a40000, 0x00700000, 0x00a40000,
-		0x00640000, 0x00a40000, 0x007c0000, 0x007c0000, 0x00640000, 0x00980000, 0x00980000, 0x00640000, 0x00980000, 0x00640000, 0x007c0000, 0x00580000, 0x00a40000, 0x00640000, 0x00a40000, 0x00640000, 0x00980000, 0x00400000, 0x002c2d2c, 0x00484848, 0x00484848, 0x00d40000, 0x004c0000, 0x00a40000, 0x00700000, 0x00a40001, 0x00640000, 0x007c0000, 0x007c0000, 0x00880100, 0x004c0000, 0x00980100, 0x00640000, 0x00880000, 0x004c0000, 0x00a40000, 0x007c0001, 0x00640000, 0x00a40000, 0x00880000, 0x00640000, 0x00a40000, 0x00580000, 0x00a40000, 0x00580000, 0x00880000, 0x00400000, 0x002c2c2c, 0x00383838, 0x00484848, 0x00d40000, 0x00640000, 0x00a40000, 0x00580000, 0x00700000, 0x00580000, 0x00a40000, 0x00700000, 0x00a40000, 0x00700000, 0x00580000, 0x00640000, 0x00a40000, 0x004c0000,
-		0x007c0000, 0x00980000, 0x00580000, 0x00a40000, 0x00640000, 0x00640100, 0x00880000, 0x00640000, 0x007c0000, 0x007c0000, 0x00a40000, 0x00580000, 0x00a40000, 0x00640000, 0x00700000, 0x00880000, 0x007c0000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00545454, 0x00c80000, 0x00a40000, 0x004c0100, 0x00700000, 0x00a40000, 0x00640000, 0x00a40000, 0x004c0000, 0x00880000, 0x00650100, 0x00a40000, 0x00640000, 0x00a40000, 0x00700000, 0x00640000, 0x00a40000, 0x00640000, 0x007c0000, 0x00a40000, 0x00640000, 0x00880000, 0x00710000, 0x00880000, 0x00640000, 0x00880000, 0x00400000, 0x002c2c2c, 0x00383838, 0x00484848, 0x00c80000, 0x00640000, 0x00640100, 0x00580000, 0x00a40100, 0x00580000, 0x00a40000, 0x00700000, 0x00a40000, 0x00700000, 0x00a40000, 0x00640000, 0x00a40000, 0x00700000,
-		0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x00400000, 0x00400000, 0x002c2c2c, 0x00484848, 0x00484848, 0x00a40000, 0x00400000, 0x00400000, 0x00400000, 0x00400000, 0x00400000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004d0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x00400000, 0x00400000, 0x00202020, 0x00484848, 0x00545454, 0x00a40000, 0x00400000, 0x00400000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000, 0x004c0000,
-		0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2d2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2d, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00484848, 0x00545454, 0x00484848, 0x00383838, 0x00343434, 0x00343434, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x00202020, 0x00202020, 0x00212020, 0x00383838, 0x00484848, 0x00484848, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202120, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c,
-		0x00383838, 0x00545454, 0x00383838, 0x00545454, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00555454, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00404040, 0x00383838, 0x00383838, 0x00404040, 0x00383838, 0x00383838, 0x00404040, 0x00484848, 0x00404040, 0x00383838, 0x00404040, 0x00545454, 0x00484848, 0x00484848, 0x00383838, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00404040, 0x00383838, 0x00404040, 0x00484848, 0x00484848, 0x00484848,
-		0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00555454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454};
-	// 'wood', 64x64px
-	const unsigned int wood[] = {
-		0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403118, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00413018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00413018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403118, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018,
-		0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4924, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006d4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006d4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824,
-		0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c35, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905d34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c35, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34,
-		0x00543c1c, 0x00543c1c, 0x00543c1d, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00382c14, 0x00543c1c, 0x0028200c, 0x00382c14, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00553c1d, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1d, 0x00543c1c, 0x00543c1c, 0x00382c14, 0x00543c1c, 0x0028200c, 0x00382c14, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00382c14, 0x00543c1d, 0x0028200c, 0x00382c14, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00382c14, 0x00543c1c, 0x0028200c, 0x00382c14, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00382c14, 0x00543c1c, 0x0028200c, 0x00382c14, 0x00543c1c, 0x00543c1c,
-		0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00744c28, 0x00744c28, 0x00483818, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00483818, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x00483818, 0x00744c29, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00744c28, 0x00744c28, 0x00483918, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00553c1c, 0x00905c34, 0x00744c28, 0x00483818, 0x00744c28, 0x00543d1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x005c4020, 0x00483818, 0x005c4020, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905d34, 0x0028210c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x00744c28, 0x00744c28, 0x00483818, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00553c1c, 0x00915c34, 0x006c4824, 0x00483818, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c29, 0x005c4020, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028210c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1d, 0x00905c34, 0x006c4824,
-		0x00543c1c, 0x00493818, 0x00543c1c, 0x006c4824, 0x00754c28, 0x00744c28, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00543c1c, 0x00483818, 0x00483818, 0x005c4020, 0x00754c28, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00483818, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00915c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483918, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x006c4824, 0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744d28, 0x005c4020, 0x00483818, 0x00543c1c, 0x006c4824, 0x00744c28, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00483818, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00493818, 0x00744c28, 0x00483818, 0x006c4824, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x006c4824, 0x00483818, 0x00543c1d, 0x00483818, 0x005c4020, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x006c4824, 0x00483818, 0x005c4020, 0x00744c28, 0x00744c28, 0x005c4020, 0x00483818, 0x006c4824, 0x00483818, 0x006d4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00483818, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00915c34, 0x00483918, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x00483818, 0x006c4824, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x00744c28, 0x00543c1c, 0x00483818, 0x00483918, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x005c4020, 0x006c4824, 0x00744c28, 0x00744c28, 0x005c4020, 0x00493818, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00483818, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00553c1c, 0x00905c35, 0x00744c29, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x00483818, 0x005c4020, 0x00754c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x00744c28, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00553c1d, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00483818, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905d34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x00483818, 0x005c4020, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00553c1c, 0x00905d34, 0x00483818,
-		0x006c4824, 0x00744c28, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00744c28, 0x00543c1c, 0x00915c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00483818, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200d, 0x00543c1c, 0x00905c34, 0x00483818, 0x005c4020, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x00543c1c, 0x00483818, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x006c4824, 0x00744c28, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x005c4020, 0x00744c28, 0x00553c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x00543c1c, 0x00483818, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543d1c, 0x00905c34, 0x00483818,
-		0x005c4020, 0x00754c28, 0x00744c28, 0x00483818, 0x00543c1c, 0x00744c29, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0029200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c29, 0x006c4824, 0x00483818, 0x00483818, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0029200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00744c29, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x00543d1c, 0x00483818, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x00543c1c, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00744c28, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905d34, 0x00483818, 0x006c4824, 0x00744c28, 0x006c4824, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00754c28, 0x00543c1c, 0x00483818, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x00483818, 0x006c4824, 0x00744c28, 0x00744c28, 0x005c4020, 0x00754c28, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x005d4020, 0x00483818, 0x00483818, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00553c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x005c4020, 0x006c4824, 0x005c4020, 0x00493818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x005c4020, 0x00483818, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x00483818, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0029200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x005c4020, 0x00483818, 0x00483818, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c29, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905d34, 0x00483818, 0x00483818, 0x005c4020, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c29, 0x00483818, 0x00744c28, 0x005c4020, 0x00483818, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0029200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x00483818, 0x005c4020, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744d28, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00744c28, 0x00744d28, 0x00744c28, 0x00744d28, 0x00543c1c, 0x00483818, 0x00483818, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0029200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00915c34, 0x0029200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x006c4824, 0x00483818, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x00483818, 0x00543c1c, 0x006c4824, 0x00744c28, 0x00744c28, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00483918, 0x00543c1c, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483819, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x006c4824, 0x005c4021, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x006c4824, 0x00483818, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00483819, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c, 0x006c4824, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00553c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x006c4824, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00493818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00744c28, 0x006c4824, 0x00483818, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x00483818, 0x00483818, 0x00543c1c, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905d34, 0x00483818, 0x005c4120, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00915c34, 0x00483918, 0x00744c28, 0x00483818, 0x00493818, 0x00744c28, 0x00483818, 0x00744c28, 0x00744c28, 0x00483818, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x00553c1c, 0x00483818, 0x00543c1c, 0x005c4020, 0x00543c1c, 0x00483818, 0x00483818, 0x00553c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x005c4020, 0x00754d28, 0x00744c28, 0x005c4020, 0x00483818, 0x00483818, 0x005c4020, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905d34, 0x006c4824, 0x005c4020, 0x00483818, 0x005c4020, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x006c4824, 0x00744c28, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00543c1c, 0x006c4824, 0x006c4824, 0x005c4020, 0x00483818, 0x00483818, 0x005c4020, 0x006c4824, 0x00483818, 0x006c4824, 0x00483818, 0x00493818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4021, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x006c4824, 0x005c4020, 0x006c4824, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x006c4824, 0x00744c28, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00543c1c, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00483818, 0x005c4020, 0x005c4020, 0x00493818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x006c4824, 0x00744c28, 0x00744c28, 0x00543c1d, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x005c4020, 0x00744c28, 0x00543d1c, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020,
-		0x006c4824, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00553c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00543c1c, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x005c4020, 0x00744c28, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x006c4824, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00553c1c, 0x00483818, 0x006c4924, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00543c1c, 0x00744c28, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905d34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x006c4824, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00744c28, 0x00483818, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483918, 0x00744c28, 0x00483818, 0x00543c1c, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00543d1c, 0x00905c35, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x005c4020, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905d34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x00744c29, 0x00483818, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x005c4020, 0x00543c1d, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c29, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00553c1c, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00493818,
-		0x00543c1c, 0x006c4824, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00543c1c, 0x00543d1c, 0x00905c34, 0x0028210c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x00483818, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x006c4824, 0x00543d1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00915c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00744c28, 0x005c4020, 0x00483818, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x00543c1c, 0x006c4824, 0x00543c1c, 0x00483818, 0x00483818, 0x006c4824, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x00483818, 0x00483818, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00493818, 0x00483818, 0x00744c28, 0x00744c28, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x00483818, 0x005c4020, 0x00543c1c, 0x00483818, 0x006c4824, 0x005c4020, 0x00483818, 0x00543c1c, 0x00915c34, 0x0028200c, 0x00553d1c, 0x00905c34, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x00483818, 0x00483818, 0x006c4824, 0x00483818, 0x00483819, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x005c4020, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x006c4824, 0x00744c28, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483918, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x00483818, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x00483918, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00744c28, 0x006c4824, 0x00483818, 0x00543c1c, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00553c1c, 0x006c4824, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x006c4824, 0x00744c28, 0x00744c28, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483819, 0x00483918, 0x00744c28, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x00483818, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00543c1c, 0x00483918, 0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x006c4824, 0x00483818, 0x00543c1c, 0x006c4824, 0x00483918, 0x00493818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00744d28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x005c4120, 0x00744c28, 0x006c4924, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00754c28, 0x00483818, 0x00483818, 0x00744c28, 0x00543c1c, 0x00483818, 0x005c4020, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x00483818, 0x00483818, 0x005c4020, 0x006c4824, 0x005c4020, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x005c4020, 0x00483818, 0x00483818, 0x00543c1c, 0x005c4020, 0x00744c28, 0x005c4020, 0x00483818, 0x005c4020, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x006c4824, 0x005d4020, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00543c1c, 0x00483818, 0x005c4020, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x00483818, 0x00483818, 0x00543c1c, 0x005c4020, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c35, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00744c28, 0x00754c28, 0x00543c1c, 0x00483818, 0x005c4120, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744d28, 0x00744c28, 0x00744d28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x005c4120, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00744c28, 0x00744d28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00483819, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543d1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x005c4020, 0x00483818, 0x005c4020, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00483818, 0x005c4020, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x006c4824, 0x00553c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00553c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x00543c1c, 0x00483818, 0x00543d1c, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020,
-		0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x005c4020, 0x00744c28, 0x00744c28, 0x00744d28, 0x00483818, 0x00483818, 0x006c4824, 0x006c4824, 0x00483818, 0x00493818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200d, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x005c4020, 0x00483818, 0x00553c1c, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x006c4824, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x005c4020, 0x00543c1c, 0x00915c34, 0x0028200c, 0x00543d1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00744c28, 0x005c4120, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483918, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00905d34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x006c4824, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483819, 0x00483818, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x00543c1c, 0x00915c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00744d28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x005c4020, 0x00483818, 0x00483818, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905d34, 0x00744c28, 0x006c4824, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543d1c, 0x00905c34, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x006c4824, 0x006c4824, 0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x006c4824, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00553c1c, 0x00905c34, 0x005c4020, 0x00754c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543d1c, 0x00483818, 0x00483818, 0x00744c28, 0x005c4020, 0x00483818, 0x00493818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x005c4020, 0x00483818, 0x00483818, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x006c4824, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00483818, 0x00483818, 0x00483818, 0x00744c28, 0x005c4020, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x005c4020, 0x00483818, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x00543c1c, 0x00483818, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x006c4824, 0x005c4020, 0x00543c1c, 0x00483818, 0x00543c1c, 0x005c4020, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483819, 0x00483818, 0x00543c1c, 0x00744c28, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006d4824, 0x00483818, 0x00483819, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x006c4824, 0x005c4020, 0x005c4020, 0x006c4824, 0x00543c1c, 0x00915c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x00543c1c, 0x00483818, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x006c4824, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00543c1c, 0x006c4825, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x005c4020, 0x00754c28, 0x00744c28, 0x00744c28, 0x005c4020, 0x00483818, 0x00483818, 0x005c4020, 0x00744d28, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543d1d, 0x00905c34, 0x005c4020, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00754c28, 0x005c4020, 0x006c4824, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00543c1c, 0x00744c28, 0x00543c1c, 0x00483818, 0x00543c1c, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x005c4020, 0x006c4824, 0x005c4020, 0x00543c1c, 0x005c4020, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00543c1c, 0x006c4824, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c35, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x006c4824, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00543c1c, 0x00744c28, 0x005c4020, 0x00483818, 0x00483818, 0x005c4021, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x00543c1c, 0x006c4824, 0x006c4824, 0x005c4020, 0x006c4824, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00543c1c, 0x006c4824, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x00483818, 0x00483818, 0x00483819, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00493818, 0x00744c28, 0x00483818, 0x00483818, 0x00543c1c, 0x00744c28, 0x005c4020, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00543d1c, 0x00905c34, 0x0028200c, 0x00543d1c, 0x00905c34, 0x00483818,
-		0x00543c1c, 0x006c4824, 0x006c4824, 0x005c4020, 0x006c4824, 0x006c4824, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00493818, 0x00483818, 0x00483818, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00915c34, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00543c1c, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00483819, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x00483818, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483818, 0x00543c1c, 0x00915c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c, 0x00483818, 0x00483818, 0x00493818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x00483818, 0x00543c1d, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200d, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00553c1c, 0x00915c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00493818, 0x00483818, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x00483818, 0x005c4020, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x005c4020, 0x00483818, 0x00483819, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483819, 0x00744c28, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x005c4020, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x00483818, 0x00543c1c, 0x006c4824, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x005c4020, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00744c28, 0x00744c28, 0x00744d28, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x005c4020, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00905d34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818,
-		0x00483818, 0x00543c1c, 0x006c4824, 0x00744c28, 0x00744c28, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c35, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c, 0x006c4824, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00744c28, 0x00744c28, 0x00744c28, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x00483818, 0x00483819, 0x005c4020, 0x00744c28, 0x006c4824, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543d1c, 0x00905c35, 0x005c4020, 0x00744c28, 0x00744c28, 0x006c4924, 0x00543c1c, 0x00543c1c, 0x00905d34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x006c4824, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c,
-		0x00483818, 0x00483818, 0x00543c1c, 0x006c4824, 0x006c4824, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c, 0x006c4824, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x006c4825, 0x00744c28, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020,
-		0x00483818, 0x00483818, 0x00543c1c, 0x006c4824, 0x005c4020, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x006c4824, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00744d28, 0x005c4020, 0x00483818, 0x00483818, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00543c1c, 0x006c4824, 0x00744c28, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905c35, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x005c4020, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c35, 0x005c4020,
-		0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x005c4020, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x00744c28, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x006c4824, 0x00744c28, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483819, 0x005c4020, 0x006c4824, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00543c1c, 0x00483818, 0x00483918, 0x00483818, 0x005c4120, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00483818, 0x00543c1c, 0x00744c28, 0x00744c29, 0x00483818, 0x00483818, 0x00483819, 0x006c4824, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00543c1d, 0x005c4020, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00744c28, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x006c4824, 0x00744c28, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824,
-		0x00543c1c, 0x00483818, 0x00493818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x006c4824, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x00483818, 0x006c4825, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x00744c28, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00543c1d, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0029200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x006c4824, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x005c4020, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28,
-		0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x005c4020, 0x00744c28, 0x00754c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00744c28, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x006c4824, 0x006c4824, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x00744c28, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28,
-		0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00493818, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200d, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00744c28, 0x00744c28, 0x00744c28, 0x00744c28, 0x006c4824, 0x00483818, 0x00483818, 0x00483818, 0x005d4020, 0x00744c28, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x00744d28, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x005c4020, 0x006c4824, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x006c4824, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28,
-		0x005c4020, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x005c4020, 0x006c4824, 0x00744c28, 0x006c4824, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x006c4824, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483819, 0x00543c1d, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x005c4020, 0x00744c28, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28,
-		0x006c4824, 0x00543c1c, 0x00483818, 0x00493818, 0x00483818, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x006c4824, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28, 0x006c4824, 0x005c4020, 0x00543c1c, 0x00915c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00553c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00744c28, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28,
-		0x006c4824, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x006c4824, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x006c4824, 0x00744c28, 0x00744c28, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x006c4824, 0x005c4020, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00483819, 0x00744c28, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543d1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x00744c28,
-		0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020, 0x00483818, 0x005c4020, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x00905c34, 0x0028200c, 0x00543c1c, 0x00905c34, 0x005c4020};
-
-};
\ No newline at end of file
@@ -0,0 +1,538 @@
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <map>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <vector>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <Player.h>
+#include <Map.h>
+#include <Ray.h>
+#include <DoubleBuffer.h>
+#include <Raycaster.h>
+#include <textures.h>
+
+// The number of times each measure is repeated, the best time being kept
+const int REPEATS = 5;
+
+/**
+ * @brief A view of a benchmark: a map and a position on it, looked around from in a few directions.
+ */
+struct View
+{
+    std::string name; // The name of the view, printed with its results.
+    Map map;          // The map seen.
+    double x, y;      // The position of the player.
+};
+
+/**
+ * @brief Gets the best time of a few runs of a function.
+ *
+ * @param run The function to time.
+ * @return The best time (s).
+ */
+double bestTime(const std::function<void()> &run)
+{
+    double best = INFINITY;
+    for (int i = 0; i < REPEATS; i++)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        run();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+/**
+ * @brief Gets the player of a view turned by an angle from the starting direction (-1, 0) of the game.
+ */
+Player turnedPlayer(View &view, double angle)
+{
+    double c = std::cos(angle), s = std::sin(angle);
+    return Player({view.x, view.y}, {-c, -s}, {0.66 * s, -0.66 * c}, 5.0, 3.0, view.map);
+}
+
+/**
+ * @brief Gets the views of the game map and of larger random maps, from a free cell near their center.
+ */
+std::vector<View> getViews()
+{
+    std::vector<View> views = {
+        {"game, start", Map::generateMap(0), 22.0, 11.5},
+        {"game, corridor", Map::generateMap(0), 20.5, 1.5},
+        {"open 64x64", Map::generateRandomMap(64, 16, 1), 32.5, 32.5},
+        {"open 256x256", Map::generateRandomMap(256, 32, 1), 128.5, 128.5},
+    };
+    for (View &view : views)
+        while (view.map.hasWall(int(view.x), int(view.y)))
+            view.x += 1;
+    return views;
+}
+
+/**
+ * @brief Gets the columns per second of castWalls over a full turn of the player on a view, one frame every few
+ * degrees, with a raycaster configured by the given function: the walls found and drawn as in the game.
+ */
+double measureTurn(View &view, int width, int height, int frames, const std::function<void(Raycaster &)> &configure)
+{
+    DoubleBuffer doubleBuffer(width, height);
+    Player player = turnedPlayer(view, 0.0);
+    Raycaster raycaster(player, doubleBuffer, view.map);
+    configure(raycaster);
+    std::vector<Player> poses;
+    for (int i = 0; i < frames; i++)
+        poses.push_back(turnedPlayer(view, 2 * M_PI * i / frames));
+
+    double time = bestTime([&]()
+                           {
+                               for (const Player &pose : poses)
+                               {
+                                   player.setPose({pose.posX(), pose.posY()}, {pose.dirX(), pose.dirY()},
+                                                  {pose.camX(), pose.camY()});
+                                   raycaster.castWalls();
+                               }
+                           });
+    return double(width) * frames / time;
+}
+
+/**
+ * @brief Measures the columns per second of castWalls with each way of casting the wall rays, over a turn on a low
+ * screen, where the time is that of finding the walls rather than drawing them.
+ */
+void benchmarkTraversal()
+{
+    const int width = 3840, height = 8, frames = 120;
+    std::cout << "traversal: Mrays/s of castWalls on one thread, " << width << "x" << height << ", " << frames
+              << " frames of a turn" << std::endl;
+    std::cout << std::left << std::setw(16) << "view" << std::right << std::setw(10) << "scalar" << std::setw(10)
+              << "adaptive" << std::setw(10) << "rotation" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    for (View &view : getViews())
+        std::cout << std::left << std::setw(16) << view.name << std::right
+                  << std::setw(10) << measureTurn(view, width, height, frames, [](Raycaster &) {}) / 1e6
+                  << std::setw(10) << measureTurn(view, width, height, frames, [](Raycaster &raycaster)
+                                                  { raycaster.setTraversal(Traversal::ADAPTIVE); }) / 1e6
+                  << std::setw(10) << measureTurn(view, width, height, frames, [](Raycaster &raycaster)
+                                                  { raycaster.setReprojection(Reprojection::ROTATION); }) / 1e6
+                  << std::endl;
+}
+
+/**
+ * @brief Gets the time of castWalls with a wall engine over the directions of a view.
+ */
+double measureWalls(View &view, int width, int height, int directions, WallEngine wallEngine)
+{
+    DoubleBuffer doubleBuffer(width, height);
+    std::vector<Player> players;
+    for (int i = 0; i < directions; i++)
+        players.push_back(turnedPlayer(view, 2 * M_PI * i / directions));
+    std::vector<std::unique_ptr<Raycaster>> raycasters;
+    for (Player &player : players)
+    {
+        raycasters.push_back(std::unique_ptr<Raycaster>(new Raycaster(player, doubleBuffer, view.map)));
+        raycasters.back()->setWallEngine(wallEngine);
+        raycasters.back()->castWalls();
+    }
+
+    return bestTime([&]()
+                    {
+                        for (std::unique_ptr<Raycaster> &raycaster : raycasters)
+                            raycaster->castWalls();
+                    }) /
+           directions;
+}
+
+/**
+ * @brief Measures castWalls with the rays and with the projected faces of the walls, on maps of growing sizes and at
+ * a few heights: the lower the screen, the more the time is that of finding the walls rather than drawing them.
+ */
+void benchmarkSegments()
+{
+    const int width = 3840, heights[] = {8, 2160}, directions = 16;
+    std::vector<View> views = getViews();
+    views.push_back({"open 1024x1024", Map::generateRandomMap(1024, 400, 1), 512.5, 512.5});
+    views.push_back({"dense 256x256", Map::generateRandomMap(256, 8, 1), 128.5, 128.5});
+    for (View &view : views)
+        while (view.map.hasWall(int(view.x), int(view.y)))
+            view.x += 1;
+
+    std::cout << "segments: ms per castWalls on one thread, " << width << " columns, " << directions << " directions"
+              << std::endl;
+    std::cout << std::left << std::setw(16) << "view" << std::right << std::setw(8) << "height" << std::setw(10)
+              << "raycast" << std::setw(10) << "segments" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    for (View &view : views)
+        for (int height : heights)
+            std::cout << std::left << std::setw(16) << view.name << std::right << std::setw(8) << height
+                      << std::setw(10) << measureWalls(view, width, height, directions, WallEngine::RAYCAST) * 1e3
+                      << std::setw(10) << measureWalls(view, width, height, directions, WallEngine::SEGMENTS) * 1e3
+                      << std::endl;
+}
+
+/**
+ * @brief Draws a textured line as drawVertLine did before its kernels: stepping through the rows in double and reading
+ * each texel with Texture::get, which masks both coordinates and looks at the storage and the format of the texture
+ * for every pixel.
+ */
+void drawGenericLine(DoubleBuffer &doubleBuffer, int x, int yStart, int yEnd, int lineHeight, const Texture &texture,
+                     int texX, int shade)
+{
+    double step = double(texture.getHeight()) / lineHeight;
+    double texY = (yStart - doubleBuffer.getHeight() / 2 + lineHeight / 2) * step;
+    for (int y = yStart; y <= yEnd; y++)
+    {
+        doubleBuffer.drawPixel(x, y, texture.get(texX, int(texY), shade));
+        texY += step;
+    }
+}
+
+/**
+ * @brief Gets the pixels per second drawn by a line function over the columns of a buffer, with lines of heights
+ * spread over a range and clipped to the buffer as the walls are.
+ */
+double measureLines(DoubleBuffer &doubleBuffer, const Texture &texture, int minHeight, int maxHeight,
+                    void (*drawLine)(DoubleBuffer &, int, int, int, int, const Texture &, int, int))
+{
+    int width = doubleBuffer.getWidth(), height = doubleBuffer.getHeight();
+    long pixels = 0;
+    for (int x = 0; x < width; x++)
+    {
+        int lineHeight = minHeight + (maxHeight - minHeight) * x / width;
+        pixels += std::min(height - 1, lineHeight / 2 + height / 2) - std::max(0, -lineHeight / 2 + height / 2) + 1;
+    }
+    double time = bestTime([&]()
+                           {
+                               for (int x = 0; x < width; x++)
+                               {
+                                   int lineHeight = minHeight + (maxHeight - minHeight) * x / width;
+                                   int yStart = std::max(0, -lineHeight / 2 + height / 2);
+                                   int yEnd = std::min(height - 1, lineHeight / 2 + height / 2);
+                                   drawLine(doubleBuffer, x, yStart, yEnd, lineHeight, texture, x, x & 1);
+                               }
+                           });
+    return pixels / time;
+}
+
+/**
+ * @brief Opens a counter of the read misses of a hardware cache for the calling thread, disabled until started.
+ *
+ * @param cache The cache, PERF_COUNT_HW_CACHE_L1D or PERF_COUNT_HW_CACHE_LL.
+ * @return The file descriptor of the counter, or -1 if the kernel or the processor does not expose it.
+ */
+int openCacheMisses(int cache)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+/**
+ * @brief Starts a counter from zero, if it was opened.
+ */
+void startCounter(int fd)
+{
+    if (fd < 0)
+        return;
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+}
+
+/**
+ * @brief Stops and closes a counter, and formats its count in millions, or n/a if it could not be opened or read.
+ */
+std::string stopCounter(int fd)
+{
+    if (fd < 0)
+        return "n/a";
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    long long count;
+    bool read = ::read(fd, &count, sizeof(count)) == sizeof(count);
+    close(fd);
+    if (!read)
+        return "n/a";
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(1) << count / 1e6 << "M";
+    return text.str();
+}
+
+/**
+ * @brief Measures the column kernels of drawVertLine against the generic loop they replaced, with the textures of
+ * the walls stored vertically, in both formats.
+ */
+void benchmarkKernels()
+{
+    const int width = 3840, height = 2160;
+    const int ranges[][2] = {{200, 800}, {800, 2160}, {2160, 8000}};
+    DoubleBuffer doubleBuffer(width, height);
+    Map map = Map::generateMap(0);
+
+    std::cout << "kernels: Mpixels/s of the wall lines, " << width << "x" << height << std::endl;
+    std::cout << std::left << std::setw(16) << "lines" << std::setw(10) << "format" << std::right << std::setw(10)
+              << "generic" << std::setw(10) << "kernel" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    for (TextureFormat format : {TextureFormat::DIRECT, TextureFormat::INDEXED})
+    {
+        map.setTextureFormat(format);
+        const Texture &texture = map.getTexture(0, 0);
+        // The cache misses of the whole loop of the format, generic and kernel lines together
+        int l1Misses = openCacheMisses(PERF_COUNT_HW_CACHE_L1D);
+        int llMisses = openCacheMisses(PERF_COUNT_HW_CACHE_LL);
+        startCounter(l1Misses);
+        startCounter(llMisses);
+        for (const int *range : ranges)
+        {
+            double generic = measureLines(doubleBuffer, texture, range[0], range[1], drawGenericLine);
+            double kernel = measureLines(doubleBuffer, texture, range[0], range[1],
+                                         [](DoubleBuffer &doubleBuffer, int x, int yStart, int yEnd, int lineHeight,
+                                            const Texture &texture, int texX, int shade)
+                                         { doubleBuffer.drawVertLine(x, yStart, yEnd, lineHeight, texture, texX, shade); });
+            std::cout << std::left << std::setw(16) << (std::to_string(range[0]) + "-" + std::to_string(range[1]))
+                      << std::setw(10) << (format == TextureFormat::DIRECT ? "direct" : "indexed") << std::right
+                      << std::setw(10) << generic / 1e6 << std::setw(10) << kernel / 1e6 << std::endl;
+        }
+        std::string l1 = stopCounter(l1Misses);
+        std::string ll = stopCounter(llMisses);
+        std::cout << (format == TextureFormat::DIRECT ? "direct" : "indexed") << " cache read misses: L1D " << l1
+                  << ", LL " << ll << std::endl;
+    }
+}
+
+/**
+ * @brief Gets the times of the passes of the walls and of the floor and ceiling over the directions of a view, in
+ * seconds per frame.
+ */
+std::pair<double, double> measurePasses(View &view, int width, int height, int directions, double fogDistance)
+{
+    DoubleBuffer doubleBuffer(width, height);
+    std::vector<Player> players;
+    for (int i = 0; i < directions; i++)
+        players.push_back(turnedPlayer(view, 2 * M_PI * i / directions));
+    std::vector<std::unique_ptr<Raycaster>> raycasters;
+    for (Player &player : players)
+    {
+        raycasters.push_back(std::unique_ptr<Raycaster>(new Raycaster(player, doubleBuffer, view.map)));
+        raycasters.back()->setFogDistance(fogDistance);
+    }
+
+    double walls = bestTime([&]()
+                            {
+                                for (std::unique_ptr<Raycaster> &raycaster : raycasters)
+                                    raycaster->castWalls();
+                            });
+    double floorCeiling = bestTime([&]()
+                                   {
+                                       for (std::unique_ptr<Raycaster> &raycaster : raycasters)
+                                       {
+                                           raycaster->castWalls();
+                                           raycaster->castFloorCeiling();
+                                       }
+                                   }) -
+                          walls;
+    return {walls / directions, floorCeiling / directions};
+}
+
+/**
+ * @brief Measures the walls and the floor and ceiling drawn from the pre-shaded textures, without fog and with fog
+ * levels picked from the distance table, the nearer the fog the more pixels drawn from a fog level.
+ */
+void benchmarkFog()
+{
+    const int width = 1920, height = 1080, directions = 16, fogLevels = 8;
+    const double fogDistances[] = {0, 16, 4};
+
+    std::cout << "fog: ms per frame on one thread, " << width << "x" << height << ", " << directions << " directions, "
+              << fogLevels << " fog levels" << std::endl;
+    std::cout << std::left << std::setw(16) << "view" << std::right << std::setw(14) << "fog distance" << std::setw(8)
+              << "walls" << std::setw(16) << "floor, ceiling" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    for (View &view : getViews())
+    {
+        view.map.setFogLevels(fogLevels);
+        for (double fogDistance : fogDistances)
+        {
+            std::pair<double, double> times = measurePasses(view, width, height, directions, fogDistance);
+            std::cout << std::left << std::setw(16) << view.name << std::right << std::setw(14)
+                      << (fogDistance > 0 ? std::to_string(int(fogDistance)) : "none") << std::setw(8)
+                      << times.first * 1e3 << std::setw(16) << times.second * 1e3 << std::endl;
+        }
+    }
+}
+
+/**
+ * @brief Builds at run time the textures of the game map: its walls and sprites stored vertically, its floor and
+ * ceiling horizontally, as Map::generateMap did before they were laid out at compile time.
+ */
+std::vector<Texture> buildGameTextures()
+{
+    std::vector<Texture> textures;
+    for (const unsigned int *pixels : {textures::greenlight, textures::pillar, textures::barrel, textures::eagle,
+                                       textures::redbrick, textures::purplestone, textures::greystone,
+                                       textures::bluestone, textures::mossy, textures::wood, textures::colorstone})
+        textures.push_back(Texture(64, 64, pixels, true));
+    textures.push_back(Texture(64, 64, textures::greystone, false));
+    textures.push_back(Texture(64, 64, textures::wood, false));
+    return textures;
+}
+
+/**
+ * @brief Gets the resident set size of the process, from /proc/self/statm.
+ *
+ * @return The resident size (KiB), or -1 if it cannot be read.
+ */
+long getResidentKiB()
+{
+    std::ifstream statm("/proc/self/statm");
+    long size, resident;
+    if (!(statm >> size >> resident))
+        return -1;
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+/**
+ * @brief Formats the growth of the resident size between two readings, or n/a if either could not be read.
+ */
+std::string formatGrowth(long before, long after)
+{
+    return before < 0 || after < 0 ? "n/a" : std::to_string(after - before);
+}
+
+/**
+ * @brief Measures the startup of the game map, its textures read in place from the tables laid out at compile time,
+ * against its textures built at run time, and the copy of the map made by the frame pipeline. The resident memory of
+ * both is measured first, in the fresh process, each kept alive while the other is made.
+ */
+void benchmarkStartup()
+{
+    const int runs = 100;
+    long start = getResidentKiB();
+    Map game = Map::generateMap(2);
+    Map gameCopy(game);
+    long tables = getResidentKiB();
+    std::vector<Texture> built = buildGameTextures();
+    long loaded = getResidentKiB();
+    // Read from what is made, so that it is not optimized away
+    volatile long made = 0;
+    double generate = bestTime([&]()
+                               {
+                                   for (int i = 0; i < runs; i++)
+                                       made += Map::generateMap(2).getTexture(1, 0).getPixels()[i];
+                               });
+    double copy = bestTime([&]()
+                           {
+                               for (int i = 0; i < runs; i++)
+                                   made += Map(game).getSprites()[i % 2].get(i % 64, 0);
+                           });
+    double build = bestTime([&]()
+                            {
+                                for (int i = 0; i < runs; i++)
+                                    made += buildGameTextures()[i % 13].getPixels()[i];
+                            });
+
+    std::cout << "startup: us per call, best of " << REPEATS << " runs of " << runs << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << std::left << std::setw(40) << "generateMap, textures from the tables" << std::right << std::setw(10)
+              << generate / runs * 1e6 << std::endl;
+    std::cout << std::left << std::setw(40) << "copy of the map" << std::right << std::setw(10)
+              << copy / runs * 1e6 << std::endl;
+    std::cout << std::left << std::setw(40) << "its textures built at run time" << std::right << std::setw(10)
+              << build / runs * 1e6 << std::endl;
+    std::cout << "startup: resident KiB added, from /proc/self/statm" << std::endl;
+    std::cout << std::left << std::setw(40) << "generateMap and its copy, from the tables" << std::right
+              << std::setw(10) << formatGrowth(start, tables) << std::endl;
+    std::cout << std::left << std::setw(40) << "its textures built at run time" << std::right << std::setw(10)
+              << formatGrowth(tables, loaded) << std::endl;
+}
+
+/**
+ * @brief Gets the time per frame of a player watching another one walk across the room in front of it, each frame
+ * drawn whole or only what changed over the static layer, with the fraction of the columns redrawn.
+ */
+std::pair<double, double> measureLayer(int width, int height, int frames, bool changesOnly)
+{
+    Map map = Map::generateMap(2);
+    map.movePlayer(1, -1, -1);
+    Player player({22.0, 11.5}, {-1, 0}, {0, 0.66}, 5.0, 3.0, map);
+    DoubleBuffer doubleBuffer(width, height);
+    Raycaster raycaster(player, doubleBuffer, map);
+    raycaster.render();
+    doubleBuffer.swap();
+
+    double redrawn = 0;
+    double time = bestTime([&]()
+                           {
+                               redrawn = 0;
+                               for (int i = 0; i < frames; i++)
+                               {
+                                   map.movePlayer(0, 19.5, 9.5 + 4.0 * i / frames);
+                                   if (!changesOnly)
+                                       raycaster.render();
+                                   else if (!raycaster.renderChanges())
+                                       continue;
+                                   redrawn += changesOnly ? raycaster.getRedrawnFraction() : 1;
+                                   doubleBuffer.swap();
+                               }
+                           });
+    return {time / frames, redrawn / frames};
+}
+
+/**
+ * @brief Measures the frames where only a sprite moved, redrawn whole or recomposed from the static layer.
+ */
+void benchmarkLayer()
+{
+    const int sizes[][2] = {{1920, 1080}, {3840, 2160}}, frames = 32;
+
+    std::cout << "layer: ms per frame on one thread, a sprite moving in front of the player at the game start, "
+              << frames << " frames" << std::endl;
+    std::cout << std::left << std::setw(12) << "size" << std::right << std::setw(10) << "render" << std::setw(16)
+              << "renderChanges" << std::setw(10) << "redrawn" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    for (const int *size : sizes)
+    {
+        std::pair<double, double> full = measureLayer(size[0], size[1], frames, false);
+        std::pair<double, double> changes = measureLayer(size[0], size[1], frames, true);
+        std::cout << std::left << std::setw(12) << (std::to_string(size[0]) + "x" + std::to_string(size[1]))
+                  << std::right << std::setw(10) << full.first * 1e3 << std::setw(16) << changes.first * 1e3
+                  << std::setw(9) << changes.second * 100 << "%" << std::endl;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const std::map<std::string, std::function<void()>> benchmarks = {
+        {"traversal", benchmarkTraversal},
+        {"segments", benchmarkSegments},
+        {"kernels", benchmarkKernels},
+        {"fog", benchmarkFog},
+        {"startup", benchmarkStartup},
+        {"layer", benchmarkLayer},
+    };
+
+    if (argc != 2 || !benchmarks.count(argv[1]))
+    {
+        std::cerr << "Usage: " << argv[0] << " <benchmark>" << std::endl;
+        std::cerr << "  benchmark: One of";
+        for (const std::pair<const std::string, std::function<void()>> &benchmark : benchmarks)
+            std::cerr << " " << benchmark.first;
+        std::cerr << "." << std::endl;
+        return 1;
+    }
+    benchmarks.at(argv[1])();
+    return 0;
+}
@@ -0,0 +1,127 @@
+#ifndef BOUNDEDQUEUE_H
+#define BOUNDEDQUEUE_H
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+/**
+ * @brief A thread-safe FIFO queue with a maximum number of items, used to hand work from one stage of the frame pipeline to the next.
+ *
+ * Pushing blocks while the queue is full and popping blocks while it is empty, so a fast stage is throttled by the
+ * slower stage that follows it instead of accumulating work. Closing the queue wakes up every waiting thread.
+ *
+ * @tparam T The type of the items.
+ */
+template <typename T>
+class BoundedQueue
+{
+public:
+    /**
+     * @brief Constructs an empty BoundedQueue object.
+     *
+     * @param capacity The maximum number of items in the queue, at least 1.
+     */
+    BoundedQueue(size_t capacity);
+
+    /**
+     * @brief Appends an item to the queue, waiting while the queue is full.
+     *
+     * @param item The item to append.
+     * @return False if the queue was closed, in which case the item is dropped, true otherwise.
+     */
+    bool push(T item);
+
+    /**
+     * @brief Removes the oldest item of the queue, waiting while the queue is empty.
+     *
+     * @param item The item removed.
+     * @return False if the queue was closed and is empty, true otherwise.
+     */
+    bool pop(T &item);
+
+    /**
+     * @brief Removes the oldest item of the queue, waiting at most the given time while the queue is empty.
+     *
+     * @param item The item removed.
+     * @param timeout The maximum time (s) to wait.
+     * @return False if no item was removed before the timeout, or if the queue was closed and is empty, true otherwise.
+     */
+    bool popFor(T &item, double timeout);
+
+    /**
+     * @brief Closes the queue: pushes fail, and pops fail once the remaining items are removed.
+     */
+    void close();
+
+private:
+    size_t capacity;                 // The maximum number of items.
+    std::deque<T> items;             // The items, oldest first.
+    bool closed;                     // Whether the queue is closed.
+    std::mutex mutex;                // Protects the items and the closed state.
+    std::condition_variable notFull;  // Notified when an item is removed or the queue is closed.
+    std::condition_variable notEmpty; // Notified when an item is added or the queue is closed.
+};
+
+template <typename T>
+BoundedQueue<T>::BoundedQueue(size_t capacity) : capacity(capacity > 0 ? capacity : 1), closed(false)
+{
+}
+
+template <typename T>
+bool BoundedQueue<T>::push(T item)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    notFull.wait(lock, [this]
+                 { return closed || items.size() < capacity; });
+    if (closed)
+        return false;
+    items.push_back(std::move(item));
+    lock.unlock();
+    notEmpty.notify_one();
+    return true;
+}
+
+template <typename T>
+bool BoundedQueue<T>::pop(T &item)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    notEmpty.wait(lock, [this]
+                  { return closed || !items.empty(); });
+    if (items.empty())
+        return false;
+    item = std::move(items.front());
+    items.pop_front();
+    lock.unlock();
+    notFull.notify_one();
+    return true;
+}
+
+template <typename T>
+bool BoundedQueue<T>::popFor(T &item, double timeout)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    notEmpty.wait_for(lock, std::chrono::duration<double>(timeout), [this]
+                      { return closed || !items.empty(); });
+    if (items.empty())
+        return false;
+    item = std::move(items.front());
+    items.pop_front();
+    lock.unlock();
+    notFull.notify_one();
+    return true;
+}
+
+template <typename T>
+void BoundedQueue<T>::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+    }
+    notFull.notify_all();
+    notEmpty.notify_all();
+}
+
+#endif
@@ -0,0 +1,222 @@
+#ifndef DOUBLEBUFFER_H
+#define DOUBLEBUFFER_H
+
+#include <vector>
+#include <atomic>
+
+#include <Texture.h>
+
+/**
+ * @brief A range of columns of a frame.
+ */
+struct ColumnRange
+{
+    int begin, end; // The first column and the column after the last one.
+};
+
+/**
+ * @brief The DoubleBuffer class represents a double buffer which can be used to draw to a window.
+ *
+ * This class contains a front buffer, on which drawing operations are performed, and a back buffer, which can
+ * be used to display content on a window. The front and back buffers can be swapped to display the content
+ * drawn on the front buffer.
+ *
+ * The frames can be rendered at a fraction of the full size of the buffer (see setScale), in which case the back
+ * buffer is upscaled to the full size when it is copied to the window.
+ *
+ * A frame may also redraw only some columns of the last one (see reopenBackBuffer), in which case only those columns
+ * are copied to the window. The walls, floor and ceiling under the sprites can be kept in a layer to be restored in
+ * these columns.
+ */
+class DoubleBuffer
+{
+public:
+    /**
+     * @brief Constructs a DoubleBuffer object, which consist of a front and back buffer.
+     *
+     * @param width The width of the buffer.
+     * @param height The height of the buffer.
+     */
+    DoubleBuffer(int width, int height);
+
+    /**
+     * @brief Returns the back buffer.
+     *
+     * @return The back buffer.
+     */
+    const std::vector<int> &getBackBuffer() const;
+
+    /**
+     * @brief Copies the back buffer into an image of the full size of the buffer, upscaling it with the nearest
+     * neighbor if it was rendered at a lower resolution.
+     *
+     * @param pixels The image, of getFullWidth() * getFullHeight() pixels.
+     */
+    void upscaleBackBuffer(int *pixels) const;
+
+    /**
+     * @brief Copies a range of columns of the window from the back buffer into an image of the full size of the
+     * buffer, see upscaleBackBuffer.
+     *
+     * @param pixels The image, of getFullWidth() * getFullHeight() pixels.
+     * @param columns The columns of the window copied.
+     */
+    void upscaleBackBuffer(int *pixels, const ColumnRange &columns) const;
+
+    /**
+     * @brief Gets the columns of the window changed by the frame of the back buffer: all of them, or those redrawn if
+     * the frame was drawn over the last one with reopenBackBuffer.
+     *
+     * @return The ranges of columns of the window, in order.
+     */
+    const std::vector<ColumnRange> &getChangedColumns() const;
+
+    /**
+     * @brief Gets the width at which the frames are rendered.
+     *
+     * @return The width at which the frames are rendered.
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Gets the height at which the frames are rendered.
+     *
+     * @return The height at which the frames are rendered.
+     */
+    int getHeight() const;
+
+    /**
+     * @brief Gets the width of the window.
+     *
+     * @return The width of the window.
+     */
+    int getFullWidth() const;
+
+    /**
+     * @brief Gets the height of the window.
+     *
+     * @return The height of the window.
+     */
+    int getFullHeight() const;
+
+    /**
+     * @brief Sets the resolution at which the next frames are rendered, relative to the full size. Must be called
+     * between frames.
+     *
+     * @param scale The scale of the resolution, between 0 (excluded) and 1.
+     */
+    void setScale(double scale);
+
+    /**
+     * @brief Gets the resolution at which the frames are rendered, relative to the full size.
+     *
+     * @return The scale of the resolution.
+     */
+    double getScale() const;
+
+    /**
+     * @brief Draws a vertical line on the front buffer. The pixel writes are not counted, see countPixelWrites.
+     *
+     * The line is drawn by a kernel specialized for the height and the storage of the texture, chosen once per line,
+     * which steps through the texture in fixed point and copies the texels of the shade, or expands the indices of an
+     * indexed texture through the palette of the shade.
+     *
+     * @param x The x-coordinate of the line on the buffer.
+     * @param yStart The starting y-coordinate of the line on the buffer.
+     * @param yEnd The ending y-coordinate of the line on the buffer.
+     * @param lineHeight The height of the line.
+     * @param texture The texture to use for drawing the line.
+     * @param texX The x-coordinate of the texture to start drawing from.
+     * @param shade The shade of the texture drawn, see Texture::getShade.
+     */
+    void drawVertLine(int x, int yStart, int yEnd, int lineHeight, const Texture &texture, int texX, int shade);
+
+    /**
+     * @brief Draws a pixel on the front buffer. The pixel write is not counted, see countPixelWrites.
+     *
+     * @param x The x-coordinate of the pixel.
+     * @param y The y-coordinate of the pixel.
+     * @param color The color of the pixel.
+     */
+    void drawPixel(int x, int y, unsigned int color);
+
+    /**
+     * @brief Counts pixel writes made with drawVertLine and drawPixel. The pixels are counted in bulk, since the frame
+     * may be drawn by several threads at once.
+     *
+     * @param count The number of pixel writes.
+     */
+    void countPixelWrites(long count);
+
+    /**
+     * @brief Swaps the front and back buffers.
+     */
+    void swap();
+
+    /**
+     * @brief Swaps the front buffer with the given buffer, so that a finished frame can be handed to another thread
+     * without a copy. The frame must have been rendered at the full size.
+     *
+     * @param buffer The buffer to swap with the front buffer, of the full size of the buffer.
+     */
+    void swap(std::vector<int> &buffer);
+
+    /**
+     * @brief Gets whether the back buffer holds the last frame drawn, at the current resolution, so that it can be
+     * reopened. This is never the case when the frames are handed to another thread with swap(std::vector<int> &).
+     *
+     * @return True if reopenBackBuffer can be called.
+     */
+    bool canReopenBackBuffer() const;
+
+    /**
+     * @brief Brings the frame of the back buffer back to the front buffer, to redraw some of its columns. The next
+     * swap then only presents these columns (see getChangedColumns). canReopenBackBuffer must be true.
+     *
+     * @param columns The ranges of columns redrawn, in order.
+     */
+    void reopenBackBuffer(const std::vector<ColumnRange> &columns);
+
+    /**
+     * @brief Copies the front buffer to the layer, to restore some of its columns in the next frames with
+     * restoreLayer.
+     */
+    void saveLayer();
+
+    /**
+     * @brief Copies a range of columns of the layer to the front buffer, which must be at the resolution at which the
+     * layer was saved.
+     *
+     * @param columns The columns copied.
+     */
+    void restoreLayer(const ColumnRange &columns);
+
+    /**
+     * @brief Gets the number of pixel writes made to render the back buffer, to measure the overdraw. Ideally, each
+     * pixel is written once, plus the pixels of the sprites.
+     *
+     * @return The number of pixel writes of the last frame.
+     */
+    long getPixelWrites() const;
+
+private:
+    int width;                        // The width at which the front buffer is rendered.
+    int height;                       // The height at which the front buffer is rendered.
+    int fullWidth;                    // The width of the window.
+    int fullHeight;                   // The height of the window.
+    double scale;                     // The resolution of the front buffer relative to the full size.
+    int backWidth;                    // The width at which the back buffer was rendered.
+    int backHeight;                   // The height at which the back buffer was rendered.
+    std::vector<int> upscaleColumns;  // The column of the back buffer shown in each column of the window.
+    std::atomic<long> pixelWrites;    // The number of pixel writes made to the front buffer.
+    long backPixelWrites;             // The number of pixel writes made to render the back buffer.
+    std::vector<int> frontBuffer;
+    std::vector<int> backBuffer;
+    std::vector<int> layer;                  // The copy of a front buffer saved by saveLayer.
+    bool backIsLastFrame;                    // Whether the back buffer holds the last frame drawn.
+    bool reopened;                           // Whether the front buffer is a frame reopened by reopenBackBuffer.
+    std::vector<ColumnRange> redrawnColumns; // The columns of the front buffer redrawn over the reopened frame.
+    std::vector<ColumnRange> changedColumns; // The columns of the window changed by the frame of the back buffer.
+};
+
+#endif
\ No newline at end of file
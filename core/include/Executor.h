@@ -0,0 +1,77 @@
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#include <vector>
+#include <memory>
+#include <functional>
+
+#include <Strategies.h>
+#include <ThreadPool.h>
+
+/**
+ * @brief Runs the parallel loops of the renderer with one of the threading strategies.
+ *
+ * The loops are split in chunks of consecutive iterations whatever the strategy, so the renderer is written once and
+ * draws the same pixels with any strategy and any number of threads.
+ */
+class Executor
+{
+public:
+    /**
+     * @brief Constructs an Executor object, starting the threads of the pool if the strategy uses one.
+     *
+     * @param threading The threading strategy.
+     * @param nbThreads The number of threads running the loops, including the calling thread, ignored without threading.
+     * @param pinThreads Whether to pin each thread of the pool to its own core.
+     */
+    Executor(ThreadingStrategy threading, int nbThreads, bool pinThreads);
+
+    /**
+     * @brief Runs a loop and waits for its end.
+     *
+     * @param count The number of iterations.
+     * @param chunkSize The number of consecutive iterations handed to a thread at once.
+     * @param body The function running the iterations from its first argument (included) to its second one (excluded).
+     */
+    void parallelFor(int count, int chunkSize, const std::function<void(int, int)> &body);
+
+    /**
+     * @brief Runs a loop and a task independent of it, and waits for both. The task is handed to a thread as one more
+     * chunk, the first one, so it overlaps the iterations run by the other threads.
+     *
+     * @param count The number of iterations.
+     * @param chunkSize The number of consecutive iterations handed to a thread at once.
+     * @param body The function running the iterations from its first argument (included) to its second one (excluded).
+     * @param task The task, run once. If empty, only the loop is run.
+     */
+    void parallelFor(int count, int chunkSize, const std::function<void(int, int)> &body,
+                     const std::function<void()> &task);
+
+    /**
+     * @brief Gets the threading strategy.
+     *
+     * @return The threading strategy.
+     */
+    ThreadingStrategy getThreading() const;
+
+    /**
+     * @brief Gets the number of threads running the loops, including the calling thread.
+     *
+     * @return The number of threads.
+     */
+    int getThreadCount() const;
+
+    /**
+     * @brief Gets the fraction of time each thread of the pool spent running iterations since the last call.
+     *
+     * @return The utilization of each thread, empty if the strategy does not use a pool.
+     */
+    std::vector<double> getUtilization();
+
+private:
+    ThreadingStrategy threading;      // The threading strategy.
+    int nbThreads;                    // The number of threads running the loops.
+    std::unique_ptr<ThreadPool> pool; // The pool running the loops, with the pool strategy only.
+};
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef FRAMEGOVERNOR_H
+#define FRAMEGOVERNOR_H
+
+/**
+ * @brief Chooses the resolution at which the frames are rendered to keep the frame time under a budget.
+ *
+ * The governor smooths the measured frame times, lowers the resolution by one step when the smoothed time exceeds
+ * the budget for a few frames, and raises it by one step only when the time predicted at the higher resolution
+ * stays well under the budget for many frames. The gap between the two thresholds and the cooldown after each change
+ * prevent the resolution from oscillating.
+ */
+class FrameGovernor
+{
+public:
+    /**
+     * @brief Constructs a FrameGovernor object, which starts at the maximum scale.
+     *
+     * @param targetFrameTime The budget (s) of a frame.
+     * @param minScale The lowest resolution, relative to the full size.
+     * @param maxScale The highest resolution, relative to the full size.
+     * @param scaleStep The change of resolution at each adjustment.
+     */
+    FrameGovernor(double targetFrameTime, double minScale = 0.5, double maxScale = 1.0, double scaleStep = 0.125);
+
+    /**
+     * @brief Accounts for the time spent on the last frame and chooses the scale of the next one.
+     *
+     * @param frameTime The time (s) spent working on the last frame, excluding the time spent waiting for the budget to elapse.
+     * @return The scale at which the next frame should be rendered.
+     */
+    double update(double frameTime);
+
+    /**
+     * @brief Gets the scale at which the frames should be rendered.
+     *
+     * @return The current scale.
+     */
+    double getScale() const;
+
+    /**
+     * @brief Gets the budget of a frame.
+     *
+     * @return The budget (s) of a frame.
+     */
+    double getTargetFrameTime() const;
+
+private:
+    static int const FRAMES_BEFORE_DOWNSCALE = 3; // The number of frames over budget before lowering the resolution.
+    static int const FRAMES_BEFORE_UPSCALE = 30;  // The number of frames with headroom before raising the resolution.
+    static int const COOLDOWN_FRAMES = 10;        // The number of frames without adjustment after a change of resolution.
+
+    double targetFrameTime; // The budget (s) of a frame.
+    double minScale;        // The lowest resolution.
+    double maxScale;        // The highest resolution.
+    double scaleStep;       // The change of resolution at each adjustment.
+    double scale;           // The current resolution.
+    double smoothedTime;    // The exponential moving average of the frame times, 0 before the first frame.
+    int framesOver;         // The number of consecutive frames over budget.
+    int framesUnder;        // The number of consecutive frames with enough headroom to raise the resolution.
+    int cooldown;           // The number of frames left before the next adjustment.
+
+    /**
+     * @brief Changes the resolution, and rescales the smoothed time to the time expected at the new resolution.
+     *
+     * @param newScale The new scale.
+     */
+    void setScale(double newScale);
+};
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef FRAMEPIPELINE_H
+#define FRAMEPIPELINE_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <chrono>
+
+#include <Vector.h>
+#include <Average.h>
+#include <Player.h>
+#include <Map.h>
+#include <DoubleBuffer.h>
+#include <Raycaster.h>
+#include <BoundedQueue.h>
+
+/**
+ * @brief The state of the game needed to render one frame, produced by the simulation stage.
+ */
+struct FrameState
+{
+    Vector<double> position;              // The position of the player.
+    Vector<double> direction;             // The direction vector of the player.
+    Vector<double> camera;                // The camera vector of the player.
+    std::vector<Vector<double>> players;  // The positions of the other players.
+    std::chrono::steady_clock::time_point start; // When the simulation of the frame started.
+
+    FrameState() : position(0, 0), direction(0, 0), camera(0, 0) {}
+};
+
+/**
+ * @brief A rendered frame, waiting to be presented or being presented.
+ */
+struct Frame
+{
+    std::vector<int> pixels;                     // The pixels of the frame.
+    std::chrono::steady_clock::time_point start; // When the simulation of the frame started.
+};
+
+/**
+ * @brief The average time spent per frame in each stage of the pipeline, in seconds.
+ */
+struct PipelineStats
+{
+    double simulate; // Input, movement and network exchange.
+    double render;   // Raycasting into a frame buffer.
+    double present;  // Copy to the window image and upload to the X server.
+    double latency;  // From the start of the simulation of a frame to the end of its presentation.
+};
+
+/**
+ * @brief Runs the frames through three stages: simulate, render and present.
+ *
+ * The simulation stage (the caller of submit) handles the input and the network and hands a FrameState to the render
+ * thread. The render thread raycasts it with its own copies of the player and the map, then hands the frame buffer to
+ * the presentation stage (the caller of acquireFrame, the window thread). The stages are connected by bounded queues,
+ * so the network exchange and the presentation of frame N run while frame N+1 is rendered, and a slow stage throttles
+ * the stages before it. The number of frame buffers bounds the number of frames in flight, and thus the latency.
+ *
+ * A state in which neither the player nor the other players moved is not rendered nor presented, see
+ * Raycaster::renderChanges. The frames are otherwise drawn whole, since each frame buffer holds an older frame, but
+ * when only the other players moved, the walls, floor and ceiling are copied from the static layer instead of cast.
+ */
+class FramePipeline
+{
+public:
+    /**
+     * @brief Constructs a FramePipeline object.
+     *
+     * @param map The map of the game, copied for the render thread.
+     * @param player The player, whose pose is copied for the render thread.
+     * @param nbPlayers The number of other players, whose sprites are the first sprites of the map.
+     * @param width The width of the frames.
+     * @param height The height of the frames.
+     * @param maxFramesInFlight The maximum number of rendered frames waiting for presentation or being presented, at least 1.
+     */
+    FramePipeline(const Map &map, const Player &player, int nbPlayers, int width, int height, int maxFramesInFlight);
+
+    /**
+     * @brief Destructor for the FramePipeline object, which stops the render thread.
+     */
+    ~FramePipeline();
+
+    /**
+     * @brief Starts the render thread.
+     */
+    void start();
+
+    /**
+     * @brief Stops the render thread and wakes up every stage waiting on the pipeline.
+     */
+    void stop();
+
+    /**
+     * @brief Hands the state of a frame to the render stage, waiting while the render stage is busy with the previous one.
+     *
+     * @param player The player.
+     * @param map The map of the game, with the positions of the other players.
+     * @param start When the simulation of the frame started.
+     * @return False if the pipeline was stopped, true otherwise.
+     */
+    bool submit(const Player &player, const Map &map, std::chrono::steady_clock::time_point start);
+
+    /**
+     * @brief Takes the oldest rendered frame for presentation, without waiting.
+     *
+     * @param frame The frame to present, to be given back with releaseFrame.
+     * @return False if no frame is ready, true otherwise.
+     */
+    bool acquireFrame(Frame &frame);
+
+    /**
+     * @brief Gets a file descriptor that becomes readable when a frame is ready, so that the presentation stage can
+     * wait for frames with poll along with other events.
+     *
+     * @return The file descriptor, to be cleared with clearFrameReady once readable.
+     */
+    int getFrameReadyFd() const;
+
+    /**
+     * @brief Clears the frame-ready file descriptor. The frames ready must then be taken with acquireFrame.
+     */
+    void clearFrameReady();
+
+    /**
+     * @brief Makes the frame-ready file descriptor readable without a new frame, to wake up the presentation stage.
+     */
+    void wakePresenter();
+
+    /**
+     * @brief Gives a presented frame back to the render stage.
+     *
+     * @param frame The frame acquired with acquireFrame.
+     * @param presentTime The time (s) spent presenting the frame.
+     */
+    void releaseFrame(Frame &frame, double presentTime);
+
+    /**
+     * @brief Records the time spent in the simulation stage for one frame.
+     *
+     * @param simulateTime The time (s) spent simulating the frame.
+     */
+    void recordSimulate(double simulateTime);
+
+    /**
+     * @brief Gets the average time spent per frame in each stage, updated every second.
+     *
+     * @return The statistics of the stages.
+     */
+    PipelineStats getStats();
+
+    /**
+     * @brief Gets the maximum number of frames in flight.
+     *
+     * @return The maximum number of frames in flight.
+     */
+    int getMaxFramesInFlight() const;
+
+    /**
+     * @brief Gets the renderer of the render thread, to configure it before the pipeline is started.
+     *
+     * @return The renderer.
+     */
+    Raycaster &getRaycaster();
+
+private:
+    /**
+     * @brief Internal method that runs in the render thread.
+     */
+    void renderThreadFunction();
+
+    int nbPlayers;         // The number of other players.
+    int maxFramesInFlight; // The number of frame buffers handed to the presentation stage.
+
+    Map renderMap;             // The copy of the map used by the render thread.
+    Player renderPlayer;       // The copy of the player used by the render thread.
+    DoubleBuffer doubleBuffer; // The buffer in which the render thread draws.
+    Raycaster raycaster;       // The renderer of the render thread.
+
+    BoundedQueue<FrameState> states; // The states waiting to be rendered.
+    BoundedQueue<Frame> frames;      // The rendered frames waiting to be presented.
+    BoundedQueue<Frame> freeFrames;  // The frame buffers available to the render stage.
+
+    int frameReadyFd;         // The eventfd signaled when a frame is pushed to the presentation stage.
+    std::thread renderThread; // The thread running the render stage.
+    bool running;             // Whether the render thread is running.
+
+    std::mutex statsMutex; // Protects the averages, which are updated by every stage.
+    Average simulateTime;  // The average time spent in the simulation stage.
+    Average renderTime;    // The average time spent in the render stage.
+    Average presentTime;   // The average time spent in the presentation stage.
+    Average latency;       // The average time from the start of the simulation to the end of the presentation.
+};
+
+#endif
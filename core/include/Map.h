@@ -28,6 +28,20 @@ public:
         std::initializer_list<Texture> textures,
         std::vector<Sprite> &sprites);
 
+    /**
+     * @brief Gets the width of the map.
+     *
+     * @return The width of the map.
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Gets the height of the map.
+     *
+     * @return The height of the map.
+     */
+    int getHeight() const;
+
     /**
      * @brief Gets the value at the specified position in the map.
      *
@@ -37,6 +51,13 @@ public:
      */
     int get(int x, int y) const;
 
+    /**
+     * @brief Gets the values of the map, row by row: the value at (x, y) is at index x + y * width.
+     *
+     * @return The values of the map.
+     */
+    const std::vector<int> &getTiles() const;
+
     /**
      * @brief Gets the floor texture of the map.
      *
@@ -76,6 +97,37 @@ public:
      */
     const Texture &getTexture(int x, int y) const;
 
+    /**
+     * @brief Generates the fog levels of the textures of the walls, the floor and the ceiling, see
+     * Texture::generateFogLevels. Must be called before the map is copied for rendering.
+     *
+     * @param levels The number of fog levels, besides the textures themselves.
+     */
+    void setFogLevels(int levels);
+
+    /**
+     * @brief Gets the number of fog levels of the textures of the walls, the floor and the ceiling.
+     *
+     * @return The number of fog levels.
+     */
+    int getFogLevels() const;
+
+    /**
+     * @brief Sets how the texels of the textures of the walls, the floor, the ceiling and the sprites are stored, see
+     * Texture::setFormat. Must be called before the map is copied for rendering.
+     *
+     * @param format The texture format.
+     */
+    void setTextureFormat(TextureFormat format);
+
+    /**
+     * @brief Gets the memory read by the renderer for the textures of the walls, the floor and the ceiling, with their
+     * shades, see Texture::getBytes.
+     *
+     * @return The size in bytes.
+     */
+    long getTextureBytes() const;
+
     /**
      * @brief Moves the sprite of the player at the specified index to the specified position.
      *
@@ -85,6 +137,22 @@ public:
      */
     void movePlayer(int index, double x, double y);
 
+    /**
+     * @brief Gets the number of moves of the sprites, so that a renderer can tell whether they moved since the last
+     * frame. Moving a sprite to its own position does not count.
+     *
+     * @return The number of moves of the sprites.
+     */
+    unsigned long getSpriteVersion() const;
+
+    /**
+     * @brief Gets the number of changes of the textures (see setFogLevels and setTextureFormat), so that a renderer can
+     * tell whether what it kept of the last frames is out of date.
+     *
+     * @return The number of changes of the textures.
+     */
+    unsigned long getTextureVersion() const;
+
     /**
      * @brief Generates a map with the specified number of players.
      *
@@ -93,12 +161,25 @@ public:
      */
     static Map generateMap(int nbPlayers);
 
+    /**
+     * @brief Generates a square map closed by walls, with the walls of the game map placed at random inside, to measure
+     * the renderer on larger maps.
+     *
+     * @param size The width and height of the map.
+     * @param density One cell in density is a wall inside the map, or none if 0.
+     * @param seed The seed of the random placement.
+     * @return The generated map, without sprites.
+     */
+    static Map generateRandomMap(int size, int density, unsigned int seed);
+
 private:
     int width, height;                    // The width and height of the map.
     std::vector<int> map;                 // The map data.
     std::vector<Sprite> sprites;          // The list of sprites in the map.
     std::vector<Texture> textures;        // The list of textures for the walls.
     Texture floorTexture, ceilingTexture; // The textures for the floor and ceiling.
+    unsigned long spriteVersion;          // The number of moves of the sprites.
+    unsigned long textureVersion;         // The number of changes of the textures.
 };
 
 #endif
\ No newline at end of file
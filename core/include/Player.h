@@ -78,6 +78,23 @@ public:
      */
     void turn(double modifier);
 
+    /**
+     * @brief Set the position, direction and camera of the player, without checking for collisions.
+     *
+     * @param pos The position of the player.
+     * @param dir The direction vector of the player.
+     * @param cam The camera vector of the player.
+     */
+    void setPose(const Vector<double> &pos, const Vector<double> &dir, const Vector<double> &cam);
+
+    /**
+     * @brief Get the number of changes of the pose of the player, so that a renderer can tell whether it moved since
+     * the last frame.
+     *
+     * @return The number of changes of the pose.
+     */
+    unsigned long getPoseVersion() const;
+
     /**
      * @brief Generate a ray from the player's camera for raycasting.
      *
@@ -87,12 +104,13 @@ public:
     Vector<double> generateRay(double cameraX) const;
 
 private:
-    Vector<double> position;  // The position of the player.
-    Vector<double> direction; // The direction vector of the player.
-    Vector<double> camera;    // The camera vector of the player.
-    double moveSpeed;         // The movement speed of the player.
-    double rotSpeed;          // The rotation speed of the player.
-    Map &map;                 // The map object representing the game world.
+    Vector<double> position;   // The position of the player.
+    Vector<double> direction;  // The direction vector of the player.
+    Vector<double> camera;     // The camera vector of the player.
+    double moveSpeed;          // The movement speed of the player.
+    double rotSpeed;           // The rotation speed of the player.
+    unsigned long poseVersion; // The number of changes of the pose.
+    Map &map;                  // The map object representing the game world.
 
     /**
      * @brief Move the player along the x-axis.
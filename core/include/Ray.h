@@ -0,0 +1,72 @@
+#ifndef RAY_H
+#define RAY_H
+
+#include <Player.h>
+#include <Map.h>
+
+/**
+ * @brief The rays cast from the player through the columns of the screen.
+ */
+struct RayFan
+{
+    double dirX, dirY; // The direction vector of the player.
+    double camX, camY; // The camera vector of the player.
+    double posX, posY; // The position of the player.
+    int screenWidth;   // The number of columns of the screen.
+
+    /**
+     * @brief Constructs a RayFan object.
+     *
+     * @param player The player from which the rays are cast.
+     * @param screenWidth The number of columns of the screen.
+     */
+    RayFan(const Player &player, int screenWidth);
+};
+
+/**
+ * @brief Where the ray of a column hits a wall.
+ */
+struct RayHit
+{
+    double rayX, rayY; // The direction of the ray.
+    int mapX, mapY;    // The cell of the wall.
+    int side;          // 0 if the ray crossed a vertical grid line last (an x-side), 1 for a horizontal one.
+    double perpWallDist; // The distance of the wall from the camera plane.
+};
+
+/**
+ * @brief Casts the ray of a column with the DDA, one cell at a time.
+ *
+ * @param map The map, which must be closed by walls.
+ * @param fan The rays of the frame.
+ * @param x The column.
+ * @param hit Set to where the ray hits a wall.
+ */
+void traceRay(const Map &map, const RayFan &fan, int x, RayHit &hit);
+
+/**
+ * @brief Casts the ray of a column known to hit a wall on a given side, without stepping through the map.
+ *
+ * The distance is accumulated as traceRay does, one grid line at a time, so the hit is exactly the one traceRay
+ * would find. A ray between two rays hitting the same side of the same wall hits it too: the triangle they span
+ * with the player is narrower than a cell before the wall, so each cell it covers is crossed by one of the two rays.
+ *
+ * @param fan The rays of the frame.
+ * @param x The column.
+ * @param mapX The x-coordinate of the wall.
+ * @param mapY The y-coordinate of the wall.
+ * @param side The side of the wall hit, 0 for an x-side or 1 for a y-side.
+ * @param hit Set to where the ray hits the wall.
+ */
+void traceRayToWall(const RayFan &fan, int x, int mapX, int mapY, int side, RayHit &hit);
+
+/**
+ * @brief Counts the steps taken by the DDA of traceRay to reach a wall, one per cell read from the map.
+ *
+ * @param fan The rays of the frame.
+ * @param hit Where the ray hits the wall.
+ * @return The number of steps.
+ */
+int countDdaSteps(const RayFan &fan, const RayHit &hit);
+
+#endif
@@ -0,0 +1,424 @@
+#ifndef RAYCASTER_H
+#define RAYCASTER_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <Player.h>
+#include <DoubleBuffer.h>
+#include <Map.h>
+#include <Executor.h>
+#include <Strategies.h>
+#include <Average.h>
+#include <Ray.h>
+#include <WallSegments.h>
+
+/**
+ * @brief The Raycaster class is responsible for casting rays and rendering the scene in a 3D environment.
+ */
+class Raycaster
+{
+public:
+    /**
+     * @brief Constructs a Raycaster object.
+     * @param player The reference to the player from which the rays are cast.
+     * @param windowManager The reference to the WindowManager object for rendering the scene.
+     * @param map The reference to the Map object representing the game world.
+     */
+    Raycaster(Player &player, DoubleBuffer &doubleBuffer, Map &map);
+
+    /**
+     * @brief Sets the executor running the parallel loops of the passes.
+     *
+     * @param executor The executor, or nullptr to render on the calling thread only.
+     */
+    void setExecutor(Executor *executor);
+
+    /**
+     * @brief Renders the scene: walls, floor and ceiling, then sprites.
+     */
+    void render();
+
+    /**
+     * @brief Renders what changed since the last frame drawn by render or renderChanges, as told by the versions of
+     * the pose of the player and of the sprites and textures of the map: nothing if neither they nor the resolution
+     * changed, only the sprites over the static layer if only sprites moved, and the whole scene otherwise.
+     *
+     * The static layer is the walls, floor and ceiling of the view, kept in the layer of the double buffer, with the
+     * depths of the walls. It is saved by the first frame in which only sprites moved, so that the frames of a moving
+     * player do not pay for the copy, and kept until the view or the textures change. When the back buffer holds the
+     * last frame, only the columns covered by the sprites that moved (before or after their move) are restored from
+     * the layer and redrawn over it (see DoubleBuffer::reopenBackBuffer); otherwise, as when the frames are handed to
+     * another thread, the whole layer is restored and every sprite drawn over it.
+     *
+     * @return False if nothing changed, in which case nothing is drawn and the double buffer must not be swapped.
+     */
+    bool renderChanges();
+
+    /**
+     * @brief Gets the fraction of the columns redrawn by the last renderChanges.
+     *
+     * @return 1 for a whole frame, 0 if nothing changed.
+     */
+    double getRedrawnFraction() const;
+
+    /**
+     * @brief Casts rays to render the floor and ceiling of the scene.
+     *
+     * Each column is filled with vertical spans above and below the span covered by the wall, so that every pixel is
+     * written once. castWalls must be called first in each frame.
+     */
+    void castFloorCeiling();
+
+    /**
+     * @brief Casts rays to render the walls of the scene, and records the rows covered by the wall in each column.
+     */
+    void castWalls();
+
+    /**
+     * @brief Sets whether the floor and ceiling are rendered at half resolution.
+     *
+     * At half resolution, one pixel out of four is cast (even rows and columns) and the others are interpolated
+     * bilinearly, which blurs the textures slightly.
+     *
+     * @param halfResolution True to render the floor and ceiling at half resolution, false to cast every pixel.
+     */
+    void setHalfResolutionFloor(bool halfResolution);
+
+    /**
+     * @brief Casts rays to render the sprites in the scene.
+     */
+    void castSprites();
+
+    /**
+     * @brief Sets how the rays of the walls are cast: one column at a time, or adaptively: the columns
+     * WALL_SUBDIVISION apart are cast first, the gaps between two rays hitting different walls or sides are halved until
+     * they hit the same one, and the columns left are filled with traceRayToWall. Both draw the same frames.
+     *
+     * @param traversal The traversal of the rays, scalar by default.
+     */
+    void setTraversal(Traversal traversal);
+
+    /**
+     * @brief Sets how the walls seen by the columns are found: by casting a ray through the map in each column, or by
+     * projecting the faces of the walls (see WallSegments), which are extracted from the map when first selected.
+     *
+     * @param wallEngine The wall engine, raycast by default.
+     */
+    void setWallEngine(WallEngine wallEngine);
+
+    /**
+     * @brief Sets which walls of the last frame are reused. With the rotation reprojection, when the player only turned
+     * since the last walls cast by rays, at the same width, each column is mapped to the
+     * last frame: if the columns of the last frame on either side of its ray (one more on each side, for the roundings
+     * of the mapping) hit the same side of the same wall, its ray hits it too, as in the adaptive traversal, and
+     * traceRayToWall finds the hit without reading the map. The other columns, out of the last field of view or at the
+     * edges of the walls, are cast one by one. The frames are the same.
+     *
+     * @param reprojection The reprojection, none by default.
+     */
+    void setReprojection(Reprojection reprojection);
+
+    /**
+     * @brief Gets the fraction of the columns whose wall was reprojected from the last frame in the last castWalls.
+     *
+     * @return The fraction of the columns, 0 if none was.
+     */
+    double getReprojectedFraction() const;
+
+    /**
+     * @brief Sets the distance over which the walls, the floor and the ceiling fade into the fog levels of the textures
+     * of the map (see Map::setFogLevels), which must be generated first. The fog level of each distance is read from a
+     * table, once per column of the walls and once per row of the floor and ceiling, so the pixels are still copied
+     * from the textures. The sprites are not fogged.
+     *
+     * @param distance The distance at which the last fog level is reached, 0 (the default) for no fog.
+     */
+    void setFogDistance(double distance);
+
+    /**
+     * @brief Gets the number of wall rays cast per second by castWalls, averaged over the last second.
+     *
+     * @return The number of rays per second.
+     */
+    double getRaysPerSecond();
+
+    /**
+     * @brief Gets the number of DDA steps taken by the rays of the walls in the last castWalls, one per cell read from
+     * the map.
+     *
+     * @return The number of steps.
+     */
+    long getDdaSteps() const;
+
+private:
+    /**
+     * @brief The floor seen by a row of the screen.
+     */
+    struct FloorRow
+    {
+        double basisX, basisY; // The real world coordinates of the floor seen in the leftmost column.
+        double stepX, stepY;   // The change of the coordinates from one column to the next.
+        int shade;             // The shade of the floor and ceiling textures at the distance of the row.
+    };
+
+    /**
+     * @brief The wall hit by the ray of a column.
+     */
+    struct WallHit
+    {
+        int mapX, mapY; // The cell of the wall.
+        int side;       // The side of the wall hit, 0 for an x-side or 1 for a y-side.
+    };
+
+    /**
+     * @brief The position and size on screen of a sprite in front of the camera.
+     */
+    struct SpriteProjection
+    {
+        int sprite;               // The index of the sprite in the map.
+        double transformY;        // The depth of the sprite.
+        int screenX;              // The column of the center of the sprite.
+        int width, height;        // The size of the sprite on screen.
+        int drawStartX, drawEndX; // The first column drawn and the column after the last one.
+        int drawStartY, drawEndY; // The first row drawn and the row after the last one.
+    };
+
+    static int const SPAN_BLOCK = 256;  // The number of columns whose floor and ceiling spans are filled together.
+    static int const WALL_CHUNK = 16;   // The number of wall columns handed to a thread at once.
+    static int const SAMPLE_CHUNK = 8;  // The number of floor rows cast at half resolution handed to a thread at once.
+    static int const SPRITE_CHUNK = 32; // The number of columns in which a thread draws the sprites at once.
+    static int const WALL_SUBDIVISION = 8; // The distance between the columns cast first by the adaptive traversal.
+    static int const SEGMENT_CHUNK = 64;   // The number of columns whose faces are found together by the segments.
+    static int const REPROJECTION_BLOCK = 64; // The number of columns mapped to the last frame at once.
+    static int const FOG_TABLE_SIZE = 256; // The number of distances in the fog table, up to the fog distance.
+
+    Player &player;               // The reference to the Player object.
+    DoubleBuffer &doubleBuffer;   // The double buffer for rendering the scene.
+    Map &map;                     // The map of the game.
+    Executor *executor;           // The executor running the parallel loops, nullptr to render on the calling thread.
+
+    int screenWidth, screenHeight;        // The screen width and height of the frame being rendered.
+    const Texture &floorTexture, &ceilingTexture; // The textures for the floor and ceiling.
+
+    std::vector<double> zBuffer;        // The buffer for storing the distance of the walls from the player (used for rendering sprites).
+    std::vector<int> wallStart;         // The first row covered by the wall in each column.
+    std::vector<int> wallEnd;           // The last row covered by the wall in each column.
+    bool halfResolutionFloor;           // Whether the floor and ceiling are rendered at half resolution.
+    Traversal traversal;                // How the rays of the walls are cast, see setTraversal.
+    Average raysPerSecond;              // The number of wall rays cast per second.
+    std::atomic<long> ddaSteps;         // The number of DDA steps taken by the rays of the walls in the frame.
+    WallEngine wallEngine;              // How the walls are found, see setWallEngine.
+    std::unique_ptr<WallSegments> wallSegments; // The faces of the walls, once the segments engine is selected.
+    Reprojection reprojection;          // Which walls of the last frame are reused, see setReprojection.
+    std::vector<WallHit> wallHits;      // The wall hit by each column in the frame.
+    std::vector<WallHit> lastWallHits;  // The wall hit by each column in the last castWalls.
+    RayFan lastFan;             // The rays of the last castWalls.
+    bool lastWallsCast;                 // Whether the walls of the last castWalls were found by casting rays.
+    bool reprojecting;                  // Whether the walls of the frame are reprojected from the last castWalls.
+    std::atomic<long> reprojectedColumns; // The number of columns whose wall was reprojected in the frame.
+    double reprojectedFraction;         // The fraction of the columns whose wall was reprojected in the last castWalls.
+    std::vector<int> fogTable;          // The fog level of each distance, empty without fog.
+    double fogTableScale;               // The number of entries of the fog table per unit of distance.
+    std::vector<FloorRow> floorRows;    // The floor seen by each row below the horizon, computed once per frame.
+    std::vector<unsigned int> floorSamples;   // The floor colors cast at half resolution.
+    std::vector<unsigned int> ceilingSamples; // The ceiling colors cast at half resolution.
+    std::vector<int> spriteOrder;       // The order of the sprites for rendering.
+    std::vector<double> spriteDistance; // The distances of the sprites from the player.
+    std::vector<SpriteProjection> projections; // The projections of the sprites in front of the camera, from far to close.
+    int numSprites;                     // The number of sprites in the map.
+    bool frameDrawn;                    // Whether a frame was drawn with the current settings.
+    unsigned long drawnPoseVersion;     // The version of the pose of the player in the last frame drawn.
+    unsigned long drawnSpriteVersion;   // The version of the sprites of the map in the last frame drawn.
+    unsigned long drawnTextureVersion;  // The version of the textures of the map in the last frame drawn.
+    int drawnWidth, drawnHeight;        // The resolution of the last frame drawn.
+    std::vector<Vector<double>> drawnSprites;       // The positions of the sprites in the last frame drawn.
+    std::vector<SpriteProjection> drawnProjections; // The projections of the sprites in the last frame drawn.
+    bool layerSaved;                    // Whether the layer of the double buffer and zBuffer hold the static layer.
+    double redrawnFraction;             // The fraction of the columns redrawn by the last renderChanges.
+
+    /**
+     * @brief Runs a loop with the executor, or on the calling thread if there is none.
+     *
+     * @param count The number of iterations.
+     * @param chunkSize The number of consecutive iterations handed to a thread at once.
+     * @param body The function running the iterations from its first argument (included) to its second one (excluded).
+     */
+    void parallelFor(int count, int chunkSize, const std::function<void(int, int)> &body);
+
+    /**
+     * @brief Runs a loop and a task independent of it with the executor, see Executor::parallelFor, or both on the
+     * calling thread if there is none.
+     */
+    void parallelFor(int count, int chunkSize, const std::function<void(int, int)> &body,
+                     const std::function<void()> &task);
+
+    /**
+     * @brief Casts the walls as castWalls does, and runs a task alongside the columns.
+     *
+     * @param task The task, which must not depend on the walls of the frame.
+     */
+    void castWalls(const std::function<void()> &task);
+
+    /**
+     * @brief Draws the sprites over the frame, from the projections of updateSpriteProjections.
+     */
+    void drawSprites();
+
+    /**
+     * @brief Renders the walls of a range of columns.
+     *
+     * @param xBegin The first column.
+     * @param xEnd The column after the last one.
+     */
+    void castWallColumns(int xBegin, int xEnd);
+
+    /**
+     * @brief Finds the wall of the last castWalls hit by the ray of a column, if the rays of the last frame around it
+     * hit the same side of the same wall, see setReprojection.
+     *
+     * @param x The column.
+     * @return The wall, or nullptr if the column must be cast.
+     */
+    const WallHit *findReprojectedWall(int x) const;
+
+    /**
+     * @brief Renders the walls of a range of columns with the projected segments.
+     *
+     * @param fan The rays of the frame.
+     * @param xBegin The first column.
+     * @param xEnd The column after the last one.
+     */
+    void castWallSegments(const RayFan &fan, int xBegin, int xEnd);
+
+    /**
+     * @brief Casts the rays between two cast rays of the adaptive traversal, halving the gap until both ends hit the
+     * same side of the same wall.
+     *
+     * @param fan The rays of the frame.
+     * @param x The column of the first hit.
+     * @param hits The hits from column x, those of the two ends being set.
+     * @param first The index in hits of the first end.
+     * @param last The index in hits of the last end.
+     * @return The number of DDA steps taken.
+     */
+    long subdivideWallColumns(const RayFan &fan, int x, RayHit *hits, int first, int last);
+
+    /**
+     * @brief Draws the wall hit by the ray of a column, and records its rows and distance.
+     *
+     * @param x The column.
+     * @param hit Where the ray hit the wall.
+     * @param posX The x-coordinate of the player.
+     * @param posY The y-coordinate of the player.
+     * @return The number of pixels drawn.
+     */
+    int drawWallColumn(int x, const RayHit &hit, double posX, double posY);
+
+    /**
+     * @brief Fills the floor and ceiling spans of a block of columns.
+     *
+     * @param x0 The first column of the block.
+     */
+    void castFloorCeilingBlock(int x0);
+
+    /**
+     * @brief Renders the floor and ceiling at half resolution, see setHalfResolutionFloor.
+     */
+    void castFloorCeilingHalf();
+
+    /**
+     * @brief Casts the floor and ceiling colors of a range of even rows at half resolution.
+     *
+     * @param begin The first pair of rows.
+     * @param end The pair of rows after the last one.
+     */
+    void castFloorSampleRows(int begin, int end);
+
+    /**
+     * @brief Fills the floor and ceiling spans of a block of columns with the colors cast at half resolution.
+     *
+     * @param x0 The first column of the block.
+     */
+    void castFloorCeilingHalfBlock(int x0);
+
+    /**
+     * @brief Gets the first row of a block of columns where the floor or the ceiling is visible, and the visible
+     * spans of each column.
+     *
+     * @param x0 The first column of the block.
+     * @param x1 The column after the last one.
+     * @param floorStart Set to the first floor row of each column.
+     * @param ceilingEnd Set to the ceiling row after the last one of each column.
+     * @param writes Increased by the number of pixels of the spans.
+     * @return The first floor row where a floor or a ceiling span is visible.
+     */
+    int getSpans(int x0, int x1, int *floorStart, int *ceilingEnd, long &writes) const;
+
+    /**
+     * @brief Gets the coordinates in the floor (and ceiling) texture of the floor seen by a pixel.
+     *
+     * @param row The floor seen by the row of the pixel.
+     * @param x The column of the pixel.
+     * @param tx The x-coordinate in the texture.
+     * @param ty The y-coordinate in the texture.
+     */
+    void getFloorTexel(const FloorRow &row, int x, int &tx, int &ty) const;
+
+    /**
+     * @brief Gets the fog level at a distance from the camera plane.
+     *
+     * @param distance The distance.
+     * @return The fog level, 0 without fog.
+     */
+    int getFogLevel(double distance) const;
+
+    /**
+     * @brief Updates the screen size with the resolution at which the double buffer is rendered.
+     */
+    void updateScreenSize();
+
+    /**
+     * @brief Computes the distances of the sprites from the player and sorts them.
+     */
+    void sortSpritesByDistance();
+
+    /**
+     * @brief Sorts and projects the sprites.
+     */
+    void updateSpriteProjections();
+
+    /**
+     * @brief Gets the columns covered by the sprites that moved since the last frame drawn, in this frame or in the
+     * last one. The sprites must be projected first.
+     *
+     * @return The ranges of columns, in order and disjoint.
+     */
+    std::vector<ColumnRange> getMovedSpriteColumns() const;
+
+    /**
+     * @brief Records the state of the frame drawn, compared to the next ones by renderChanges.
+     */
+    void recordFrame();
+
+    /**
+     * @brief Projects the sorted sprites on the screen.
+     */
+    void projectSprites();
+
+    /**
+     * @brief Draws the projected sprites in a range of columns.
+     *
+     * @param xBegin The first column.
+     * @param xEnd The column after the last one.
+     */
+    void drawSpriteColumns(int xBegin, int xEnd);
+
+    /**
+     * @brief Sorts the sprites based on their distance from the player.
+     */
+    void sortSprites();
+};
+
+#endif
\ No newline at end of file
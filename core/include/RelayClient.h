@@ -0,0 +1,66 @@
+#ifndef RELAYCLIENT_H
+#define RELAYCLIENT_H
+
+#include <vector>
+#include <map>
+
+#include <UDPReceiver.h>
+#include <UDPSender.h>
+#include <Snapshot.h>
+#include <Map.h>
+
+/**
+ * @brief The RelayClient class exchanges the positions of the players through a relay instead of sending them to every player.
+ *
+ * The client sends its position to the relay only, and receives the positions of all the other players batched in snapshots.
+ */
+class RelayClient
+{
+public:
+    /**
+     * @brief Constructs a RelayClient object.
+     *
+     * @param receiver The receiver on which the snapshots of the relay arrive.
+     * @param sender The sender to the relay.
+     * @param listeningPort The port of the receiver, to which the relay sends the snapshots.
+     * @param nbPlayers The maximum number of other players.
+     */
+    RelayClient(UDPReceiver &receiver, UDPSender &sender, int listeningPort, int nbPlayers);
+
+    /**
+     * @brief Sends the position of the player to the relay.
+     *
+     * @param x The x-coordinate of the player.
+     * @param y The y-coordinate of the player.
+     */
+    void send(double x, double y);
+
+    /**
+     * @brief Receives the pending snapshots and moves the other players of the map accordingly.
+     *
+     * @param map The map of the game.
+     * @return The number of snapshots received.
+     */
+    int receive(Map &map);
+
+    /**
+     * @brief Gets the number of snapshots that were lost, or arrived too late to be used.
+     *
+     * @return The number of snapshots lost.
+     */
+    long getLostSnapshots() const;
+
+private:
+    UDPReceiver &receiver;           // The receiver on which the snapshots arrive.
+    UDPSender &sender;               // The sender to the relay.
+    int listeningPort;               // The port of the receiver.
+    int nbPlayers;                   // The maximum number of other players.
+    std::vector<double> buffer;      // The buffer in which the snapshots are received.
+    Snapshot snapshot;               // The last snapshot received.
+    long lastTick;                   // The tick of the last snapshot used, -1 before the first one.
+    long lostSnapshots;              // The number of snapshots lost.
+    int nextPlayerIndex;             // The index given to the next new player.
+    std::map<int, int> playersIndexes; // Maps the identifiers given by the relay to player indexes.
+};
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef REMOTEPOSITIONS_H
+#define REMOTEPOSITIONS_H
+
+#include <vector>
+#include <atomic>
+
+#include <Vector.h>
+
+/**
+ * @brief Lock-free single-producer/single-consumer snapshot of the remote players' positions.
+ *
+ * The positions are triple buffered: the writer fills a private back buffer and atomically exchanges it with
+ * the shared middle buffer, while the reader exchanges the middle buffer with its private front buffer when a
+ * newer snapshot is available. Neither side ever waits for the other and the reader always sees a complete,
+ * consistent set of positions.
+ */
+class RemotePositions
+{
+public:
+    /**
+     * @brief Constructs a RemotePositions object for the specified number of players.
+     *
+     * @param nbPlayers The number of remote players.
+     */
+    RemotePositions(int nbPlayers);
+
+    /**
+     * @brief Updates the position of a player and publishes a new snapshot. Must only be called by the writer thread.
+     *
+     * @param index The index of the player.
+     * @param x The x-coordinate of the position.
+     * @param y The y-coordinate of the position.
+     */
+    void publish(int index, double x, double y);
+
+    /**
+     * @brief Gets the latest published snapshot. Must only be called by the reader thread.
+     *
+     * The returned reference stays valid and unchanged until the next call to this method.
+     *
+     * @return The positions of the remote players.
+     */
+    const std::vector<Vector<double>> &acquire();
+
+private:
+    static int const DIRTY = 4; // Flag set in the middle index when it holds a snapshot the reader has not seen yet.
+
+    std::vector<Vector<double>> positions;  // The current positions, owned by the writer.
+    std::vector<Vector<double>> buffers[3]; // The back, middle and front buffers.
+    std::atomic<int> middle;                // The index of the middle buffer, possibly combined with the DIRTY flag.
+    int back;                               // The index of the buffer owned by the writer.
+    int front;                              // The index of the buffer owned by the reader.
+};
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef SENDSCHEDULER_H
+#define SENDSCHEDULER_H
+
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+/**
+ * @brief The SendScheduler class sends the player's position to all the peers (or to the relay) from a single thread, at a fixed tick rate.
+ *
+ * Position changes notified between two ticks are coalesced: only the latest position is sent, once per tick and per peer.
+ * When the position does not change, a heartbeat is still sent at a lower rate so that the peers keep seeing the player.
+ * Notifying a change only stores the position, so its cost for the rendering thread does not depend on the number of peers.
+ */
+class SendScheduler
+{
+public:
+    /**
+     * @brief Constructs a SendScheduler object.
+     *
+     * @param send The function sending a position to every peer, called from the scheduler thread.
+     * @param tickRate The maximum number of packets sent per second to each peer.
+     * @param heartbeatInterval The time interval in seconds after which the position is sent again even if it did not change.
+     */
+    SendScheduler(const std::function<void(double, double)> &send, double tickRate, double heartbeatInterval);
+
+    /**
+     * @brief Stops the scheduler thread if it is running.
+     */
+    ~SendScheduler();
+
+    /**
+     * @brief Starts the scheduler thread.
+     */
+    void startThread();
+
+    /**
+     * @brief Stops the scheduler thread.
+     */
+    void stopThread();
+
+    /**
+     * @brief Records the new position of the player. It is sent at the next tick.
+     *
+     * @param x The x coordinate to send.
+     * @param y The y coordinate to send.
+     */
+    void notifyPositionChanged(double x, double y);
+
+private:
+    void schedulerThread();
+
+    std::function<void(double, double)> send;         // The function sending a position to every peer.
+    std::chrono::steady_clock::duration tickInterval; // The time interval between two ticks.
+    std::chrono::steady_clock::duration heartbeat;    // The time interval after which an unchanged position is sent again.
+
+    std::thread thread;                // The scheduler thread
+    std::mutex mutex;                  // Mutex for protecting shared data
+    std::condition_variable condition; // Condition variable used to wake the thread up when it must stop
+    bool stillRunning;                 // Flag to control thread execution
+
+    // Latest position notified by the rendering thread
+    double currentX;
+    double currentY;
+    bool positionChanged; // Flag indicating if position has changed since the last tick
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <vector>
+
+/**
+ * @brief The position of one player in a snapshot.
+ */
+struct SnapshotEntry
+{
+    int id;   // The identifier given by the relay to the player.
+    double x; // The x-coordinate of the player.
+    double y; // The y-coordinate of the player.
+};
+
+/**
+ * @brief The positions of the players, batched by the relay into a single datagram per tick and per client.
+ *
+ * On the wire, a snapshot is a sequence of doubles: the identifier of the recipient, the tick of the relay,
+ * the number of entries, then the identifier and the coordinates of each entry.
+ */
+struct Snapshot
+{
+    static int const MAX_ENTRIES = 1024;                   // The maximum number of entries in a snapshot.
+    static int const MAX_VALUES = 3 + 3 * MAX_ENTRIES;     // The maximum number of values of an encoded snapshot.
+
+    int recipient;                      // The identifier of the client to which the snapshot is sent.
+    long tick;                          // The tick of the relay at which the snapshot was sent, used to detect lost snapshots.
+    std::vector<SnapshotEntry> entries; // The positions of the players.
+
+    /**
+     * @brief Encodes the snapshot.
+     *
+     * @param values The buffer in which the snapshot is encoded, of at least MAX_VALUES values.
+     * @return The number of values written.
+     */
+    int encode(double *values) const;
+
+    /**
+     * @brief Decodes a snapshot.
+     *
+     * @param values The received values.
+     * @param nbValues The number of received values.
+     * @return True if the values form a valid snapshot, false otherwise.
+     */
+    bool decode(const double *values, int nbValues);
+};
+
+#endif
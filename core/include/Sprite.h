@@ -27,6 +27,13 @@ public:
      */
     unsigned int get(int x, int y) const;
 
+    /**
+     * @brief Sets how the texels of the texture of the sprite are stored, see Texture::setFormat.
+     *
+     * @param format The texture format.
+     */
+    void setTextureFormat(TextureFormat format);
+
     /**
      * @brief Gets the width of the sprite.
      *
@@ -0,0 +1,152 @@
+#ifndef STRATEGIES_H
+#define STRATEGIES_H
+
+#include <string>
+
+/**
+ * @brief How the passes of the renderer are split between threads.
+ */
+enum class ThreadingStrategy
+{
+    NONE,   // Every pass runs on the calling thread.
+    OPENMP, // The passes run in OpenMP parallel loops, whose threads are managed by the OpenMP runtime.
+    POOL    // The passes run on a ThreadPool created once, the calling thread taking part in each loop.
+};
+
+/**
+ * @brief How the frames are rendered and presented.
+ */
+enum class DisplayStrategy
+{
+    SYNC,    // The main thread renders each frame and copies it to the window.
+    THREADED // The frames go through a FramePipeline, rendered by its thread and presented by the window thread.
+};
+
+/**
+ * @brief How the positions of the other players are received.
+ */
+enum class ReceiveStrategy
+{
+    INLINE, // The main thread reads the pending packets once per frame.
+    THREAD  // A thread of the UDPReceiver reads the packets and publishes the positions through RemotePositions.
+};
+
+/**
+ * @brief How the position of the player is sent.
+ */
+enum class SendStrategy
+{
+    INLINE, // The main thread sends the position to every peer once per frame.
+    THREAD  // A SendScheduler sends the latest position from its own thread, at a fixed tick rate.
+};
+
+/**
+ * @brief How the rays of the walls are cast.
+ */
+enum class Traversal
+{
+    SCALAR,  // Each ray is cast on its own.
+    ADAPTIVE // Every few columns are cast, the columns between two rays hitting the same side of a wall are filled.
+};
+
+/**
+ * @brief How the walls are found for each column.
+ */
+enum class WallEngine
+{
+    RAYCAST, // A ray is cast through the cells of the map for each column, see Traversal.
+    SEGMENTS // The faces of the walls are projected on the screen, each column keeping the closest one.
+};
+
+/**
+ * @brief How the texels of the textures are stored.
+ */
+enum class TextureFormat
+{
+    DIRECT, // Each texel is a 32-bit color, each shade a copy of the texture.
+    INDEXED // Each texel is an 8-bit index in a palette of 256 colors, each shade a copy of the palette.
+};
+
+/**
+ * @brief Which walls of the last frame are reused for the next one.
+ */
+enum class Reprojection
+{
+    NONE,    // The walls of each frame are cast from scratch.
+    ROTATION // When the player only turned, the columns between two columns of the last frame hitting the same side of
+             // a wall are moved to that wall without being cast, with the same hits.
+};
+
+/**
+ * @brief Parses a threading strategy: none, openmp or pool.
+ *
+ * @param name The name of the strategy.
+ * @return The strategy.
+ * @throws std::invalid_argument If the name is not one of the strategies.
+ */
+ThreadingStrategy parseThreading(const std::string &name);
+
+/**
+ * @brief Parses a display strategy: sync or threaded.
+ *
+ * @param name The name of the strategy.
+ * @return The strategy.
+ * @throws std::invalid_argument If the name is not one of the strategies.
+ */
+DisplayStrategy parseDisplay(const std::string &name);
+
+/**
+ * @brief Parses a receive strategy: inline or thread.
+ *
+ * @param name The name of the strategy.
+ * @return The strategy.
+ * @throws std::invalid_argument If the name is not one of the strategies.
+ */
+ReceiveStrategy parseReceive(const std::string &name);
+
+/**
+ * @brief Parses a send strategy: inline or thread.
+ *
+ * @param name The name of the strategy.
+ * @return The strategy.
+ * @throws std::invalid_argument If the name is not one of the strategies.
+ */
+SendStrategy parseSend(const std::string &name);
+
+/**
+ * @brief Parses a traversal: scalar or adaptive.
+ *
+ * @param name The name of the traversal.
+ * @return The traversal.
+ * @throws std::invalid_argument If the name is not one of the traversals.
+ */
+Traversal parseTraversal(const std::string &name);
+
+/**
+ * @brief Parses a wall engine: raycast or segments.
+ *
+ * @param name The name of the wall engine.
+ * @return The wall engine.
+ * @throws std::invalid_argument If the name is not one of the wall engines.
+ */
+WallEngine parseWallEngine(const std::string &name);
+
+/**
+ * @brief Parses a texture format: direct or indexed.
+ *
+ * @param name The name of the texture format.
+ * @return The texture format.
+ * @throws std::invalid_argument If the name is not one of the texture formats.
+ */
+TextureFormat parseTextureFormat(const std::string &name);
+
+/**
+ * @brief Parses a reprojection: none or rotation.
+ *
+ * @param name The name of the reprojection.
+ * @return The reprojection.
+ * @throws std::invalid_argument If the name is not one of the reprojections.
+ */
+Reprojection parseReprojection(const std::string &name);
+
+#endif
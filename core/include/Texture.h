@@ -0,0 +1,204 @@
+#ifndef TEXTURE_H
+#define TEXTURE_H
+
+#include <vector>
+#include <memory>
+
+#include <Strategies.h>
+
+/**
+ * @brief The Texture class represents a texture.
+ *
+ * The texture also stores shaded copies of its pixels, so that the renderer draws shaded pixels by copying them: the
+ * side shade of the walls (half brightness), and optionally fog levels darkening the texture with the distance, each
+ * with its own side shade. The shades are numbered by getShade, 0 being the texture itself.
+ *
+ * In the indexed format, the texels are 8-bit indices in a palette of 256 colors, and the shades are copies of the
+ * palette instead of the texture: a 64x64 texture takes 4 KiB instead of 16 KiB, plus 1 KiB per shade.
+ *
+ * A texture made from a TextureTable reads its pixels and their side shade in place from read-only memory. The pixels
+ * generated at run time (the copies of other pixels, and the fog levels) are shared by the copies of the texture, so
+ * copying a texture does not copy its pixels.
+ */
+class Texture
+{
+public:
+    /**
+     * @brief Constructs a Texture object with the specified width, height, and orientation.
+     *
+     * @param width The width of the texture.
+     * @param height The height of the texture.
+     * @param isVertical Whether the texture is stored vertically.
+     * Depending on the use case, this can prevent cache misses and improve performance.
+     */
+    Texture(int width, int height, bool isVertical);
+
+    /**
+     * @brief Constructs a Texture object with the specified width, height, pixels, and orientation.
+     *
+     * @param width The width of the texture.
+     * @param height The height of the texture.
+     * @param pixels An array of pixels representing the texture. These values are copied to the texture.
+     * @param isVertical Whether the texture is stored vertically.
+     * Depending on the use case, this can prevent cache misses and improve performance.
+     */
+    Texture(int width, int height, const unsigned int *pixels, bool isVertical);
+
+    /**
+     * @brief Makes a Texture object reading its pixels in place from a table laid out at compile time, see
+     * TextureTable.
+     *
+     * @param width The width of the texture.
+     * @param height The height of the texture.
+     * @param table The pixels stored in the orientation given, followed by their side shade. They are not copied, and
+     * must outlive the texture and its copies.
+     * @param isVertical Whether the pixels of the table are stored vertically.
+     * @return The texture.
+     */
+    static Texture fromTable(int width, int height, const unsigned int *table, bool isVertical);
+
+    /**
+     * @brief Gets the pixel value at the specified coordinates.
+     *
+     * @param x The x-coordinate of the pixel.
+     * @param y The y-coordinate of the pixel.
+     * @return The pixel value at the specified coordinates.
+     */
+    unsigned int get(int x, int y) const;
+
+    /**
+     * @brief Gets the pixel value at the specified coordinates in a shade of the texture.
+     *
+     * @param x The x-coordinate of the pixel.
+     * @param y The y-coordinate of the pixel.
+     * @param shade The shade, see getShade.
+     * @return The shaded pixel value at the specified coordinates.
+     */
+    unsigned int get(int x, int y, int shade) const;
+
+    /**
+     * @brief Gets the width of the texture.
+     *
+     * @return The width of the texture.
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Gets the height of the texture.
+     *
+     * @return The height of the texture.
+     */
+    int getHeight() const;
+
+    /**
+     * @brief Gets whether the texture is stored vertically, column by column.
+     *
+     * @return True if the pixel at (x, y) is at index y + x * height, false if it is at index x + y * width.
+     */
+    bool isStoredVertically() const;
+
+    /**
+     * @brief Gets the pixels of a shade of the texture, in the order given by isStoredVertically.
+     *
+     * @param shade The shade, see getShade. 0 for the texture itself.
+     * @return The pixels of the shade. In the indexed format, only the texture itself is kept.
+     */
+    const unsigned int *getPixels(int shade = 0) const;
+
+    /**
+     * @brief Sets how the texels are stored, generating the palette and the indices in the indexed format. A texture
+     * of more than 256 colors stays in the direct format.
+     *
+     * @param format The texture format.
+     */
+    void setFormat(TextureFormat format);
+
+    /**
+     * @brief Gets how the texels are stored.
+     *
+     * @return The texture format.
+     */
+    TextureFormat getFormat() const;
+
+    /**
+     * @brief Gets the palette indices of the texels in the indexed format, in the order given by isStoredVertically.
+     *
+     * @return The indices of the texels.
+     */
+    const unsigned char *getIndices() const;
+
+    /**
+     * @brief Gets the palette of a shade in the indexed format, 256 colors.
+     *
+     * @param shade The shade, see getShade.
+     * @return The colors of the palette.
+     */
+    const unsigned int *getPalette(int shade) const;
+
+    /**
+     * @brief Generates the fog levels of the texture and their side shades, replacing the previous ones.
+     *
+     * Fog level i, from 0 (no fog) to levels, scales the channels by (levels + 1 - i) / (levels + 1).
+     *
+     * @param levels The number of fog levels, besides the texture itself.
+     */
+    void generateFogLevels(int levels);
+
+    /**
+     * @brief Gets the number of fog levels of the texture, besides the texture itself.
+     *
+     * @return The number of fog levels.
+     */
+    int getFogLevels() const;
+
+    /**
+     * @brief Gets the memory read by the renderer: the shades of the texture in the direct format, the indices and the
+     * shades of the palette in the indexed format.
+     *
+     * @return The size in bytes.
+     */
+    long getBytes() const;
+
+    /**
+     * @brief Gets the index of a shade.
+     *
+     * @param fogLevel The fog level, 0 without fog.
+     * @param sideShade Whether the side shade is applied (the y-sides of the walls, the floor and the ceiling).
+     * @return The shade.
+     */
+    static int getShade(int fogLevel, bool sideShade);
+
+private:
+    static int const PALETTE_SIZE = 256; // The number of colors of a palette in the indexed format.
+
+    int width;                                                // The width of the texture.
+    int height;                                               // The height of the texture.
+    const unsigned int *pixels;                               // The pixels of the texture, followed by its shades.
+    const unsigned int *table;                                // The table of the pixels and their side shade, or null.
+    std::shared_ptr<const std::vector<unsigned int>> storage; // The pixels generated at run time, or null.
+    bool isVertical;                                          // Whether the texture is stored vertically.
+    int fogLevels;                                            // The number of fog levels.
+    TextureFormat format;                                     // How the texels are stored.
+    std::vector<unsigned char> indices;                       // In the indexed format, the palette index of each pixel.
+    std::vector<unsigned int> palettes;                       // In the indexed format, the palette followed by its shades.
+
+    /**
+     * @brief Constructs a Texture object reading its pixels in place from a table, see fromTable.
+     */
+    Texture(int width, int height, bool isVertical, const unsigned int *table);
+
+    /**
+     * @brief Computes the shades of the texture from its pixels, or of the palette in the indexed format. The pixels
+     * are read from the table when it has all the shades needed.
+     */
+    void generateShades();
+
+    /**
+     * @brief Replaces the pixels of the texture by pixels generated at run time.
+     *
+     * @param pixels The pixels of the texture, followed by its shades.
+     */
+    void setStorage(std::vector<unsigned int> &&pixels);
+};
+
+#endif
\ No newline at end of file
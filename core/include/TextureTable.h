@@ -0,0 +1,88 @@
+#ifndef TEXTURETABLE_H
+#define TEXTURETABLE_H
+
+/**
+ * @brief A sequence of indices, from 0 to the number of indices minus 1.
+ */
+template <int... I>
+struct IndexSequence
+{
+};
+
+/**
+ * @brief Joins two sequences of indices, the second one being shifted after the first one.
+ */
+template <typename First, typename Second>
+struct JoinIndices;
+
+template <int... First, int... Second>
+struct JoinIndices<IndexSequence<First...>, IndexSequence<Second...>>
+{
+    typedef IndexSequence<First..., (int(sizeof...(First)) + Second)...> Type;
+};
+
+/**
+ * @brief Makes the sequence of the indices from 0 to N - 1, by halves so that the depth of the instantiations stays
+ * logarithmic.
+ */
+template <int N>
+struct MakeIndexSequence
+{
+    typedef typename JoinIndices<typename MakeIndexSequence<N / 2>::Type,
+                                 typename MakeIndexSequence<N - N / 2>::Type>::Type Type;
+};
+
+template <>
+struct MakeIndexSequence<0>
+{
+    typedef IndexSequence<> Type;
+};
+
+template <>
+struct MakeIndexSequence<1>
+{
+    typedef IndexSequence<0> Type;
+};
+
+/**
+ * @brief Gets a texel of a table: the pixel of the texture at the index in the orientation given, in the side shade
+ * (half brightness) for the indices after the texture.
+ *
+ * @param pixels The pixels of the texture, row by row.
+ * @param width The width of the texture.
+ * @param height The height of the texture.
+ * @param isVertical Whether the table is stored vertically.
+ * @param index The index in the table.
+ * @return The texel.
+ */
+constexpr unsigned int getTableTexel(const unsigned int *pixels, int width, int height, bool isVertical, int index)
+{
+    return index >= width * height
+               ? (getTableTexel(pixels, width, height, isVertical, index - width * height) >> 1) & 8355711
+           : isVertical ? pixels[index % height * width + index / height]
+                        : pixels[index];
+}
+
+template <const unsigned int *Pixels, int Width, int Height, bool IsVertical,
+          typename Indices = typename MakeIndexSequence<2 * Width * Height>::Type>
+struct TextureTable;
+
+/**
+ * @brief A texture of textures.h laid out at compile time as Texture stores it: its pixels in the orientation given,
+ * followed by their side shade. The table is in read-only memory, and Texture::fromTable reads it in place.
+ *
+ * @tparam Pixels The pixels of the texture, row by row, a constexpr array.
+ * @tparam Width The width of the texture.
+ * @tparam Height The height of the texture.
+ * @tparam IsVertical Whether the table is stored vertically.
+ */
+template <const unsigned int *Pixels, int Width, int Height, bool IsVertical, int... I>
+struct TextureTable<Pixels, Width, Height, IsVertical, IndexSequence<I...>>
+{
+    static constexpr unsigned int pixels[sizeof...(I)] = {getTableTexel(Pixels, Width, Height, IsVertical, I)...};
+};
+
+template <const unsigned int *Pixels, int Width, int Height, bool IsVertical, int... I>
+constexpr unsigned int TextureTable<Pixels, Width, Height, IsVertical, IndexSequence<I...>>::pixels[sizeof...(I)];
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <chrono>
+#include <string>
+
+/**
+ * @brief A pool of threads, created once, that run the parallel loops of the renderer.
+ *
+ * Unlike an OpenMP parallel region per loop, the threads are never created or destroyed between frames, the calling
+ * thread takes part in each loop, and the iterations are handed out in chunks from a shared counter, so a thread that
+ * wakes up late or gets slow chunks does not hold the others back.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @brief Constructs a ThreadPool object and starts its threads.
+     *
+     * @param nbThreads The number of threads running the loops, including the calling thread, at least 1.
+     * @param pinThreads Whether to pin each thread of the pool to its own core.
+     */
+    ThreadPool(int nbThreads, bool pinThreads);
+
+    /**
+     * @brief Destructor for the ThreadPool object, which stops its threads.
+     */
+    ~ThreadPool();
+
+    /**
+     * @brief Runs a loop on every thread of the pool and waits for its end.
+     *
+     * @param count The number of iterations.
+     * @param chunkSize The number of consecutive iterations handed to a thread at once.
+     * @param body The function running the iterations from its first argument (included) to its second one (excluded).
+     */
+    void parallelFor(int count, int chunkSize, const std::function<void(int, int)> &body);
+
+    /**
+     * @brief Gets the number of threads running the loops, including the calling thread.
+     *
+     * @return The number of threads.
+     */
+    int getThreadCount() const;
+
+    /**
+     * @brief Gets the fraction of time each thread spent running iterations since the last call.
+     *
+     * @return The utilization of each thread, the calling thread first.
+     */
+    std::vector<double> getUtilization();
+
+    /**
+     * @brief Chooses the number of threads of the renderer: one per core, shared with the other instances of the game
+     * running on the same machine.
+     *
+     * @param peerIps The IP addresses of the other players, those of the loopback interface being on the same machine.
+     * @return The number of threads, at least 1.
+     */
+    static int defaultThreadCount(const std::vector<std::string> &peerIps);
+
+private:
+    /**
+     * @brief Internal method that runs in the threads of the pool.
+     *
+     * @param index The index of the thread, 0 being the calling thread.
+     */
+    void workerThreadFunction(int index);
+
+    /**
+     * @brief Runs chunks of the current loop until there are none left.
+     *
+     * @param index The index of the thread.
+     */
+    void runChunks(int index);
+
+    std::vector<std::thread> workers; // The threads of the pool, apart from the calling thread.
+
+    std::mutex mutex;                    // Protects the fields below, up to the next comment.
+    std::condition_variable loopStarted; // Notified when a loop starts or the pool stops.
+    std::condition_variable loopEnded;   // Notified when the last thread leaves the current loop.
+    long generation;                     // The number of loops started, so that each thread runs each loop once.
+    int activeWorkers;                   // The number of threads of the pool still running the current loop.
+    bool stopping;                       // Whether the pool is stopping.
+
+    // The current loop, written before the loop starts.
+    const std::function<void(int, int)> *body; // The body of the loop.
+    int count;                                 // The number of iterations.
+    int chunkSize;                             // The number of iterations of a chunk.
+    std::atomic<int> nextIteration;            // The first iteration of the next chunk to hand out.
+
+    std::vector<std::atomic<long long>> busyTime;          // The time (ns) each thread spent running iterations.
+    std::chrono::steady_clock::time_point utilizationStart; // The start of the utilization measurement.
+};
+
+#endif
@@ -4,12 +4,13 @@
 #include <netinet/in.h>
 #include <string>
 #include <thread>
-#include <mutex>
 #include <atomic>
 #include <map>
+#include <memory>
 
 #include <Vector.h>
 #include <Map.h>
+#include <RemotePositions.h>
 
 /**
  * @brief The UDPData struct represents the data received from a UDP packet.
@@ -40,23 +41,39 @@ public:
     ~UDPReceiver();
 
     /**
-     * @brief Starts the receiver thread
-     * @param map Reference to the game map
-     * @param nbPlayers Number of players in the game
+     * @brief Starts the receiver thread, which receives the positions in the background instead of receive.
+     * @param nbPlayers Number of other players in the game
      */
-    void startThread(Map& map, int nbPlayers);
+    void startThread(int nbPlayers);
 
     /**
      * @brief Stops the receiver thread
      */
     void stopThread();
 
+    /**
+     * @brief Moves the players of the map to the latest positions published by the receiver thread.
+     * Must be called once per frame by the rendering thread, before the sprites are cast.
+     *
+     * @param map Reference to the game map
+     */
+    void updatePlayers(Map &map);
+
     /**
      * @brief Receives a UDP packet and returns the received position.
      * @return A UDPData object containing the received position. If no data is received, the valid flag is set to false and the sender's information is empty.
      */
     UDPData receive();
 
+    /**
+     * @brief Receives a UDP packet made of any number of values.
+     * @param values The buffer in which the received values are stored.
+     * @param maxValues The maximum number of values that fit in the buffer.
+     * @param senderIp Set to the IP address of the sender.
+     * @return The number of values received, or -1 if no data is received.
+     */
+    int receive(double *values, int maxValues, std::string &senderIp);
+
 private:
     /**
      * @brief The receiver thread.
@@ -68,13 +85,12 @@ private:
     int bufferSize = 2 * sizeof(double); // The size of the buffer.
     sockaddr_in addr;                    // The address structure for the socket.
 
-    std::thread thread;                  // The receiver thread
-    std::mutex playerMutex;             // Mutex for protecting player data
-    std::atomic<bool> stillRunning;     // Flag to control thread execution
-    std::map<std::string, int> playerIdx; // Maps IP addresses and ports to player indexes
-    int nextPlayerIdx;                  // Next available player index
-    Map* gameMap;                       // Pointer to the game map
-    int numPlayers;                     // Number of players in the game
+    std::thread thread;                   // The receiver thread
+    std::atomic<bool> stillRunning;       // Flag to control thread execution
+    std::map<std::string, int> playerIdx; // Maps IP addresses and ports to player indexes (only used by the receiver thread)
+    int nextPlayerIdx;                    // Next available player index
+    int numPlayers;                       // Number of players in the game
+    std::unique_ptr<RemotePositions> positions; // Positions published by the receiver thread to the rendering thread
 };
 
 #endif
\ No newline at end of file
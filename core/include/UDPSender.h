@@ -31,6 +31,14 @@ public:
      */
     void send(double x, double y);
 
+    /**
+     * @brief Sends the given values as a UDP packet.
+     *
+     * @param values The values to send.
+     * @param nbValues The number of values to send.
+     */
+    void send(const double *values, int nbValues);
+
 private:
     int sockfd;                          // The socket file descriptor.
     double buffer[2];                    // The buffer to store the coordinates.
@@ -0,0 +1,96 @@
+#ifndef WALLSEGMENTS_H
+#define WALLSEGMENTS_H
+
+#include <vector>
+
+#include <Map.h>
+#include <Ray.h>
+
+/**
+ * @brief The faces of the walls of a map, merged into segments and projected on the screen to find the wall seen by
+ * each column, as the sector renderers did.
+ *
+ * The cost of a frame grows with the number of faces in view instead of the number of columns times the cells crossed
+ * by their rays, which pays off on large open maps. The distances are computed from the lines of the faces instead of
+ * being accumulated cell by cell, so they may differ from those of the DDA in their last bits.
+ */
+class WallSegments
+{
+public:
+    /**
+     * @brief Constructs a WallSegments object, extracting the faces between a wall and an empty cell and merging the
+     * adjacent faces of a same grid line looking the same way.
+     *
+     * @param map The map, which must be closed by walls.
+     */
+    WallSegments(const Map &map);
+
+    /**
+     * @brief Projects the segments facing the player on the screen, and sorts those in the field of view from the
+     * closest to the farthest. Must be called once per frame before traceColumns.
+     *
+     * @param fan The rays of the frame.
+     */
+    void project(const RayFan &fan);
+
+    /**
+     * @brief Finds the closest face seen by each column of a range, going through the projected segments from the
+     * closest until the columns are all covered by faces closer than the next segment.
+     *
+     * @param fan The rays of the frame, given to project.
+     * @param xBegin The first column.
+     * @param xEnd The column after the last one.
+     * @param hits Set to where the ray of each column hits a wall, from xBegin.
+     * @return The number of columns whose ray missed every face (through the corner of two segments), left unset.
+     */
+    int traceColumns(const RayFan &fan, int xBegin, int xEnd, RayHit *hits) const;
+
+    /**
+     * @brief Gets the number of segments of the map.
+     *
+     * @return The number of segments.
+     */
+    int getSegmentCount() const;
+
+    /**
+     * @brief Gets the number of segments in the field of view in the last projection.
+     *
+     * @return The number of segments.
+     */
+    int getVisibleCount() const;
+
+private:
+    /**
+     * @brief Faces of the walls along a grid line, looking the same way.
+     */
+    struct Segment
+    {
+        int side;       // 0 for a vertical line x = line (the x-sides of the DDA), 1 for a horizontal line y = line.
+        int line;       // The coordinate of the grid line.
+        int begin, end; // The range of the other coordinate covered by the faces.
+        int wallOffset; // The offset from the line to the cells of the walls: 0 if they are after it, -1 before it.
+    };
+
+    /**
+     * @brief A segment in the field of view.
+     */
+    struct Projection
+    {
+        int segment;      // The index of the segment.
+        double minDepth;  // The depth of the closest point of the segment in front of the camera.
+        int xBegin, xEnd; // The columns the segment may cover, the first one and the one after the last.
+    };
+
+    std::vector<Segment> segments;       // The segments of the map.
+    std::vector<Projection> projections; // The segments in the field of view, from the closest to the farthest.
+
+    /**
+     * @brief Adds the faces of the walls along the grid lines of an axis, merging the runs of faces.
+     *
+     * @param map The map.
+     * @param side 0 for the vertical lines, 1 for the horizontal ones.
+     */
+    void addFaces(const Map &map, int side);
+};
+
+#endif
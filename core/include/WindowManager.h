@@ -12,6 +12,7 @@
 #include <Average.h>
 #include <Texture.h>
 #include <DoubleBuffer.h>
+#include <FramePipeline.h>
 
 /**
  * @brief Manages the window operations.
@@ -25,9 +26,10 @@ class WindowManager
 public:
     /**
      * @brief Constructs a WindowManager object.
-     * @param doubleBuffer The double buffer used to draw to the window.
+     * @param width The width of the window.
+     * @param height The height of the window.
      */
-    WindowManager(DoubleBuffer &doubleBuffer);
+    WindowManager(int width, int height);
 
     /**
      * @brief Destructor for the WindowManager object.
@@ -41,19 +43,41 @@ public:
     unsigned int getKeysPressed();
 
     /**
-     * @brief Updates the window display with the back buffer from the double buffer.
+     * @brief Updates the window display with the back buffer of a double buffer, upscaled to the size of the window.
+     * Only the columns changed by the frame are copied and uploaded, see DoubleBuffer::getChangedColumns.
+     * @param doubleBuffer The double buffer, of the size of the window.
      */
-    void updateDisplay();
+    void updateDisplay(const DoubleBuffer &doubleBuffer);
 
     /**
-     * @brief Updates the internal key state with the user input.
+     * @brief Updates the window display with a frame.
+     * @param pixels The pixels of the frame, of the size of the window.
+     */
+    void updateDisplay(const std::vector<int> &pixels);
+
+    /**
+     * @brief Updates the internal key state with the user input, and repaints the parts of the window exposed again
+     * from the last frame presented.
      */
     void updateInput();
 
     /**
-     * @brief Starts the window handling thread.
+     * @brief Waits until an X event arrives, such as a key press, or until a timeout. Used by a main thread which has
+     * nothing to render, instead of spinning.
+     * @param timeout The maximum time to wait, in seconds.
+     */
+    void waitForInput(double timeout);
+
+    /**
+     * @brief Starts the window handling thread, which presents the frames rendered by the pipeline.
+     *
+     * The thread sleeps until a frame is ready or an X event arrives, and presents each frame exactly once.
+     *
+     * @param pipeline The pipeline from which the frames are acquired.
+     * @param presentRate The maximum number of frames presented per second, on a fixed grid of instants like a vertical
+     * synchronization. If zero, the frames are presented as soon as they are ready.
      */
-    void startWindowThread();
+    void startWindowThread(FramePipeline &pipeline, double presentRate);
 
     /**
      * @brief Stops the window handling thread.
@@ -72,7 +96,8 @@ private:
      */
     void windowThreadFunction();
 
-    DoubleBuffer &doubleBuffer; // The double buffer used to draw to the window.
+    FramePipeline *pipeline; // The pipeline from which the frames are acquired, while the thread runs.
+    double presentRate;      // The maximum number of frames presented per second, 0 if not paced.
 
     int *imgBuffer; // The buffer for the window image.
     int width;      // The width of the window.
@@ -84,7 +109,7 @@ private:
     Window window;    // The window.
     GC gc;            // The graphics context of the window.
 
-    unsigned int keysPressed; // The current state of the keys (which keys are pressed or not pressed).
+    std::atomic<unsigned int> keysPressed; // The current state of the keys, written by the window thread and read by the simulation.
 
     /**
      * @brief The thread that runs the window handling.
@@ -1,7 +1,7 @@
 namespace textures
 {
 	// 'barrel', 64x64px
-	const unsigned int barrel[] = {
+	constexpr unsigned int barrel[] = {
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
@@ -67,7 +67,7 @@ namespace textures
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x006c6c6c, 0x00626262, 0x006c6c6c, 0x006c6c6c, 0x00626262, 0x00626262, 0x00626262, 0x00575757, 0x00575757, 0x00575757, 0x00575757, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x00313131, 0x00313131, 0x00313131, 0x00262626, 0x00262626, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x00494949, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x003f3f3f, 0x00313131, 0x00313131, 0x00313131, 0x00313131, 0x00262626, 0x00262626, 0x00262626, 0x00262626, 0x00262627, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000};
 	// 'bluestone', 64x64px
-	const unsigned int bluestone[] = {
+	constexpr unsigned int bluestone[] = {
 		0x00383838, 0x00000070, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000070, 0x00383838, 0x00383838, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00383838, 0x00383838, 0x00000070, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00000070, 0x002c2c2c,
 		0x00202020, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x000000a4, 0x00202020, 0x00202020, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bd, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000000bc, 0x000100bc, 0x000000bc, 0x00202020, 0x00202020, 0x000000b0, 0x000000b0, 0x000100b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x000000b0, 0x00202020,
 		0x00000000, 0x000000a4, 0x000000a4, 0x000000a4, 0x00000089, 0x000000a4, 0x0000007c, 0x000000a4, 0x000000a4, 0x00000099, 0x0000007c, 0x00000098, 0x00000098, 0x0000007c, 0x00000098, 0x00010098, 0x0000007c, 0x000000a4, 0x0000007c, 0x00000070, 0x00000070, 0x00000058, 0x00000000, 0x00202020, 0x000000bc, 0x000000a4, 0x000000bc, 0x000000b0, 0x0000007c, 0x000000a4, 0x000000bc, 0x00000098, 0x00000070, 0x00000070, 0x00000098, 0x00000088, 0x000000a4, 0x000000a4, 0x00000088, 0x00000070, 0x00000088, 0x000000a4, 0x000000bc, 0x000000a4, 0x00000088, 0x00000098, 0x000000a4, 0x000000bc, 0x000000bc, 0x000000a4, 0x00000098, 0x00000070, 0x00000000, 0x00202120, 0x000000b0, 0x000000bc, 0x000000a4, 0x00000098, 0x000000a4, 0x000000b0, 0x000000b0, 0x00000098, 0x0000007c, 0x00000000,
@@ -133,7 +133,7 @@ namespace textures
 		0x00383838, 0x00000088, 0x00000088, 0x00000089, 0x0000007c, 0x0000007c, 0x0000007c, 0x0001007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00383838, 0x00383838, 0x00000088, 0x00000088, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00383838, 0x00383838, 0x000000a4, 0x000000c8, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x00000088, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007d, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00383838, 0x00383838, 0x000000bc, 0x00000088, 0x00000088, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x0000007c, 0x00202020,
 		0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545455, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00383838};
 	// 'colorstone', 64x64px
-	const unsigned int colorstone[] = {
+	constexpr unsigned int colorstone[] = {
 		0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00483818, 0x00543c1c, 0x005c4020, 0x005c4020, 0x00744c28, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4120, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00403018, 0x00483818, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00707070, 0x00707070, 0x00707170, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00484848, 0x00646464, 0x00707070, 0x00545454, 0x00646464, 0x00555454, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x004c4c4c, 0x00555454, 0x005c5c5c, 0x005c5c5c, 0x00646464, 0x00707070, 0x007c7c7c,
 		0x007c7c7c, 0x00707070, 0x00707070, 0x00545454, 0x00483818, 0x00543c1c, 0x005c4020, 0x00744c28, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4120, 0x005c4020, 0x00543c1c, 0x00403018, 0x00483818, 0x005c4020, 0x005c4020, 0x005d4020, 0x00543c1c, 0x00483818, 0x00483818, 0x00545454, 0x00646464, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x007c7c7c, 0x00707070, 0x007c7c7c, 0x007c7c7c, 0x00494848, 0x002c2c2d, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00484848, 0x00646464, 0x00707070, 0x00545454, 0x00656464, 0x00545454, 0x004c4c4c, 0x004c4c4c, 0x00545454, 0x00545454, 0x005c5c5c, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00707070,
 		0x00707070, 0x00707070, 0x00707070, 0x00646464, 0x00545454, 0x00483818, 0x00543c1c, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4021, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x005c4020, 0x005c4020, 0x005c4020, 0x005d4020, 0x00543c1d, 0x00403018, 0x00483818, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00484848, 0x00545454, 0x00646464, 0x00646464, 0x00484848, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00484848, 0x00646464, 0x00646464, 0x00484848, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00484848, 0x00646464, 0x00707070, 0x00545454, 0x00646464, 0x00545454, 0x004c4c4c, 0x00545454, 0x005c5c5c, 0x00656464, 0x00646464, 0x00646465, 0x00646464, 0x00646465, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464,
@@ -199,7 +199,7 @@ namespace textures
 		0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00483818, 0x00403018, 0x00545454, 0x007c7c7c, 0x00545454, 0x00404040, 0x00404040, 0x00404041, 0x00545454, 0x007c7c7c, 0x00545454, 0x00483818, 0x00483818, 0x00543c1c, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483819, 0x00483818, 0x00403018, 0x00484848, 0x00646464, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00292828, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x00202020, 0x001c1c1c, 0x00202020, 0x002c2c2c, 0x00202020, 0x00202020, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00545454, 0x007c7c7c, 0x004c4c4c, 0x004c4c4c, 0x00646464, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020,
 		0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00543c1c, 0x00403018, 0x00403018, 0x00545454, 0x007c7c7c, 0x007c7c7c, 0x00404040, 0x00404040, 0x00404140, 0x00404040, 0x00404040, 0x00545454, 0x00646464, 0x00483818, 0x00483818, 0x00553c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483918, 0x00403018, 0x00484848, 0x00545454, 0x00646464, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x00282828, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002d2c2c, 0x002c2c2c, 0x00282828, 0x00202020, 0x001c1c1c, 0x00202020, 0x002c2c2c, 0x00282828, 0x00202020, 0x00202020, 0x00282828, 0x002c2d2c, 0x00202020, 0x00545454, 0x007c7c7c, 0x007c7c7c, 0x00646464, 0x00646564, 0x006c4824, 0x005c4020, 0x005c4120, 0x005c4020, 0x005c4020};
 	// 'eagle', 64x64px
-	const unsigned int eagle[] = {
+	constexpr unsigned int eagle[] = {
 		0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383839, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383839, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383839, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838,
 		0x00545454, 0x00383938, 0x00545454, 0x00484849, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00555454, 0x00484848, 0x00484848, 0x00484849, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545455, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484948, 0x00383838,
 		0x00383838, 0x00ec0000, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40001, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00a40000, 0x00484848, 0x00484848, 0x00555454, 0x00ec0000, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d50000, 0x00a40000, 0x00484848, 0x00383838, 0x00545454, 0x00ec0000, 0x00ec0000, 0x00ec0000, 0x00ec0000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00c80000, 0x00c80000, 0x00c80001, 0x00c80000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00a40000, 0x00484848,
@@ -265,7 +265,7 @@ namespace textures
 		0x00383838, 0x00545454, 0x00383838, 0x00545554, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00545454, 0x007c7c7c, 0x00b4b4b4, 0x00b4b4b4, 0x007c7c7c, 0x00545454, 0x002c2d2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00404040, 0x00383838, 0x00404040, 0x00484848, 0x00484848, 0x00484848,
 		0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x002c2c2c, 0x002d2c2c, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x002c2c2c, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454};
 	// 'greenlight', 64x64px
-	const unsigned int greenlight[] = {
+	constexpr unsigned int greenlight[] = {
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00646464, 0x00000000, 0x00646464, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007c7c7c, 0x008c8c8c, 0x007c7c7c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00044c00, 0x00046400, 0x00044c00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
@@ -331,7 +331,7 @@ namespace textures
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000};
 	// 'greystone', 64x64px
-	const unsigned int greystone[] = {
+	constexpr unsigned int greystone[] = {
 		0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3a, 0x001f1e1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003a3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001e1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x001f1e1f, 0x003b3b3b,
 		0x00575757, 0x00535353, 0x00575757, 0x004f4f4f, 0x00575757, 0x004f4f4f, 0x00575757, 0x004f4f4f, 0x00575757, 0x004f4f4f, 0x004b4b4b, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00d3d3d3, 0x00dfdfdf, 0x00dfdfdf, 0x00dfdfdf, 0x001f1f1f, 0x003b3b3b, 0x00838383, 0x00ababab, 0x00b7b7b7, 0x00d3d3d3, 0x00c7c7c7, 0x00d3d3d3, 0x00d3d3d3, 0x00c7c7c7, 0x00d3d3d3, 0x00b7b7b7, 0x00c7c6c7, 0x00ababab, 0x00838383, 0x00575757, 0x001f1f1f, 0x00474747, 0x00474746, 0x00474747, 0x00474747, 0x00474747, 0x00474747, 0x00474747, 0x00474747, 0x00474747, 0x00474747, 0x00535353, 0x004f4f4f, 0x00575757, 0x004f4f4e, 0x00575757, 0x004f4f4f, 0x00575757, 0x004f4f4e, 0x00575757, 0x004f4f4f,
 		0x00535353, 0x00575757, 0x00535353, 0x00535353, 0x00575757, 0x00535353, 0x00525353, 0x00535353, 0x00575757, 0x00535353, 0x00474747, 0x00dfdfdf, 0x00d3d3d3, 0x00c7c7c7, 0x00d3d3d3, 0x00b7b7b7, 0x00d3d3d3, 0x00d3d3d3, 0x00d3d3d3, 0x00c7c7c7, 0x00d3d3d3, 0x00d3d3d3, 0x00b7b7b7, 0x00d3d3d3, 0x00d3d3d3, 0x00c7c7c7, 0x008f8f8f, 0x001f1f1f, 0x003b3b3b, 0x00838383, 0x00c7c7c7, 0x00b7b7b7, 0x008f8f8f, 0x00ababab, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x00ababab, 0x004f4f4f, 0x003b3b3b, 0x001f1f1f, 0x003b3b3b, 0x006b6b6b, 0x008f8f8f, 0x008f8f8f, 0x00838383, 0x008f8f8f, 0x008f8f8f, 0x008f8f8f, 0x007a7b7b, 0x006b6b6b, 0x00676766, 0x00474747, 0x00474747, 0x00474747, 0x004b4b4b, 0x00474747, 0x00474747, 0x00474747, 0x004b4b4b, 0x00474747,
@@ -397,7 +397,7 @@ namespace textures
 		0x00535353, 0x00575757, 0x004f4f4f, 0x00535353, 0x00474747, 0x00474747, 0x00474747, 0x004b4b4b, 0x004b4b4b, 0x00474747, 0x004b4b4b, 0x004b4b4b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3a, 0x003b3a3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3a, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x004f4f4f, 0x00575757, 0x004f4f4f, 0x00535353, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x004f4f4f, 0x00535353, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001e1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x001f1f1f, 0x00575657,
 		0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003a3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3a3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003a3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003a3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b, 0x003b3b3b};
 	// 'mossy', 64x64px
-	const unsigned int mossy[] = {
+	constexpr unsigned int mossy[] = {
 		0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2d2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2d, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002d2c2c, 0x002c2c2c, 0x002d2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002d2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002d2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2d, 0x002c2c2c, 0x002c2c2c, 0x002c2d2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2c, 0x002c2c2d, 0x002c2c2c, 0x002c2c2c,
 		0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00dcdcdc, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00ccc400, 0x00dcdcdc, 0x00dcdcdc, 0x00dcdcdd, 0x00dcdcdc, 0x00dcdcdc, 0x00dddcdc, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00dddcdc, 0x00202020, 0x00383838, 0x008c8c8c, 0x00a8a8a8, 0x00dcdcdc, 0x00dcdcdc, 0x00dcdcdc, 0x00dcdcdc, 0x00dcdcdc, 0x00ccc401, 0x00ccc400, 0x00ccc400, 0x00707070, 0x008c8c8c, 0x008c8d8c, 0x00545454, 0x00202020, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00494848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454,
 		0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545455, 0x00545455, 0x00545454, 0x00494848, 0x00dcdcdc, 0x00d0d0d0, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00b4ac00, 0x00989898, 0x00a8a8a8, 0x00ccc400, 0x00ccc400, 0x00d0d1d0, 0x00c0c0c0, 0x00c0c0c0, 0x00ccc400, 0x00ccc400, 0x008c8c8c, 0x00202020, 0x00383838, 0x008c8c8c, 0x00c0c0c0, 0x00b4b4b4, 0x008c8c8c, 0x00ccc400, 0x007c7c7c, 0x00ccc400, 0x009c9d00, 0x009c9c00, 0x009c9d00, 0x00706c00, 0x00555454, 0x00545454, 0x00383838, 0x00202020, 0x00383838, 0x00707070, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x009c9c00, 0x007c7c7c, 0x007c7c7c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00484848, 0x00484849, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848,
@@ -463,7 +463,7 @@ namespace textures
 		0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383839, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383938, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00202020, 0x00545454,
 		0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383938, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00393838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00393838, 0x00383838, 0x00383838, 0x00383838};
 	// 'pillar', 64x64px
-	const unsigned int pillar[] = {
+	constexpr unsigned int pillar[] = {
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00707070, 0x00707070, 0x00707070, 0x00717070, 0x00646464, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00a9a8a8, 0x00a8a8a8, 0x00dcdcdc, 0x00dddcdc, 0x00d0d0d0, 0x00d0d0d0, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x00707071, 0x00707170, 0x00646464, 0x00545454, 0x00484848, 0x00545454, 0x00545454, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00c0c0c0, 0x00fcfcfc, 0x00fcfcfc, 0x00ececec, 0x00ececec, 0x00ececec, 0x00dcdcdc, 0x00dcdcdc, 0x00dcdcdc, 0x00d0d0d0, 0x00d0d0d0, 0x00d0d1d0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x00989898, 0x00707070, 0x00c0c0c0, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00383838, 0x00383838, 0x002c2d2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
@@ -529,7 +529,7 @@ namespace textures
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00a8a8a8, 0x00a8a8a8, 0x00dcdcdc, 0x00dcdcdc, 0x00d0d0d0, 0x00d0d0d0, 0x00d0d0d0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00b4b4b4, 0x00b4b4b4, 0x00a8a8a8, 0x00a8a8a8, 0x00989898, 0x00989898, 0x008c8c8c, 0x008c8c8c, 0x007c7c7c, 0x00707070, 0x00707070, 0x00646464, 0x00545454, 0x00484848, 0x00404040, 0x00404040, 0x00484848, 0x00545454, 0x005c5c5c, 0x005c5c5c, 0x005c5c5c, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00646464, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
 		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x00a8a8a8, 0x008c8d8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x008c8c8c, 0x00707070, 0x00707070, 0x00707070, 0x00707070, 0x00646464, 0x00545454, 0x00404040, 0x00404040, 0x00484848, 0x00545454, 0x005c5c5c, 0x00646464, 0x00646464, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000};
 	// 'purplestone', 64x64px
-	const unsigned int purplestone[] = {
+	constexpr unsigned int purplestone[] = {
 		0x006c0070, 0x006c0070, 0x006c0070, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00580058, 0x006c0070, 0x00840084, 0x00580058, 0x006c0070, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x006c0070, 0x00580059, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00580058, 0x006c0070, 0x00840084, 0x00850084, 0x006c0070, 0x00580058, 0x00580058, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058, 0x00580058,
 		0x005c4020, 0x00840084, 0x00840184, 0x006c0070, 0x00400040, 0x00400040, 0x00400040, 0x00580058, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x00580058, 0x00580058, 0x00400040, 0x00400140, 0x00400040, 0x00400040, 0x00400040, 0x006c0070, 0x00840084, 0x009c009c, 0x006c4824, 0x006c4824, 0x006c4824, 0x005c4020, 0x006c0070, 0x00580058, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00500050, 0x00580058, 0x006c0170, 0x00840084, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00840184, 0x006c0070, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400041, 0x00400040, 0x00400040, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x00840084, 0x00840084, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824,
 		0x006c4824, 0x005c4020, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00400040, 0x00580058, 0x006c0070, 0x006c0070, 0x00580058, 0x006c0070, 0x006c0070, 0x006c0070, 0x00580058, 0x00400040, 0x00400040, 0x00500050, 0x00580058, 0x00840084, 0x009c009c, 0x006c4824, 0x006d4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005c4020, 0x00580058, 0x00580058, 0x00500050, 0x00410040, 0x00400040, 0x00500050, 0x00500050, 0x00580058, 0x00500050, 0x006c0070, 0x00840084, 0x00840084, 0x00840084, 0x006c0070, 0x00840084, 0x006c0070, 0x006c0070, 0x00580058, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400040, 0x00400140, 0x00400040, 0x00580058, 0x00580058, 0x00580058, 0x006c0070, 0x00840184, 0x00840084, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824,
@@ -595,7 +595,7 @@ namespace textures
 		0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x005c4020, 0x006c0070, 0x00840084, 0x00580058, 0x00483818, 0x00403018, 0x00403018, 0x00403018, 0x00483818, 0x005c4020, 0x005c4020, 0x006c4824, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x005c4020, 0x006c4824, 0x00744c28, 0x0080502c, 0x00744c28, 0x006c4824, 0x006c4824, 0x005c4020, 0x005c4020, 0x005c4020, 0x005d4020, 0x005c4020, 0x00543c1c, 0x00543c1c, 0x00483818, 0x00483818, 0x00483818, 0x00483818, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00483818, 0x00483818, 0x00483818, 0x00543c1c, 0x005c4020, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x005c4020, 0x00483918, 0x00403018, 0x00403018, 0x00403018, 0x00403019,
 		0x00646464, 0x00484948, 0x00383838, 0x00403018, 0x00403018, 0x00403019, 0x00403018, 0x00403018, 0x00403118, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00383838, 0x00484848, 0x00646464, 0x00646464, 0x00545454, 0x00383838, 0x00403018, 0x00413018, 0x00403018, 0x00403018, 0x00403118, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403118, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00383838, 0x00484948, 0x00545454, 0x00545454, 0x00484848, 0x00383838, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403118, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403019, 0x00403018, 0x00383838, 0x00484848, 0x00646464};
 	// 'redbrick', 64x64px
-	const unsigned int redbrick[] = {
+	constexpr unsigned int redbrick[] = {
 		0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383938, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838, 0x00383838,
 		0x00545454, 0x00383838, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00383838, 0x00484948, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00383839,
 		0x00383838, 0x00ec0000, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00a40000, 0x00484848, 0x00484848, 0x00545454, 0x00ec0000, 0x00ec0000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00a40100, 0x00484848, 0x00383838, 0x00545454, 0x00ec0000, 0x00ec0000, 0x00ec0000, 0x00ec0000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00e00000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00d40000, 0x00c80000, 0x00c80000, 0x00c90000, 0x00c80000, 0x00bc0000, 0x00bc0000, 0x00bc0000, 0x00a40000, 0x00484848,
@@ -661,7 +661,7 @@ namespace textures
 		0x00383838, 0x00545454, 0x00383838, 0x00545454, 0x00383838, 0x00383838, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00555454, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00545454, 0x00484848, 0x00484848, 0x00383838, 0x00484848, 0x00484848, 0x00484848, 0x00404040, 0x00383838, 0x00383838, 0x00404040, 0x00383838, 0x00383838, 0x00404040, 0x00484848, 0x00404040, 0x00383838, 0x00404040, 0x00545454, 0x00484848, 0x00484848, 0x00383838, 0x00545454, 0x00484848, 0x00484848, 0x00484848, 0x00484848, 0x00404040, 0x00383838, 0x00404040, 0x00484848, 0x00484848, 0x00484848,
 		0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00555454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545554, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454, 0x00545454};
 	// 'wood', 64x64px
-	const unsigned int wood[] = {
+	constexpr unsigned int wood[] = {
 		0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403118, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00413018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00413018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403118, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018, 0x00403018,
 		0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4924, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006d4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006d4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824, 0x006c4824,
 		0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c35, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905d34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c35, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34, 0x00905c34,
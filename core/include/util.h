@@ -20,7 +20,9 @@ unsigned int rgb(int r, int g, int b);
 struct NetworkData
 {
     int listeningPort;                                // The port on which the server listens for incoming connections.
-    std::vector<std::pair<std::string, int>> ipPorts; // The list of IP addresses and ports.
+    std::vector<std::pair<std::string, int>> ipPorts; // The list of IP addresses and ports (only the relay when a relay is used).
+    bool relay;                                       // Whether the positions are exchanged through a relay.
+    int relayPlayers;                                 // The maximum number of other players when a relay is used.
 };
 
 /**
@@ -31,6 +33,10 @@ struct NetworkData
  * 127.0.0.1 12346
  * 127.0.0.1 12347
  *
+ * Instead of the other players, a relay can be given with its IP address, its port and the maximum number of other players:
+ * 12345
+ * relay 127.0.0.1 30000 16
+ *
  * @param path The path to the file containing the IP addresses and ports.
  * @return The network data.
  */
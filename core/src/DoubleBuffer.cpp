@@ -0,0 +1,253 @@
+#include <cstdint>
+#include <algorithm>
+
+#include <DoubleBuffer.h>
+
+DoubleBuffer::DoubleBuffer(int width, int height) : width(width),
+                                                     height(height),
+                                                     fullWidth(width),
+                                                     fullHeight(height),
+                                                     scale(1.0),
+                                                     backWidth(width),
+                                                     backHeight(height),
+                                                     upscaleColumns(width),
+                                                     pixelWrites(0),
+                                                     backPixelWrites(0),
+                                                     frontBuffer(width * height),
+                                                     backBuffer(width * height),
+                                                     backIsLastFrame(false),
+                                                     reopened(false),
+                                                     changedColumns(1, {0, width})
+{
+    for (int x = 0; x < width; x++)
+        upscaleColumns[x] = x;
+}
+
+const std::vector<int> &DoubleBuffer::getBackBuffer() const { return backBuffer; }
+
+void DoubleBuffer::upscaleBackBuffer(int *pixels) const
+{
+    if (backWidth == fullWidth && backHeight == fullHeight)
+    {
+        std::copy(backBuffer.begin(), backBuffer.end(), pixels);
+        return;
+    }
+
+    int previousRow = -1;
+    for (int y = 0; y < fullHeight; y++)
+    {
+        int *row = pixels + y * fullWidth;
+        int sourceRow = y * backHeight / fullHeight;
+        // Consecutive rows showing the same row of the back buffer are copies of each other
+        if (sourceRow == previousRow)
+        {
+            std::copy(row - fullWidth, row, row);
+            continue;
+        }
+        const int *source = backBuffer.data() + sourceRow * backWidth;
+        for (int x = 0; x < fullWidth; x++)
+            row[x] = source[upscaleColumns[x]];
+        previousRow = sourceRow;
+    }
+}
+
+void DoubleBuffer::upscaleBackBuffer(int *pixels, const ColumnRange &columns) const
+{
+    int previousRow = -1;
+    for (int y = 0; y < fullHeight; y++)
+    {
+        int *row = pixels + y * fullWidth;
+        int sourceRow = y * backHeight / fullHeight;
+        if (sourceRow == previousRow)
+        {
+            std::copy(row - fullWidth + columns.begin, row - fullWidth + columns.end, row + columns.begin);
+            continue;
+        }
+        const int *source = backBuffer.data() + sourceRow * backWidth;
+        for (int x = columns.begin; x < columns.end; x++)
+            row[x] = source[upscaleColumns[x]];
+        previousRow = sourceRow;
+    }
+}
+
+const std::vector<ColumnRange> &DoubleBuffer::getChangedColumns() const { return changedColumns; }
+
+int DoubleBuffer::getWidth() const { return width; }
+int DoubleBuffer::getHeight() const { return height; }
+int DoubleBuffer::getFullWidth() const { return fullWidth; }
+int DoubleBuffer::getFullHeight() const { return fullHeight; }
+
+void DoubleBuffer::setScale(double scale)
+{
+    if (scale > 1.0)
+        scale = 1.0;
+    this->scale = scale;
+    width = std::max(1, int(fullWidth * scale + 0.5));
+    height = std::max(1, int(fullHeight * scale + 0.5));
+}
+
+double DoubleBuffer::getScale() const { return scale; }
+
+/**
+ * @brief Gets the color of a texel: the texel itself in the direct format, its color in the palette in the indexed one.
+ */
+static inline unsigned int getColor(unsigned int texel, const unsigned int *) { return texel; }
+static inline unsigned int getColor(unsigned char index, const unsigned int *palette) { return palette[index]; }
+
+/**
+ * @brief Draws a textured column, with the height and the storage of the texture known at compile time: the row of the
+ * texel is masked with a constant, and read from the column of the texture with a constant stride when the texture is
+ * stored vertically. The texels are copied, or expanded through the palette of the shade for an indexed texture.
+ *
+ * @param destination The first pixel of the column in the buffer.
+ * @param pitch The distance between two rows of the buffer.
+ * @param count The number of pixels drawn.
+ * @param column The column of the texture, its first texel, in the shade drawn for a texture in the direct format.
+ * @param palette The palette of the shade drawn for an indexed texture.
+ * @param stride The distance between two texels of the column, the width of a texture stored horizontally.
+ * @param mask The height of the texture minus 1, used when Height is 0.
+ * @param texY The row in the texture of the first pixel, in 32.32 fixed point.
+ * @param step The change of the row from one pixel to the next, in 32.32 fixed point.
+ */
+template <int Height, bool Vertical, typename Texel>
+static void drawTexturedColumn(int *destination, int pitch, int count, const Texel *column, const unsigned int *palette,
+                               int stride, int mask, int64_t texY, int64_t step)
+{
+    if (Height > 0)
+        mask = Height - 1;
+    if (Vertical)
+        stride = 1;
+    for (int i = 0; i < count; i++)
+    {
+        *destination = getColor(column[(int(texY >> 32) & mask) * stride], palette);
+        texY += step;
+        destination += pitch;
+    }
+}
+
+template <int Height, typename Texel>
+static void drawTexturedColumn(bool vertical, int *destination, int pitch, int count, const Texel *column,
+                               const unsigned int *palette, int stride, int mask, int64_t texY, int64_t step)
+{
+    if (vertical)
+        drawTexturedColumn<Height, true>(destination, pitch, count, column, palette, stride, mask, texY, step);
+    else
+        drawTexturedColumn<Height, false>(destination, pitch, count, column, palette, stride, mask, texY, step);
+}
+
+template <typename Texel>
+static void drawTexturedColumn(int textureHeight, bool vertical, int *destination, int pitch, int count,
+                               const Texel *column, const unsigned int *palette, int stride, int64_t texY, int64_t step)
+{
+    switch (textureHeight)
+    {
+    case 64:
+        drawTexturedColumn<64>(vertical, destination, pitch, count, column, palette, stride, 63, texY, step);
+        break;
+    case 128:
+        drawTexturedColumn<128>(vertical, destination, pitch, count, column, palette, stride, 127, texY, step);
+        break;
+    default:
+        drawTexturedColumn<0>(vertical, destination, pitch, count, column, palette, stride, textureHeight - 1, texY,
+                              step);
+        break;
+    }
+}
+
+void DoubleBuffer::drawVertLine(int x, int yStart, int yEnd, int lineHeight, const Texture &texture, int texX, int shade)
+{
+    if (yEnd < yStart)
+        return;
+    int textureWidth = texture.getWidth();
+    int textureHeight = texture.getHeight();
+    texX &= textureWidth - 1;
+    bool vertical = texture.isStoredVertically();
+    int columnOffset = vertical ? texX * textureHeight : texX;
+
+    // The rows of the texture in 32.32 fixed point. The step is rounded up, so that the row of each pixel is exactly
+    // its distance from the top of the line times textureHeight / lineHeight, rounded down, as long as the error of
+    // the step summed over the line stays below 1 / lineHeight. A line too far to have a height shows the first row.
+    int64_t step = lineHeight > 0 ? ((int64_t(textureHeight) << 32) + lineHeight - 1) / lineHeight : 0;
+    int64_t texY = (yStart - height / 2 + lineHeight / 2) * step;
+
+    int *destination = &frontBuffer[x + yStart * width];
+    int count = yEnd - yStart + 1;
+    if (texture.getFormat() == TextureFormat::INDEXED)
+        drawTexturedColumn(textureHeight, vertical, destination, width, count, texture.getIndices() + columnOffset,
+                           texture.getPalette(shade), textureWidth, texY, step);
+    else
+        drawTexturedColumn(textureHeight, vertical, destination, width, count, texture.getPixels(shade) + columnOffset,
+                           nullptr, textureWidth, texY, step);
+}
+
+void DoubleBuffer::drawPixel(int x, int y, unsigned int color)
+{
+    frontBuffer[x + y * width] = color;
+}
+
+void DoubleBuffer::countPixelWrites(long count) { pixelWrites += count; }
+
+void DoubleBuffer::swap()
+{
+    frontBuffer.swap(backBuffer);
+    if (backWidth != width)
+    {
+        // Integer mapping, so that each column of the back buffer is repeated the same number of times (±1)
+        for (int x = 0; x < fullWidth; x++)
+            upscaleColumns[x] = x * width / fullWidth;
+    }
+    backWidth = width;
+    backHeight = height;
+    backPixelWrites = pixelWrites;
+    pixelWrites = 0;
+
+    changedColumns.clear();
+    if (!reopened)
+        changedColumns.push_back({0, fullWidth});
+    else
+        for (const ColumnRange &columns : redrawnColumns)
+        {
+            // The columns of the window showing them, from the first one whose upscaleColumns is at least begin
+            ColumnRange windowColumns = {(columns.begin * fullWidth + width - 1) / width,
+                                         (columns.end * fullWidth + width - 1) / width};
+            if (windowColumns.begin < windowColumns.end)
+                changedColumns.push_back(windowColumns);
+        }
+    reopened = false;
+    backIsLastFrame = true;
+}
+
+void DoubleBuffer::swap(std::vector<int> &buffer)
+{
+    frontBuffer.swap(buffer);
+    backPixelWrites = pixelWrites;
+    pixelWrites = 0;
+    reopened = false;
+    backIsLastFrame = false;
+}
+
+bool DoubleBuffer::canReopenBackBuffer() const
+{
+    return backIsLastFrame && !reopened && backWidth == width && backHeight == height;
+}
+
+void DoubleBuffer::reopenBackBuffer(const std::vector<ColumnRange> &columns)
+{
+    frontBuffer.swap(backBuffer);
+    redrawnColumns = columns;
+    reopened = true;
+}
+
+void DoubleBuffer::saveLayer()
+{
+    layer.assign(frontBuffer.begin(), frontBuffer.begin() + width * height);
+}
+
+void DoubleBuffer::restoreLayer(const ColumnRange &columns)
+{
+    for (int y = 0; y < height; y++)
+        std::copy(layer.begin() + y * width + columns.begin, layer.begin() + y * width + columns.end,
+                  frontBuffer.begin() + y * width + columns.begin);
+}
+
+long DoubleBuffer::getPixelWrites() const { return backPixelWrites; }
\ No newline at end of file
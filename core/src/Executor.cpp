@@ -0,0 +1,82 @@
+#include <Executor.h>
+
+Executor::Executor(ThreadingStrategy threading, int nbThreads, bool pinThreads)
+    : threading(threading),
+      nbThreads(threading == ThreadingStrategy::NONE || nbThreads < 1 ? 1 : nbThreads)
+{
+    if (threading == ThreadingStrategy::POOL)
+        pool.reset(new ThreadPool(this->nbThreads, pinThreads));
+}
+
+void Executor::parallelFor(int count, int chunkSize, const std::function<void(int, int)> &body)
+{
+    if (count <= 0)
+        return;
+    if (chunkSize < 1)
+        chunkSize = 1;
+
+    switch (threading)
+    {
+    case ThreadingStrategy::POOL:
+        pool->parallelFor(count, chunkSize, body);
+        return;
+    case ThreadingStrategy::OPENMP:
+    {
+        int chunks = (count + chunkSize - 1) / chunkSize;
+        // Dynamic scheduling, as the chunks of the pool: the cost of a column or a row varies a lot across the screen
+#pragma omp parallel for schedule(dynamic) num_threads(nbThreads)
+        for (int chunk = 0; chunk < chunks; chunk++)
+        {
+            int begin = chunk * chunkSize;
+            body(begin, begin + chunkSize < count ? begin + chunkSize : count);
+        }
+        return;
+    }
+    case ThreadingStrategy::NONE:
+        break;
+    }
+    body(0, count);
+}
+
+void Executor::parallelFor(int count, int chunkSize, const std::function<void(int, int)> &body,
+                           const std::function<void()> &task)
+{
+    if (!task)
+    {
+        parallelFor(count, chunkSize, body);
+        return;
+    }
+    if (threading == ThreadingStrategy::NONE || count <= 0)
+    {
+        task();
+        parallelFor(count, chunkSize, body);
+        return;
+    }
+    if (chunkSize < 1)
+        chunkSize = 1;
+
+    // Chunk 0 is the task, and chunk i the iterations of chunk i - 1 of the loop
+    int chunks = (count + chunkSize - 1) / chunkSize;
+    parallelFor(chunks + 1, 1, [count, chunkSize, &body, &task](int begin, int end)
+                {
+                    for (int chunk = begin; chunk < end; chunk++)
+                        if (chunk == 0)
+                            task();
+                        else
+                        {
+                            int first = (chunk - 1) * chunkSize;
+                            body(first, first + chunkSize < count ? first + chunkSize : count);
+                        }
+                });
+}
+
+ThreadingStrategy Executor::getThreading() const { return threading; }
+
+int Executor::getThreadCount() const { return nbThreads; }
+
+std::vector<double> Executor::getUtilization()
+{
+    if (!pool)
+        return std::vector<double>();
+    return pool->getUtilization();
+}
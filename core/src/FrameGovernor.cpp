@@ -0,0 +1,52 @@
+#include <FrameGovernor.h>
+
+FrameGovernor::FrameGovernor(double targetFrameTime, double minScale, double maxScale, double scaleStep)
+    : targetFrameTime(targetFrameTime),
+      minScale(minScale),
+      maxScale(maxScale),
+      scaleStep(scaleStep),
+      scale(maxScale),
+      smoothedTime(0),
+      framesOver(0),
+      framesUnder(0),
+      cooldown(0)
+{
+}
+
+double FrameGovernor::update(double frameTime)
+{
+    smoothedTime = smoothedTime == 0 ? frameTime : 0.9 * smoothedTime + 0.1 * frameTime;
+
+    // Let the smoothed time settle at the new resolution before adjusting again
+    if (cooldown > 0)
+    {
+        cooldown--;
+        return scale;
+    }
+
+    // The rendering cost is proportional to the number of pixels, so to the square of the scale
+    double upScale = scale + scaleStep < maxScale ? scale + scaleStep : maxScale;
+    double predictedTime = smoothedTime * (upScale * upScale) / (scale * scale);
+
+    framesOver = smoothedTime > targetFrameTime ? framesOver + 1 : 0;
+    framesUnder = predictedTime < 0.85 * targetFrameTime ? framesUnder + 1 : 0;
+
+    if (framesOver >= FRAMES_BEFORE_DOWNSCALE && scale > minScale)
+        setScale(scale - scaleStep > minScale ? scale - scaleStep : minScale);
+    else if (framesUnder >= FRAMES_BEFORE_UPSCALE && scale < maxScale)
+        setScale(upScale);
+
+    return scale;
+}
+
+double FrameGovernor::getScale() const { return scale; }
+double FrameGovernor::getTargetFrameTime() const { return targetFrameTime; }
+
+void FrameGovernor::setScale(double newScale)
+{
+    smoothedTime *= (newScale * newScale) / (scale * scale);
+    scale = newScale;
+    framesOver = 0;
+    framesUnder = 0;
+    cooldown = COOLDOWN_FRAMES;
+}
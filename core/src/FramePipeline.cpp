@@ -0,0 +1,161 @@
+#include <FramePipeline.h>
+#include <stdexcept>
+#include <cstdint>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+FramePipeline::FramePipeline(const Map &map, const Player &player, int nbPlayers, int width, int height, int maxFramesInFlight)
+    : nbPlayers(nbPlayers),
+      maxFramesInFlight(maxFramesInFlight > 0 ? maxFramesInFlight : 1),
+      renderMap(map),
+      renderPlayer({player.posX(), player.posY()}, {player.dirX(), player.dirY()}, {player.camX(), player.camY()}, 0, 0, renderMap),
+      doubleBuffer(width, height),
+      raycaster(renderPlayer, doubleBuffer, renderMap),
+      states(1),
+      frames(this->maxFramesInFlight),
+      freeFrames(this->maxFramesInFlight),
+      frameReadyFd(eventfd(0, EFD_NONBLOCK)),
+      running(false),
+      simulateTime(1.0),
+      renderTime(1.0),
+      presentTime(1.0),
+      latency(1.0)
+{
+    if (frameReadyFd < 0)
+        throw std::runtime_error("Cannot create the frame-ready eventfd");
+
+    for (int i = 0; i < this->maxFramesInFlight; i++)
+    {
+        Frame frame;
+        frame.pixels.resize(width * height);
+        freeFrames.push(std::move(frame));
+    }
+}
+
+FramePipeline::~FramePipeline()
+{
+    stop();
+    close(frameReadyFd);
+}
+
+void FramePipeline::start()
+{
+    if (!running)
+    {
+        running = true;
+        renderThread = std::thread(&FramePipeline::renderThreadFunction, this);
+    }
+}
+
+void FramePipeline::stop()
+{
+    states.close();
+    frames.close();
+    freeFrames.close();
+    if (running)
+    {
+        running = false;
+        if (renderThread.joinable())
+            renderThread.join();
+    }
+}
+
+bool FramePipeline::submit(const Player &player, const Map &map, std::chrono::steady_clock::time_point start)
+{
+    FrameState state;
+    state.position = Vector<double>(player.posX(), player.posY());
+    state.direction = Vector<double>(player.dirX(), player.dirY());
+    state.camera = Vector<double>(player.camX(), player.camY());
+    const std::vector<Sprite> &sprites = map.getSprites();
+    for (int i = 0; i < nbPlayers; i++)
+        state.players.push_back(Vector<double>(sprites[i].posX(), sprites[i].posY()));
+    state.start = start;
+    return states.push(std::move(state));
+}
+
+bool FramePipeline::acquireFrame(Frame &frame)
+{
+    return frames.popFor(frame, 0);
+}
+
+int FramePipeline::getFrameReadyFd() const { return frameReadyFd; }
+
+void FramePipeline::clearFrameReady()
+{
+    uint64_t count;
+    if (read(frameReadyFd, &count, sizeof(count)) < 0)
+        return; // Nothing to clear
+}
+
+void FramePipeline::wakePresenter()
+{
+    uint64_t one = 1;
+    if (write(frameReadyFd, &one, sizeof(one)) < 0)
+        return; // The counter is already non-zero, so the presenter will wake up anyway
+}
+
+void FramePipeline::releaseFrame(Frame &frame, double presentTime)
+{
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - frame.start;
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        this->presentTime.update(presentTime);
+        latency.update(elapsed.count());
+    }
+    freeFrames.push(std::move(frame));
+}
+
+void FramePipeline::recordSimulate(double simulateTime)
+{
+    std::lock_guard<std::mutex> lock(statsMutex);
+    this->simulateTime.update(simulateTime);
+}
+
+PipelineStats FramePipeline::getStats()
+{
+    std::lock_guard<std::mutex> lock(statsMutex);
+    PipelineStats stats;
+    stats.simulate = simulateTime.get();
+    stats.render = renderTime.get();
+    stats.present = presentTime.get();
+    stats.latency = latency.get();
+    return stats;
+}
+
+int FramePipeline::getMaxFramesInFlight() const { return maxFramesInFlight; }
+
+Raycaster &FramePipeline::getRaycaster() { return raycaster; }
+
+void FramePipeline::renderThreadFunction()
+{
+    FrameState state;
+    Frame frame;
+    while (states.pop(state))
+    {
+        std::chrono::steady_clock::time_point renderStart = std::chrono::steady_clock::now();
+
+        renderPlayer.setPose(state.position, state.direction, state.camera);
+        for (size_t i = 0; i < state.players.size(); i++)
+            renderMap.movePlayer(i, state.players[i].x(), state.players[i].y());
+
+        // A frame without changes is not presented again
+        if (!raycaster.renderChanges())
+            continue;
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - renderStart;
+        {
+            std::lock_guard<std::mutex> lock(statsMutex);
+            renderTime.update(elapsed.count());
+        }
+
+        // Waits while every frame buffer is waiting for presentation or being presented
+        if (!freeFrames.pop(frame))
+            break;
+        doubleBuffer.swap(frame.pixels);
+        frame.start = state.start;
+        if (!frames.push(std::move(frame)))
+            break;
+        // Signaled after the push, so that a presenter that cleared the notification before finds the frame
+        wakePresenter();
+    }
+}
@@ -1,6 +1,9 @@
+#include <random>
+
 #include <Map.h>
 #include <util.h>
 #include <textures.h>
+#include <TextureTable.h>
 
 Map::Map(
     int width, int height,
@@ -13,14 +16,19 @@ Map::Map(
       map(width * height),
       sprites(sprites),
       floorTexture(floorTexture),
-      ceilingTexture(ceilingTexture)
+      ceilingTexture(ceilingTexture),
+      spriteVersion(0),
+      textureVersion(0)
 {
     this->textures.reserve(textures.size());
     for (const Texture &texture : textures)
         this->textures.push_back(texture);
 }
 
+int Map::getWidth() const { return width; }
+int Map::getHeight() const { return height; }
 int Map::get(int x, int y) const { return map[x + y * width]; }
+const std::vector<int> &Map::getTiles() const { return map; }
 const Texture &Map::getFloorTexture() const { return floorTexture; }
 const Texture &Map::getCeilingTexture() const { return ceilingTexture; }
 const std::vector<Sprite> &Map::getSprites() const { return sprites; }
@@ -37,6 +45,45 @@ const Texture &Map::getTexture(int x, int y) const
     return textures[map[x + y * width] - 1];
 }
 
+void Map::setFogLevels(int levels)
+{
+    for (Texture &texture : textures)
+        texture.generateFogLevels(levels);
+    floorTexture.generateFogLevels(levels);
+    ceilingTexture.generateFogLevels(levels);
+    textureVersion++;
+}
+
+int Map::getFogLevels() const { return floorTexture.getFogLevels(); }
+
+void Map::setTextureFormat(TextureFormat format)
+{
+    for (Texture &texture : textures)
+        texture.setFormat(format);
+    floorTexture.setFormat(format);
+    ceilingTexture.setFormat(format);
+    for (Sprite &sprite : sprites)
+        sprite.setTextureFormat(format);
+    textureVersion++;
+}
+
+long Map::getTextureBytes() const
+{
+    long bytes = floorTexture.getBytes() + ceilingTexture.getBytes();
+    for (const Texture &texture : textures)
+        bytes += texture.getBytes();
+    return bytes;
+}
+
+/**
+ * @brief Makes a 64x64 texture of textures.h, read in place from its table.
+ */
+template <const unsigned int *Pixels, bool IsVertical>
+static Texture makeTexture()
+{
+    return Texture::fromTable(64, 64, TextureTable<Pixels, 64, 64, IsVertical>::pixels, IsVertical);
+}
+
 Map Map::generateMap(int nbPlayers)
 {
     int width = 24, height = 24;
@@ -68,9 +115,9 @@ Map Map::generateMap(int nbPlayers)
             {2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 0, 5, 0, 5, 0, 0, 0, 5, 5},
             {2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 5, 5, 5, 5, 5, 5, 5, 5, 5}};
 
-    Texture greenLight(64, 64, textures::greenlight, true);
-    Texture pillar(64, 64, textures::pillar, true);
-    Texture barrel(64, 64, textures::barrel, true);
+    Texture greenLight = makeTexture<textures::greenlight, true>();
+    Texture pillar = makeTexture<textures::pillar, true>();
+    Texture barrel = makeTexture<textures::barrel, true>();
 
     std::vector<Sprite> sprites;
     for (int i = 0; i < nbPlayers; i++)
@@ -104,17 +151,17 @@ Map Map::generateMap(int nbPlayers)
 
     Map map(
         width, height,
-        Texture(64, 64, textures::greystone, false),
-        Texture(64, 64, textures::wood, false),
+        makeTexture<textures::greystone, false>(),
+        makeTexture<textures::wood, false>(),
         {
-            Texture(64, 64, textures::eagle, true),
-            Texture(64, 64, textures::redbrick, true),
-            Texture(64, 64, textures::purplestone, true),
-            Texture(64, 64, textures::greystone, true),
-            Texture(64, 64, textures::bluestone, true),
-            Texture(64, 64, textures::mossy, true),
-            Texture(64, 64, textures::wood, true),
-            Texture(64, 64, textures::colorstone, true),
+            makeTexture<textures::eagle, true>(),
+            makeTexture<textures::redbrick, true>(),
+            makeTexture<textures::purplestone, true>(),
+            makeTexture<textures::greystone, true>(),
+            makeTexture<textures::bluestone, true>(),
+            makeTexture<textures::mossy, true>(),
+            makeTexture<textures::wood, true>(),
+            makeTexture<textures::colorstone, true>(),
         }, sprites);
 
     for (int x = 0; x < width; x++)
@@ -124,7 +171,34 @@ Map Map::generateMap(int nbPlayers)
     return map;
 }
 
+Map Map::generateRandomMap(int size, int density, unsigned int seed)
+{
+    Map game = generateMap(0);
+    std::vector<Sprite> sprites;
+    Map map(size, size, game.floorTexture, game.ceilingTexture, {}, sprites);
+    map.textures = game.textures;
+
+    std::mt19937 random(seed);
+    int nbTextures = int(map.textures.size());
+    for (int y = 0; y < size; y++)
+        for (int x = 0; x < size; x++)
+        {
+            bool border = x == 0 || y == 0 || x == size - 1 || y == size - 1;
+            if (border || (density > 0 && random() % density == 0))
+                map.map[x + y * size] = 1 + random() % nbTextures;
+        }
+    return map;
+}
+
 void Map::movePlayer(int index, double x, double y)
 {
+    // The positions received are the same as long as the other player does not move
+    if (sprites[index].posX() == x && sprites[index].posY() == y)
+        return;
     sprites[index].move(x, y);
-}
\ No newline at end of file
+    spriteVersion++;
+}
+
+unsigned long Map::getSpriteVersion() const { return spriteVersion; }
+
+unsigned long Map::getTextureVersion() const { return textureVersion; }
\ No newline at end of file
@@ -11,6 +11,7 @@ Player::Player(
                 camera(camera),
                 moveSpeed(moveSpeed),
                 rotSpeed(rotSpeed),
+                poseVersion(0),
                 map(map)
 {
 }
@@ -22,6 +23,18 @@ double Player::dirY() const { return direction.y(); }
 double Player::camX() const { return camera.x(); }
 double Player::camY() const { return camera.y(); }
 
+unsigned long Player::getPoseVersion() const { return poseVersion; }
+
+void Player::setPose(const Vector<double> &pos, const Vector<double> &dir, const Vector<double> &cam)
+{
+    if (pos.x() != position.x() || pos.y() != position.y() || dir.x() != direction.x() || dir.y() != direction.y() ||
+        cam.x() != camera.x() || cam.y() != camera.y())
+        poseVersion++;
+    position = pos;
+    direction = dir;
+    camera = cam;
+}
+
 void Player::move(double modifier)
 {
     double x = position.x();
@@ -38,11 +51,13 @@ void Player::move(double modifier)
 void Player::moveX(double modifier)
 {
     position += {direction.x() * moveSpeed * modifier, 0};
+    poseVersion++;
 }
 
 void Player::moveY(double modifier)
 {
     position += {0, direction.y() * moveSpeed * modifier};
+    poseVersion++;
 }
 
 void Player::turn(double modifier)
@@ -50,6 +65,7 @@ void Player::turn(double modifier)
     double rot = rotSpeed * modifier;
     direction.rotate(rot);
     camera.rotate(rot);
+    poseVersion++;
 }
 
 Vector<double> Player::generateRay(double cameraX) const
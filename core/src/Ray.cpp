@@ -0,0 +1,154 @@
+/**
+ * The DDA is based on the tutorial by Lode Vandevenne: https://lodev.org/cgtutor/raycasting.html
+ */
+
+#include <cmath>
+
+#include <Ray.h>
+
+RayFan::RayFan(const Player &player, int screenWidth) : dirX(player.dirX()),
+                                                        dirY(player.dirY()),
+                                                        camX(player.camX()),
+                                                        camY(player.camY()),
+                                                        posX(player.posX()),
+                                                        posY(player.posY()),
+                                                        screenWidth(screenWidth)
+{
+}
+
+/**
+ * @brief Steps a ray from cell to cell until it enters a wall.
+ */
+static inline void walk(const int *tiles, int width, int &mapX, int &mapY, double &sideDistX, double &sideDistY,
+                        double deltaDistX, double deltaDistY, int stepX, int stepY, int &side)
+{
+    while (true)
+    {
+        // jump to next map square, either in x-direction, or in y-direction
+        if (sideDistX < sideDistY)
+        {
+            sideDistX += deltaDistX;
+            mapX += stepX;
+            side = 0;
+        }
+        else
+        {
+            sideDistY += deltaDistY;
+            mapY += stepY;
+            side = 1;
+        }
+        // Check if ray has hit a wall
+        if (tiles[mapX + mapY * width] > 0)
+            return;
+    }
+}
+
+/**
+ * @brief Gets the distance of a wall from the camera plane once the ray entered it.
+ */
+static inline double getPerpWallDist(int side, double sideDistX, double sideDistY, double deltaDistX, double deltaDistY)
+{
+    // Calculate distance projected on camera direction. This is the shortest distance from the point where the wall is
+    // hit to the camera plane. Euclidean to center camera point would give fisheye effect!
+    // This can be computed as (mapX - posX + (1 - stepX) / 2) / rayDirX for side == 0, or same formula with Y
+    // for size == 1, but can be simplified to the code below thanks to how sideDist and deltaDist are computed:
+    // because they were left scaled to |rayDir|. sideDist is the entire length of the ray above after the multiple
+    // steps, but we subtract deltaDist once because one step more into the wall was taken above.
+    if (side == 0)
+        return sideDistX - deltaDistX;
+    else
+        return sideDistY - deltaDistY;
+}
+
+/**
+ * @brief The state of a ray in the DDA, from the cell of the player to the wall it hits.
+ */
+struct RayState
+{
+    double sideDistX, sideDistY;   // The length of the ray from its start to the next x or y-side.
+    double deltaDistX, deltaDistY; // The length of the ray from one x or y-side to the next one.
+    int stepX, stepY;              // The direction to step in x or y-direction (either +1 or -1).
+};
+
+/**
+ * @brief Starts the ray of a column in the cell of the player.
+ */
+static inline RayState startRay(const RayFan &fan, int x, RayHit &hit)
+{
+    RayState ray;
+    // calculate ray position and direction
+    double cameraX = 2 * x / double(fan.screenWidth) - 1; // x-coordinate in camera space
+    hit.rayX = fan.dirX + fan.camX * cameraX;
+    hit.rayY = fan.dirY + fan.camY * cameraX;
+    // which box of the map we're in
+    hit.mapX = int(fan.posX);
+    hit.mapY = int(fan.posY);
+
+    // length of ray from one x or y-side to next x or y-side
+    // these are derived as:
+    // deltaDistX = sqrt(1 + (rayDirY * rayDirY) / (rayDirX * rayDirX))
+    // deltaDistY = sqrt(1 + (rayDirX * rayDirX) / (rayDirY * rayDirY))
+    // which can be simplified to abs(|rayDir| / rayDirX) and abs(|rayDir| / rayDirY)
+    // where |rayDir| is the length of the vector (rayDirX, rayDirY). Its length,
+    // unlike (dirX, dirY) is not 1, however this does not matter, only the
+    // ratio between deltaDistX and deltaDistY matters, due to the way the DDA
+    // stepping further below works. So the values can be computed as below.
+    //  Division through zero is prevented, even though technically that's not
+    //  needed in C++ with IEEE 754 floating point values.
+    ray.deltaDistX = (hit.rayX == 0) ? 1e30 : std::abs(1 / hit.rayX);
+    ray.deltaDistY = (hit.rayY == 0) ? 1e30 : std::abs(1 / hit.rayY);
+
+    // calculate step and initial sideDist
+    if (hit.rayX < 0)
+    {
+        ray.stepX = -1;
+        ray.sideDistX = (fan.posX - hit.mapX) * ray.deltaDistX;
+    }
+    else
+    {
+        ray.stepX = 1;
+        ray.sideDistX = (hit.mapX + 1.0 - fan.posX) * ray.deltaDistX;
+    }
+    if (hit.rayY < 0)
+    {
+        ray.stepY = -1;
+        ray.sideDistY = (fan.posY - hit.mapY) * ray.deltaDistY;
+    }
+    else
+    {
+        ray.stepY = 1;
+        ray.sideDistY = (hit.mapY + 1.0 - fan.posY) * ray.deltaDistY;
+    }
+    return ray;
+}
+
+void traceRay(const Map &map, const RayFan &fan, int x, RayHit &hit)
+{
+    RayState ray = startRay(fan, x, hit);
+    // perform DDA
+    walk(map.getTiles().data(), map.getWidth(), hit.mapX, hit.mapY, ray.sideDistX, ray.sideDistY, ray.deltaDistX,
+         ray.deltaDistY, ray.stepX, ray.stepY, hit.side);
+    hit.perpWallDist = getPerpWallDist(hit.side, ray.sideDistX, ray.sideDistY, ray.deltaDistX, ray.deltaDistY);
+}
+
+void traceRayToWall(const RayFan &fan, int x, int mapX, int mapY, int side, RayHit &hit)
+{
+    RayState ray = startRay(fan, x, hit);
+    // The DDA would cross one grid line per cell between the player and the wall: the side the wall is hit on is
+    // reached with the same additions, without reading the cells
+    if (side == 0)
+        for (int steps = std::abs(mapX - hit.mapX); steps > 0; steps--)
+            ray.sideDistX += ray.deltaDistX;
+    else
+        for (int steps = std::abs(mapY - hit.mapY); steps > 0; steps--)
+            ray.sideDistY += ray.deltaDistY;
+    hit.mapX = mapX;
+    hit.mapY = mapY;
+    hit.side = side;
+    hit.perpWallDist = getPerpWallDist(side, ray.sideDistX, ray.sideDistY, ray.deltaDistX, ray.deltaDistY);
+}
+
+int countDdaSteps(const RayFan &fan, const RayHit &hit)
+{
+    return std::abs(hit.mapX - int(fan.posX)) + std::abs(hit.mapY - int(fan.posY));
+}
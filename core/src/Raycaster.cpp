@@ -0,0 +1,804 @@
+/**
+ * The following implementation is mainly based on the tutorial by Lode Vandevenne: https://lodev.org/cgtutor/raycasting.html
+ */
+
+#include <cmath>
+#include <chrono>
+#include <algorithm>
+
+#include <Raycaster.h>
+
+Raycaster::Raycaster(Player &player, DoubleBuffer &doubleBuffer, Map &map) : player(player),
+                                                                             doubleBuffer(doubleBuffer),
+                                                                             map(map),
+                                                                             executor(nullptr),
+                                                                             screenWidth(doubleBuffer.getWidth()),
+                                                                             screenHeight(doubleBuffer.getHeight()),
+                                                                             floorTexture(map.getFloorTexture()),
+                                                                             ceilingTexture(map.getCeilingTexture()),
+                                                                             zBuffer(doubleBuffer.getFullWidth()),
+                                                                             wallStart(doubleBuffer.getFullWidth(), screenHeight),
+                                                                             wallEnd(doubleBuffer.getFullWidth(), -1),
+                                                                             halfResolutionFloor(false),
+                                                                             traversal(Traversal::SCALAR),
+                                                                             raysPerSecond(1.0),
+                                                                             ddaSteps(0),
+                                                                             wallEngine(WallEngine::RAYCAST),
+                                                                             reprojection(Reprojection::NONE),
+                                                                             wallHits(doubleBuffer.getFullWidth()),
+                                                                             lastWallHits(doubleBuffer.getFullWidth()),
+                                                                             lastFan(player, 0),
+                                                                             lastWallsCast(false),
+                                                                             reprojecting(false),
+                                                                             reprojectedColumns(0),
+                                                                             reprojectedFraction(0),
+                                                                             fogTableScale(0),
+                                                                             spriteOrder(map.getSprites().size()),
+                                                                             spriteDistance(map.getSprites().size()),
+                                                                             numSprites(map.getSprites().size()),
+                                                                             frameDrawn(false),
+                                                                             drawnPoseVersion(0),
+                                                                             drawnSpriteVersion(0),
+                                                                             drawnTextureVersion(0),
+                                                                             drawnWidth(0),
+                                                                             drawnHeight(0),
+                                                                             layerSaved(false),
+                                                                             redrawnFraction(0)
+{
+}
+
+void Raycaster::setExecutor(Executor *executor) { this->executor = executor; }
+
+void Raycaster::render()
+{
+    // The walls first, so that the floor and ceiling skip the pixels they cover. The sprites only depend on the pose,
+    // so they are sorted and projected alongside the walls.
+    castWalls([this]()
+              { updateSpriteProjections(); });
+    castFloorCeiling();
+    drawSprites();
+    layerSaved = false;
+    recordFrame();
+}
+
+bool Raycaster::renderChanges()
+{
+    updateScreenSize();
+    bool viewChanged = !frameDrawn || player.getPoseVersion() != drawnPoseVersion ||
+                       map.getTextureVersion() != drawnTextureVersion || screenWidth != drawnWidth ||
+                       screenHeight != drawnHeight;
+    if (!viewChanged && map.getSpriteVersion() == drawnSpriteVersion)
+    {
+        redrawnFraction = 0;
+        return false;
+    }
+
+    if (!viewChanged && layerSaved)
+    {
+        // Only sprites moved: the static layer is restored under them and every sprite is drawn again over it, with
+        // the depths of its walls. Over the last frame, only the columns of the sprites that moved are.
+        updateSpriteProjections();
+        std::vector<ColumnRange> columns;
+        if (doubleBuffer.canReopenBackBuffer())
+        {
+            columns = getMovedSpriteColumns();
+            doubleBuffer.reopenBackBuffer(columns);
+        }
+        else
+            columns.push_back({0, screenWidth});
+        int redrawn = 0;
+        for (const ColumnRange &range : columns)
+        {
+            doubleBuffer.restoreLayer(range);
+            parallelFor(range.end - range.begin, SPRITE_CHUNK, [this, &range](int begin, int end)
+                        { drawSpriteColumns(range.begin + begin, range.begin + end); });
+            redrawn += range.end - range.begin;
+        }
+        recordFrame();
+        redrawnFraction = double(redrawn) / screenWidth;
+        return true;
+    }
+
+    castWalls([this]()
+              { updateSpriteProjections(); });
+    castFloorCeiling();
+    // The player did not move, so the next frames may only move sprites over the same walls, floor and ceiling
+    layerSaved = !viewChanged;
+    if (layerSaved)
+        doubleBuffer.saveLayer();
+    drawSprites();
+    recordFrame();
+    redrawnFraction = 1;
+    return true;
+}
+
+double Raycaster::getRedrawnFraction() const { return redrawnFraction; }
+
+void Raycaster::recordFrame()
+{
+    frameDrawn = true;
+    drawnPoseVersion = player.getPoseVersion();
+    drawnSpriteVersion = map.getSpriteVersion();
+    drawnTextureVersion = map.getTextureVersion();
+    drawnWidth = screenWidth;
+    drawnHeight = screenHeight;
+    const std::vector<Sprite> &sprites = map.getSprites();
+    drawnSprites.clear();
+    for (const Sprite &sprite : sprites)
+        drawnSprites.push_back(Vector<double>(sprite.posX(), sprite.posY()));
+    drawnProjections = projections;
+}
+
+std::vector<ColumnRange> Raycaster::getMovedSpriteColumns() const
+{
+    const std::vector<Sprite> &sprites = map.getSprites();
+    std::vector<ColumnRange> columns;
+    for (const std::vector<SpriteProjection> *frameProjections : {&drawnProjections, &projections})
+        for (const SpriteProjection &projection : *frameProjections)
+        {
+            const Sprite &sprite = sprites[projection.sprite];
+            const Vector<double> &drawn = drawnSprites[projection.sprite];
+            int begin = std::max(projection.drawStartX, 0);
+            int end = std::min(projection.drawEndX, screenWidth);
+            if ((sprite.posX() != drawn.x() || sprite.posY() != drawn.y()) && begin < end)
+                columns.push_back({begin, end});
+        }
+
+    // Merged into disjoint ranges, in order
+    std::sort(columns.begin(), columns.end(), [](const ColumnRange &a, const ColumnRange &b)
+              { return a.begin < b.begin; });
+    std::vector<ColumnRange> merged;
+    for (const ColumnRange &range : columns)
+        if (!merged.empty() && range.begin <= merged.back().end)
+            merged.back().end = std::max(merged.back().end, range.end);
+        else
+            merged.push_back(range);
+    return merged;
+}
+
+void Raycaster::parallelFor(int count, int chunkSize, const std::function<void(int, int)> &body)
+{
+    if (executor)
+        executor->parallelFor(count, chunkSize, body);
+    else if (count > 0)
+        body(0, count);
+}
+
+void Raycaster::parallelFor(int count, int chunkSize, const std::function<void(int, int)> &body,
+                            const std::function<void()> &task)
+{
+    if (executor)
+        executor->parallelFor(count, chunkSize, body, task);
+    else
+    {
+        if (task)
+            task();
+        if (count > 0)
+            body(0, count);
+    }
+}
+
+void Raycaster::castFloorCeiling()
+{
+    updateScreenSize();
+
+    // rayDir for leftmost ray (x = 0) and rightmost ray (x = w)
+    Vector<double> rayDir0 = {player.dirX() - player.camX(), player.dirY() - player.camY()};
+    Vector<double> rayDir1 = {player.dirX() + player.camX(), player.dirY() + player.camY()};
+    // Vertical position of the camera.
+    double posZ = 0.5 * screenHeight;
+    int horizon = screenHeight / 2;
+
+    // One more row than the screen, used by the interpolation at half resolution
+    floorRows.resize(screenHeight - horizon + 1);
+    for (int p = 0; p < int(floorRows.size()); p++)
+    {
+        // Horizontal distance from the camera to the floor for the current row, p being the position of the row
+        // compared to the horizon. 0.5 is the z position exactly in the middle between floor and ceiling.
+        double rowDistance = posZ / p;
+
+        // calculate the real world step vector we have to add for each x (parallel to camera plane)
+        floorRows[p].stepX = rowDistance * (rayDir1.x() - rayDir0.x()) / screenWidth;
+        floorRows[p].stepY = rowDistance * (rayDir1.y() - rayDir0.y()) / screenWidth;
+
+        // real world coordinates of the leftmost column
+        floorRows[p].basisX = player.posX() + rowDistance * rayDir0.x();
+        floorRows[p].basisY = player.posY() + rowDistance * rayDir0.y();
+        floorRows[p].shade = Texture::getShade(getFogLevel(rowDistance), true);
+    }
+
+    if (halfResolutionFloor)
+    {
+        castFloorCeilingHalf();
+        return;
+    }
+
+    // Each column is filled with vertical spans, from the bottom of the wall to the bottom of the screen for the
+    // floor, and from the top of the screen to the top of the wall for the ceiling. The spans of a few neighbouring
+    // columns are filled row by row, so that the writes stay contiguous in memory, and each block of columns is
+    // handed to a thread as a whole.
+    int blocks = (screenWidth + SPAN_BLOCK - 1) / SPAN_BLOCK;
+    parallelFor(blocks, 1, [this](int begin, int end)
+                {
+                    for (int block = begin; block < end; block++)
+                        castFloorCeilingBlock(block * SPAN_BLOCK);
+                });
+}
+
+int Raycaster::getSpans(int x0, int x1, int *floorStart, int *ceilingEnd, long &writes) const
+{
+    int horizon = screenHeight / 2;
+    int blockStart = screenHeight;
+    for (int x = x0; x < x1; x++)
+    {
+        floorStart[x - x0] = std::max(wallEnd[x] + 1, horizon);
+        ceilingEnd[x - x0] = std::min(wallStart[x], screenHeight - horizon);
+        blockStart = std::min(blockStart, std::min(floorStart[x - x0], screenHeight - ceilingEnd[x - x0]));
+        writes += screenHeight - floorStart[x - x0] + ceilingEnd[x - x0];
+    }
+    return blockStart;
+}
+
+void Raycaster::castFloorCeilingBlock(int x0)
+{
+    int horizon = screenHeight / 2;
+    int x1 = std::min(x0 + SPAN_BLOCK, screenWidth);
+    int floorStart[SPAN_BLOCK], ceilingEnd[SPAN_BLOCK];
+    long writes = 0;
+    int blockStart = getSpans(x0, x1, floorStart, ceilingEnd, writes);
+
+    for (int y = blockStart; y < screenHeight; y++)
+    {
+        // copied, since drawing may alias the rows as far as the compiler knows
+        const FloorRow row = floorRows[y - horizon];
+        // the ceiling row symmetrical to the floor row, which shares its texture coordinates
+        int ceilingY = screenHeight - y - 1;
+
+        for (int x = x0; x < x1; x++)
+        {
+            bool floorVisible = y >= floorStart[x - x0];
+            bool ceilingVisible = ceilingY < ceilingEnd[x - x0];
+            if (!floorVisible && !ceilingVisible)
+                continue;
+
+            int tx, ty;
+            getFloorTexel(row, x, tx, ty);
+            unsigned int color;
+
+            // floor, in a shade a bit darker
+            if (floorVisible)
+            {
+                color = floorTexture.get(tx, ty, row.shade);
+                doubleBuffer.drawPixel(x, y, color);
+            }
+
+            // ceiling
+            if (ceilingVisible)
+            {
+                color = ceilingTexture.get(tx, ty, row.shade);
+                doubleBuffer.drawPixel(x, ceilingY, color);
+            }
+        }
+    }
+    doubleBuffer.countPixelWrites(writes);
+}
+
+inline void Raycaster::getFloorTexel(const FloorRow &row, int x, int &tx, int &ty) const
+{
+    double floorX = row.basisX + x * row.stepX;
+    double floorY = row.basisY + x * row.stepY;
+    // the cell coord is simply got from the integer parts of floorX and floorY
+    int cellX = int(floorX);
+    int cellY = int(floorY);
+
+    // get the texture coordinate from the fractional part
+    tx = int(floorTexture.getWidth() * (floorX - cellX)) & (floorTexture.getWidth() - 1);
+    ty = int(floorTexture.getHeight() * (floorY - cellY)) & (floorTexture.getHeight() - 1);
+}
+
+// Averages two colors channel by channel, without carrying from one channel to the next
+static inline unsigned int averageColors(unsigned int a, unsigned int b)
+{
+    return (((a ^ b) >> 1) & 0x7F7F7F7F) + (a & b);
+}
+
+void Raycaster::castFloorCeilingHalf()
+{
+    int rows = int(floorRows.size());
+
+    // Samples at the even columns (one more for the interpolation of the last column) and at every row
+    int sampleColumns = screenWidth / 2 + 1;
+    floorSamples.resize(sampleColumns * rows);
+    ceilingSamples.resize(sampleColumns * rows);
+
+    // The even rows are cast, except that the horizon row (always covered by the walls) is replaced by the next one
+    // to interpolate with finite values
+    int evenRows = (rows + 1) / 2;
+    parallelFor(evenRows, SAMPLE_CHUNK, [this](int begin, int end)
+                { castFloorSampleRows(begin, end); });
+
+    // The odd rows are interpolated vertically between the rows above and below
+    parallelFor(rows / 2, SAMPLE_CHUNK, [this, rows, sampleColumns](int begin, int end)
+                {
+                    for (int p = 2 * begin + 1; p < 2 * end + 1 && p + 1 < rows; p += 2)
+                        for (int i = p * sampleColumns; i < (p + 1) * sampleColumns; i++)
+                        {
+                            floorSamples[i] = averageColors(floorSamples[i - sampleColumns], floorSamples[i + sampleColumns]);
+                            ceilingSamples[i] = averageColors(ceilingSamples[i - sampleColumns], ceilingSamples[i + sampleColumns]);
+                        }
+                });
+
+    int blocks = (screenWidth + SPAN_BLOCK - 1) / SPAN_BLOCK;
+    parallelFor(blocks, 1, [this](int begin, int end)
+                {
+                    for (int block = begin; block < end; block++)
+                        castFloorCeilingHalfBlock(block * SPAN_BLOCK);
+                });
+}
+
+void Raycaster::castFloorSampleRows(int begin, int end)
+{
+    int rows = int(floorRows.size());
+    int sampleColumns = screenWidth / 2 + 1;
+    for (int p = 2 * begin; p < 2 * end; p += 2)
+    {
+        const FloorRow &row = floorRows[p > 0 || rows == 1 ? p : 1];
+        for (int i = 0; i < sampleColumns; i++)
+        {
+            int tx, ty;
+            getFloorTexel(row, 2 * i, tx, ty);
+            floorSamples[p * sampleColumns + i] = floorTexture.get(tx, ty, row.shade);
+            ceilingSamples[p * sampleColumns + i] = ceilingTexture.get(tx, ty, row.shade);
+        }
+    }
+}
+
+void Raycaster::castFloorCeilingHalfBlock(int x0)
+{
+    int horizon = screenHeight / 2;
+    int sampleColumns = screenWidth / 2 + 1;
+    int x1 = std::min(x0 + SPAN_BLOCK, screenWidth);
+    int floorStart[SPAN_BLOCK], ceilingEnd[SPAN_BLOCK];
+    long writes = 0;
+    int blockStart = getSpans(x0, x1, floorStart, ceilingEnd, writes);
+
+    // Same filling as castFloorCeilingBlock; the even columns were cast, the odd columns are interpolated horizontally
+    for (int y = blockStart; y < screenHeight; y++)
+    {
+        const unsigned int *floorRow = &floorSamples[(y - horizon) * sampleColumns];
+        const unsigned int *ceilingRow = &ceilingSamples[(y - horizon) * sampleColumns];
+        int ceilingY = screenHeight - y - 1;
+
+        for (int x = x0; x < x1; x++)
+        {
+            int i = x / 2;
+            bool odd = x % 2 == 1;
+            if (y >= floorStart[x - x0])
+                doubleBuffer.drawPixel(x, y, odd ? averageColors(floorRow[i], floorRow[i + 1]) : floorRow[i]);
+            if (ceilingY < ceilingEnd[x - x0])
+                doubleBuffer.drawPixel(x, ceilingY, odd ? averageColors(ceilingRow[i], ceilingRow[i + 1]) : ceilingRow[i]);
+        }
+    }
+    doubleBuffer.countPixelWrites(writes);
+}
+
+void Raycaster::setHalfResolutionFloor(bool halfResolution)
+{
+    halfResolutionFloor = halfResolution;
+    frameDrawn = false;
+}
+
+void Raycaster::setFogDistance(double distance)
+{
+    frameDrawn = false;
+    fogTable.clear();
+    int levels = map.getFogLevels();
+    if (distance <= 0 || levels == 0)
+        return;
+    // the distances up to the fog distance are spread evenly over the levels, the last one continuing beyond it
+    fogTable.resize(FOG_TABLE_SIZE);
+    for (int i = 0; i < FOG_TABLE_SIZE; i++)
+        fogTable[i] = std::min(levels, i * (levels + 1) / FOG_TABLE_SIZE);
+    fogTableScale = FOG_TABLE_SIZE / distance;
+}
+
+int Raycaster::getFogLevel(double distance) const
+{
+    if (fogTable.empty())
+        return 0;
+    double index = distance * fogTableScale;
+    // infinite at the horizon
+    if (!(index < FOG_TABLE_SIZE))
+        return fogTable.back();
+    return fogTable[int(index)];
+}
+
+void Raycaster::castWalls() { castWalls(std::function<void()>()); }
+
+void Raycaster::castWalls(const std::function<void()> &task)
+{
+    updateScreenSize();
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    ddaSteps = 0;
+    reprojectedColumns = 0;
+    // The walls of the last frame are read while those of this one are recorded
+    wallHits.swap(lastWallHits);
+    reprojecting = reprojection == Reprojection::ROTATION && wallEngine == WallEngine::RAYCAST && lastWallsCast &&
+                   lastFan.screenWidth == screenWidth &&
+                   lastFan.posX == player.posX() && lastFan.posY == player.posY();
+    if (wallEngine == WallEngine::SEGMENTS)
+    {
+        RayFan fan(player, screenWidth);
+        wallSegments->project(fan);
+        parallelFor(screenWidth, SEGMENT_CHUNK, [this, &fan](int begin, int end)
+                    { castWallSegments(fan, begin, end); }, task);
+    }
+    else
+        parallelFor(screenWidth, WALL_CHUNK, [this](int begin, int end)
+                    { castWallColumns(begin, end); }, task);
+    lastFan = RayFan(player, screenWidth);
+    lastWallsCast = wallEngine == WallEngine::RAYCAST;
+    reprojectedFraction = double(reprojectedColumns) / screenWidth;
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (elapsed.count() > 0)
+        raysPerSecond.update(screenWidth / elapsed.count());
+}
+
+void Raycaster::setTraversal(Traversal traversal)
+{
+    this->traversal = traversal;
+    frameDrawn = false;
+}
+
+double Raycaster::getRaysPerSecond() { return raysPerSecond.get(); }
+
+long Raycaster::getDdaSteps() const { return ddaSteps; }
+
+void Raycaster::setWallEngine(WallEngine wallEngine)
+{
+    this->wallEngine = wallEngine;
+    frameDrawn = false;
+    if (wallEngine == WallEngine::SEGMENTS && !wallSegments)
+        wallSegments.reset(new WallSegments(map));
+}
+
+void Raycaster::setReprojection(Reprojection reprojection)
+{
+    this->reprojection = reprojection;
+    // The walls of the last frame may have been cast before the last change of the other settings
+    lastWallsCast = false;
+    frameDrawn = false;
+}
+
+double Raycaster::getReprojectedFraction() const { return reprojectedFraction; }
+
+const Raycaster::WallHit *Raycaster::findReprojectedWall(int x) const
+{
+    // The ray of the column, as d + t * c with the direction d and the camera vector c of the last frame: t is its
+    // x-coordinate in the camera space of the last frame, if the scale s in front of it is positive
+    double cameraX = 2 * x / double(screenWidth) - 1;
+    double rayX = player.dirX() + player.camX() * cameraX;
+    double rayY = player.dirY() + player.camY() * cameraX;
+    double rayCrossCam = rayX * lastFan.camY - rayY * lastFan.camX;
+    double scale = rayCrossCam / (lastFan.dirX * lastFan.camY - lastFan.dirY * lastFan.camX);
+    if (!(scale > 0))
+        return nullptr;
+    double t = (lastFan.dirX * rayY - lastFan.dirY * rayX) / rayCrossCam;
+    double lastX = (t + 1) * screenWidth / 2;
+    if (!(lastX >= 1 && lastX < screenWidth - 2))
+        return nullptr;
+
+    // The ray is between the columns int(lastX) and int(lastX) + 1 of the last frame, and surely between those around
+    const WallHit &first = lastWallHits[int(lastX) - 1];
+    const WallHit &last = lastWallHits[int(lastX) + 2];
+    if (first.mapX != last.mapX || first.mapY != last.mapY || first.side != last.side)
+        return nullptr;
+    return &first;
+}
+
+void Raycaster::castWallSegments(const RayFan &fan, int xBegin, int xEnd)
+{
+    RayHit hits[SEGMENT_CHUNK];
+    long writes = 0;
+    long steps = 0;
+
+    for (int blockBegin = xBegin; blockBegin < xEnd; blockBegin += SEGMENT_CHUNK)
+    {
+        int blockEnd = std::min(blockBegin + SEGMENT_CHUNK, xEnd);
+        int missed = wallSegments->traceColumns(fan, blockBegin, blockEnd, hits);
+        for (int x = blockBegin; x < blockEnd; x++)
+        {
+            RayHit &hit = hits[x - blockBegin];
+            // a ray through the corner of two segments, where rounding left it in neither, is cast through the map
+            if (missed > 0 && std::isinf(hit.perpWallDist))
+            {
+                traceRay(map, fan, x, hit);
+                steps += countDdaSteps(fan, hit);
+            }
+            writes += drawWallColumn(x, hit, fan.posX, fan.posY);
+        }
+    }
+    doubleBuffer.countPixelWrites(writes);
+    ddaSteps += steps;
+}
+
+void Raycaster::castWallColumns(int xBegin, int xEnd)
+{
+    RayFan fan(player, screenWidth);
+    long writes = 0;
+    long steps = 0;
+
+    if (reprojecting)
+    {
+        // the columns whose wall is known from the last frame are moved to it, the others are cast
+        const WallHit *walls[REPROJECTION_BLOCK];
+        RayHit hit;
+        long reprojected = 0;
+        for (int blockBegin = xBegin; blockBegin < xEnd; blockBegin += REPROJECTION_BLOCK)
+        {
+            int blockEnd = std::min(blockBegin + REPROJECTION_BLOCK, xEnd);
+            for (int x = blockBegin; x < blockEnd; x++)
+                walls[x - blockBegin] = findReprojectedWall(x);
+            for (int x = blockBegin; x < blockEnd; x++)
+            {
+                const WallHit *wall = walls[x - blockBegin];
+                if (wall)
+                {
+                    traceRayToWall(fan, x, wall->mapX, wall->mapY, wall->side, hit);
+                    writes += drawWallColumn(x, hit, fan.posX, fan.posY);
+                    reprojected++;
+                    continue;
+                }
+                traceRay(map, fan, x, hit);
+                steps += countDdaSteps(fan, hit);
+                writes += drawWallColumn(x, hit, fan.posX, fan.posY);
+            }
+        }
+        reprojectedColumns += reprojected;
+    }
+    else if (traversal == Traversal::ADAPTIVE)
+    {
+        // the columns WALL_SUBDIVISION apart and the last one of the range are cast, then the gaps between them
+        RayHit hits[WALL_SUBDIVISION + 1];
+        traceRay(map, fan, xBegin, hits[0]);
+        steps += countDdaSteps(fan, hits[0]);
+        int x = xBegin;
+        while (x < xEnd - 1)
+        {
+            int last = std::min(WALL_SUBDIVISION, xEnd - 1 - x);
+            traceRay(map, fan, x + last, hits[last]);
+            steps += countDdaSteps(fan, hits[last]);
+            steps += subdivideWallColumns(fan, x, hits, 0, last);
+            for (int i = 0; i < last; i++)
+                writes += drawWallColumn(x + i, hits[i], fan.posX, fan.posY);
+            hits[0] = hits[last];
+            x += last;
+        }
+        writes += drawWallColumn(x, hits[0], fan.posX, fan.posY);
+    }
+    else
+    {
+        RayHit hit;
+        for (int x = xBegin; x < xEnd; x++)
+        {
+            traceRay(map, fan, x, hit);
+            steps += countDdaSteps(fan, hit);
+            writes += drawWallColumn(x, hit, fan.posX, fan.posY);
+        }
+    }
+    doubleBuffer.countPixelWrites(writes);
+    ddaSteps += steps;
+}
+
+long Raycaster::subdivideWallColumns(const RayFan &fan, int x, RayHit *hits, int first, int last)
+{
+    if (last - first < 2)
+        return 0;
+    const RayHit &a = hits[first];
+    const RayHit &b = hits[last];
+    if (a.mapX == b.mapX && a.mapY == b.mapY && a.side == b.side)
+    {
+        for (int i = first + 1; i < last; i++)
+            traceRayToWall(fan, x + i, a.mapX, a.mapY, a.side, hits[i]);
+        return 0;
+    }
+    // the wall or its side changes between the two ends, the column in the middle is cast to find where
+    int middle = (first + last) / 2;
+    traceRay(map, fan, x + middle, hits[middle]);
+    long steps = countDdaSteps(fan, hits[middle]);
+    return steps + subdivideWallColumns(fan, x, hits, first, middle) + subdivideWallColumns(fan, x, hits, middle, last);
+}
+
+int Raycaster::drawWallColumn(int x, const RayHit &hit, double posX, double posY)
+{
+    int lineHeight = int(screenHeight / hit.perpWallDist);
+
+    int drawStart = -lineHeight / 2 + screenHeight / 2;
+    if (drawStart < 0)
+        drawStart = 0;
+    int drawEnd = lineHeight / 2 + screenHeight / 2;
+    if (drawEnd >= screenHeight)
+        drawEnd = screenHeight - 1;
+
+    const Texture &texture = map.getTexture(hit.mapX, hit.mapY);
+
+    // calculate value of wallX
+    double wallX; // where exactly the wall was hit
+    if (hit.side == 0)
+        wallX = posY + hit.perpWallDist * hit.rayY;
+    else
+        wallX = posX + hit.perpWallDist * hit.rayX;
+    wallX -= std::floor(wallX);
+
+    // x coordinate on the texture
+    int texX = int(wallX * double(texture.getWidth()));
+    if (hit.side == 0 && hit.rayX > 0)
+        texX = texture.getWidth() - texX - 1;
+    if (hit.side == 1 && hit.rayY < 0)
+        texX = texture.getWidth() - texX - 1;
+
+    // the y-sides in a darker shade
+    int shade = Texture::getShade(getFogLevel(hit.perpWallDist), hit.side == 1);
+    doubleBuffer.drawVertLine(x, drawStart, drawEnd, lineHeight, texture, texX, shade);
+    wallStart[x] = drawStart;
+    wallEnd[x] = drawEnd;
+    wallHits[x] = {hit.mapX, hit.mapY, hit.side};
+
+    zBuffer[x] = hit.perpWallDist;
+    return drawEnd - drawStart + 1;
+}
+
+void Raycaster::castSprites()
+{
+    updateScreenSize();
+    updateSpriteProjections();
+    drawSprites();
+}
+
+void Raycaster::drawSprites()
+{
+    // Each thread draws every sprite, from far to close, in its own range of columns, so the closest sprites are on
+    // top as in a sequential drawing and no pixel is written by two threads
+    parallelFor(screenWidth, SPRITE_CHUNK, [this](int begin, int end)
+                { drawSpriteColumns(begin, end); });
+}
+
+void Raycaster::updateSpriteProjections()
+{
+    sortSpritesByDistance();
+    projectSprites();
+}
+
+void Raycaster::sortSpritesByDistance()
+{
+    const std::vector<Sprite> &sprites = map.getSprites();
+
+    // sort sprites from far to close
+    for (int i = 0; i < numSprites; i++)
+    {
+        spriteOrder[i] = i;
+        const Sprite &sprite = sprites[i];
+        spriteDistance[i] = pow(player.posX() - sprite.posX(), 2) + pow(player.posY() - sprite.posY(), 2); // sqrt not taken, unneeded
+    }
+
+    sortSprites();
+}
+
+void Raycaster::projectSprites()
+{
+    const std::vector<Sprite> &sprites = map.getSprites();
+    const double dirX = player.dirX(), dirY = player.dirY();
+    const double camX = player.camX(), camY = player.camY();
+    projections.clear();
+
+    // do the projection of the sorted sprites, from far to close
+    for (int i = 0; i < numSprites; i++)
+    {
+        const Sprite &sprite = sprites[spriteOrder[i]];
+
+        // translate sprite position to relative to camera
+        double spriteX = sprite.posX() - player.posX();
+        double spriteY = sprite.posY() - player.posY();
+
+        // transform sprite with the inverse camera matrix
+        //  [ planeX   dirX ] -1                                       [ dirY      -dirX ]
+        //  [               ]       =  1/(planeX*dirY-dirX*planeY) *   [                 ]
+        //  [ planeY   dirY ]                                          [ -planeY  planeX ]
+
+        double invDet = 1.0 / (camX * dirY - dirX * camY); // required for correct matrix multiplication
+
+        SpriteProjection projection;
+        projection.sprite = spriteOrder[i];
+        double transformX = invDet * (dirY * spriteX - dirX * spriteY);
+        double transformY = invDet * (-camY * spriteX + camX * spriteY); // this is actually the depth inside the screen, that what Z is in 3D
+
+        // sprites behind the camera plane are not drawn
+        if (!(transformY > 0))
+            continue;
+        projection.transformY = transformY;
+
+        projection.screenX = int((screenWidth / 2) * (1 + transformX / transformY));
+
+        // calculate height of the sprite on screen
+        projection.height = abs(int(screenHeight / (transformY))); // using 'transformY' instead of the real distance prevents fisheye
+        // calculate lowest and highest pixel to fill in current stripe
+        projection.drawStartY = -projection.height / 2 + screenHeight / 2;
+        if (projection.drawStartY < 0)
+            projection.drawStartY = 0;
+        projection.drawEndY = projection.height / 2 + screenHeight / 2;
+        if (projection.drawEndY >= screenHeight)
+            projection.drawEndY = screenHeight - 1;
+
+        // calculate width of the sprite
+        projection.width = abs(int(screenHeight / (transformY)));
+        projection.drawStartX = -projection.width / 2 + projection.screenX;
+        if (projection.drawStartX < 0)
+            projection.drawStartX = 0;
+        projection.drawEndX = projection.width / 2 + projection.screenX;
+        if (projection.drawEndX >= screenWidth)
+            projection.drawEndX = screenWidth - 1;
+
+        projections.push_back(projection);
+    }
+}
+
+void Raycaster::drawSpriteColumns(int xBegin, int xEnd)
+{
+    const std::vector<Sprite> &sprites = map.getSprites();
+    long writes = 0;
+
+    for (const SpriteProjection &projection : projections)
+    {
+        const Sprite &sprite = sprites[projection.sprite];
+
+        // loop through every vertical stripe of the sprite in the range of columns
+        int stripeBegin = std::max(projection.drawStartX, xBegin);
+        int stripeEnd = std::min(projection.drawEndX, xEnd);
+        for (int stripe = stripeBegin; stripe < stripeEnd; stripe++)
+        {
+            int texX = int(256 * (stripe - (-projection.width / 2 + projection.screenX)) * sprite.getWidth() / projection.width) / 256;
+            // the conditions in the if are:
+            // 1) it's on the screen (left)
+            // 2) it's on the screen (right)
+            // 3) ZBuffer, with perpendicular distance
+            if (stripe > 0 && stripe < screenWidth && projection.transformY < zBuffer[stripe])
+                for (int y = projection.drawStartY; y < projection.drawEndY; y++) // for every pixel of the current stripe
+                {
+                    int d = (y) * 256 - screenHeight * 128 + projection.height * 128; // 256 and 128 factors to avoid floats
+                    int texY = ((d * sprite.getHeight()) / projection.height) / 256;
+                    unsigned int color = sprite.get(texX, texY); // get current color from the texture
+                    if ((color & 0x00FFFFFF) != 0)
+                    {
+                        doubleBuffer.drawPixel(stripe, y, color); // paint pixel if it isn't black, black is the invisible color
+                        writes++;
+                    }
+                }
+        }
+    }
+    doubleBuffer.countPixelWrites(writes);
+}
+
+void Raycaster::updateScreenSize()
+{
+    // The resolution may change between frames
+    screenWidth = doubleBuffer.getWidth();
+    screenHeight = doubleBuffer.getHeight();
+}
+
+void Raycaster::sortSprites()
+{
+    std::vector<std::pair<double, int>> sprites(numSprites);
+    for (int i = 0; i < numSprites; i++)
+    {
+        sprites[i].first = spriteDistance[i];
+        sprites[i].second = spriteOrder[i];
+    }
+    std::sort(sprites.begin(), sprites.end());
+    // restore in reverse order to go from farthest to nearest
+    for (int i = 0; i < numSprites; i++)
+    {
+        spriteDistance[i] = sprites[numSprites - i - 1].first;
+        spriteOrder[i] = sprites[numSprites - i - 1].second;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include <RelayClient.h>
+
+RelayClient::RelayClient(UDPReceiver &receiver, UDPSender &sender, int listeningPort, int nbPlayers)
+    : receiver(receiver),
+      sender(sender),
+      listeningPort(listeningPort),
+      nbPlayers(nbPlayers),
+      buffer(Snapshot::MAX_VALUES),
+      lastTick(-1),
+      lostSnapshots(0),
+      nextPlayerIndex(0)
+{
+}
+
+void RelayClient::send(double x, double y)
+{
+    // The relay cannot know the listening port from the packet, since it is sent from another socket
+    double values[3] = {x, y, double(listeningPort)};
+    sender.send(values, 3);
+}
+
+int RelayClient::receive(Map &map)
+{
+    int received = 0;
+    std::string senderIp;
+    int nbValues;
+    while ((nbValues = receiver.receive(buffer.data(), buffer.size(), senderIp)) >= 0)
+    {
+        if (!snapshot.decode(buffer.data(), nbValues))
+            continue;
+
+        // A snapshot older than the last one used would move the players back
+        if (snapshot.tick <= lastTick)
+        {
+            lostSnapshots++;
+            continue;
+        }
+        if (lastTick >= 0)
+            lostSnapshots += snapshot.tick - lastTick - 1;
+        lastTick = snapshot.tick;
+        received++;
+
+        for (const SnapshotEntry &entry : snapshot.entries)
+        {
+            if (entry.id == snapshot.recipient || nbPlayers == 0)
+                continue;
+            // Update the player's index if it is the first time we receive data from them
+            if (playersIndexes.find(entry.id) == playersIndexes.end())
+            {
+                playersIndexes[entry.id] = nextPlayerIndex++;
+                nextPlayerIndex %= nbPlayers;
+            }
+            map.movePlayer(playersIndexes[entry.id], entry.x, entry.y);
+        }
+    }
+    return received;
+}
+
+long RelayClient::getLostSnapshots() const { return lostSnapshots; }
@@ -0,0 +1,28 @@
+#include <RemotePositions.h>
+
+RemotePositions::RemotePositions(int nbPlayers) : positions(nbPlayers, {-1, -1}),
+                                                  middle(1),
+                                                  back(0),
+                                                  front(2)
+{
+    for (std::vector<Vector<double>> &buffer : buffers)
+        buffer = positions;
+}
+
+void RemotePositions::publish(int index, double x, double y)
+{
+    positions[index] = {x, y};
+
+    // The back buffer may hold any older snapshot, so the whole state is written before publishing it.
+    buffers[back] = positions;
+
+    // Release makes the buffer contents visible to the reader that acquires the new middle index.
+    back = middle.exchange(back | DIRTY, std::memory_order_acq_rel) & ~DIRTY;
+}
+
+const std::vector<Vector<double>> &RemotePositions::acquire()
+{
+    if (middle.load(std::memory_order_relaxed) & DIRTY)
+        front = middle.exchange(front, std::memory_order_acq_rel) & ~DIRTY;
+    return buffers[front];
+}
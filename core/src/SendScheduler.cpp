@@ -0,0 +1,87 @@
+#include <SendScheduler.h>
+
+SendScheduler::SendScheduler(const std::function<void(double, double)> &send, double tickRate, double heartbeatInterval)
+    : send(send),
+      tickInterval(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / tickRate))),
+      heartbeat(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(heartbeatInterval))),
+      stillRunning(false),
+      currentX(0),
+      currentY(0),
+      positionChanged(true)
+{
+}
+
+SendScheduler::~SendScheduler()
+{
+    stopThread();
+}
+
+void SendScheduler::startThread()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // If the thread is already running, we don't start it again
+    if (stillRunning)
+        return;
+
+    stillRunning = true;
+    thread = std::thread(&SendScheduler::schedulerThread, this);
+}
+
+void SendScheduler::stopThread()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!stillRunning)
+            return;
+        stillRunning = false;
+    }
+    condition.notify_one();
+
+    if (thread.joinable())
+        thread.join();
+}
+
+void SendScheduler::notifyPositionChanged(double x, double y)
+{
+    // The thread is not woken up, it picks the latest position at its next tick
+    std::lock_guard<std::mutex> lock(mutex);
+    currentX = x;
+    currentY = y;
+    positionChanged = true;
+}
+
+void SendScheduler::schedulerThread()
+{
+    std::chrono::steady_clock::time_point nextTick = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point lastSend = nextTick - heartbeat;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        // Wait for the next tick, or until the thread should stop
+        if (condition.wait_until(lock, nextTick, [this] { return !stillRunning; }))
+            break;
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        // Skip the ticks that were missed instead of sending them in a burst
+        nextTick += tickInterval;
+        if (nextTick < now)
+            nextTick = now + tickInterval;
+
+        if (!positionChanged && now - lastSend < heartbeat)
+            continue;
+
+        double x = currentX;
+        double y = currentY;
+        positionChanged = false;
+
+        // The position is copied so that the rendering thread is not blocked while the packets are sent
+        lock.unlock();
+        send(x, y);
+        lock.lock();
+
+        lastSend = now;
+    }
+}
@@ -0,0 +1,34 @@
+#include <Snapshot.h>
+
+int Snapshot::encode(double *values) const
+{
+    int count = int(entries.size()) < MAX_ENTRIES ? int(entries.size()) : MAX_ENTRIES;
+
+    values[0] = recipient;
+    values[1] = tick;
+    values[2] = count;
+    for (int i = 0; i < count; i++)
+    {
+        values[3 + 3 * i] = entries[i].id;
+        values[4 + 3 * i] = entries[i].x;
+        values[5 + 3 * i] = entries[i].y;
+    }
+    return 3 + 3 * count;
+}
+
+bool Snapshot::decode(const double *values, int nbValues)
+{
+    if (nbValues < 3)
+        return false;
+
+    int count = int(values[2]);
+    if (count < 0 || count > MAX_ENTRIES || nbValues != 3 + 3 * count)
+        return false;
+
+    recipient = int(values[0]);
+    tick = long(values[1]);
+    entries.resize(count);
+    for (int i = 0; i < count; i++)
+        entries[i] = {int(values[3 + 3 * i]), values[4 + 3 * i], values[5 + 3 * i]};
+    return true;
+}
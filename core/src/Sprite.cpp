@@ -5,6 +5,7 @@ Sprite::Sprite(Vector<double> position, const Texture &texture) : position(posit
 }
 
 unsigned int Sprite::get(int x, int y) const { return texture.get(x, y); }
+void Sprite::setTextureFormat(TextureFormat format) { texture.setFormat(format); }
 int Sprite::getWidth() const { return texture.getWidth(); }
 int Sprite::getHeight() const { return texture.getHeight(); }
 double Sprite::posX() const { return position.x(); }
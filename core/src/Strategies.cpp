@@ -0,0 +1,77 @@
+#include <stdexcept>
+
+#include <Strategies.h>
+
+ThreadingStrategy parseThreading(const std::string &name)
+{
+    if (name == "none")
+        return ThreadingStrategy::NONE;
+    if (name == "openmp")
+        return ThreadingStrategy::OPENMP;
+    if (name == "pool")
+        return ThreadingStrategy::POOL;
+    throw std::invalid_argument("Unknown threading strategy: " + name);
+}
+
+DisplayStrategy parseDisplay(const std::string &name)
+{
+    if (name == "sync")
+        return DisplayStrategy::SYNC;
+    if (name == "threaded")
+        return DisplayStrategy::THREADED;
+    throw std::invalid_argument("Unknown display strategy: " + name);
+}
+
+ReceiveStrategy parseReceive(const std::string &name)
+{
+    if (name == "inline")
+        return ReceiveStrategy::INLINE;
+    if (name == "thread")
+        return ReceiveStrategy::THREAD;
+    throw std::invalid_argument("Unknown receive strategy: " + name);
+}
+
+SendStrategy parseSend(const std::string &name)
+{
+    if (name == "inline")
+        return SendStrategy::INLINE;
+    if (name == "thread")
+        return SendStrategy::THREAD;
+    throw std::invalid_argument("Unknown send strategy: " + name);
+}
+
+Traversal parseTraversal(const std::string &name)
+{
+    if (name == "scalar")
+        return Traversal::SCALAR;
+    if (name == "adaptive")
+        return Traversal::ADAPTIVE;
+    throw std::invalid_argument("Unknown traversal: " + name);
+}
+
+WallEngine parseWallEngine(const std::string &name)
+{
+    if (name == "raycast")
+        return WallEngine::RAYCAST;
+    if (name == "segments")
+        return WallEngine::SEGMENTS;
+    throw std::invalid_argument("Unknown wall engine: " + name);
+}
+
+TextureFormat parseTextureFormat(const std::string &name)
+{
+    if (name == "direct")
+        return TextureFormat::DIRECT;
+    if (name == "indexed")
+        return TextureFormat::INDEXED;
+    throw std::invalid_argument("Unknown texture format: " + name);
+}
+
+Reprojection parseReprojection(const std::string &name)
+{
+    if (name == "none")
+        return Reprojection::NONE;
+    if (name == "rotation")
+        return Reprojection::ROTATION;
+    throw std::invalid_argument("Unknown reprojection: " + name);
+}
@@ -0,0 +1,161 @@
+#include <unordered_map>
+#include <algorithm>
+
+#include <Texture.h>
+
+Texture::Texture(int width, int height, bool isVertical) : width(width), height(height), table(nullptr), isVertical(isVertical), fogLevels(0), format(TextureFormat::DIRECT)
+{
+    setStorage(std::vector<unsigned int>(width * height));
+    generateShades();
+}
+
+Texture::Texture(int width, int height, const unsigned int *pixels, bool isVertical) : width(width), height(height), table(nullptr), isVertical(isVertical), fogLevels(0), format(TextureFormat::DIRECT)
+{
+    std::vector<unsigned int> storedPixels(width * height);
+    if (isVertical)
+        for (int x = 0; x < width; x++)
+            for (int y = 0; y < height; y++)
+                storedPixels[y + x * height] = pixels[x + y * width];
+    else
+        for (int i = 0; i < width * height; i++)
+            storedPixels[i] = pixels[i];
+    setStorage(std::move(storedPixels));
+    generateShades();
+}
+
+Texture::Texture(int width, int height, bool isVertical, const unsigned int *table) : width(width), height(height), pixels(table), table(table), isVertical(isVertical), fogLevels(0), format(TextureFormat::DIRECT)
+{
+}
+
+Texture Texture::fromTable(int width, int height, const unsigned int *table, bool isVertical)
+{
+    return Texture(width, height, isVertical, table);
+}
+
+/**
+ * @brief Computes the shades of colors, see Texture::getShade.
+ *
+ * @param colors The colors, followed by room for their shades.
+ * @param count The number of colors.
+ * @param fogLevels The number of fog levels.
+ */
+static void shadeColors(std::vector<unsigned int> &colors, int count, int fogLevels)
+{
+    for (int level = 0; level <= fogLevels; level++)
+    {
+        unsigned int *fogged = &colors[Texture::getShade(level, false) * count];
+        unsigned int *sideShaded = &colors[Texture::getShade(level, true) * count];
+        for (int i = 0; i < count; i++)
+        {
+            unsigned int color = colors[i];
+            if (level > 0)
+            {
+                // each channel scaled by the brightness of the level
+                unsigned int brightness = fogLevels + 1 - level;
+                unsigned int r = ((color >> 16) & 0xFF) * brightness / (fogLevels + 1);
+                unsigned int g = ((color >> 8) & 0xFF) * brightness / (fogLevels + 1);
+                unsigned int b = (color & 0xFF) * brightness / (fogLevels + 1);
+                color = (r << 16) | (g << 8) | b;
+                fogged[i] = color;
+            }
+            sideShaded[i] = (color >> 1) & 8355711; // half brightness
+        }
+    }
+}
+
+void Texture::generateFogLevels(int levels)
+{
+    fogLevels = levels > 0 ? levels : 0;
+    generateShades();
+}
+
+void Texture::setFormat(TextureFormat format)
+{
+    int size = width * height;
+    indices.clear();
+    palettes.clear();
+    this->format = TextureFormat::DIRECT;
+    if (format == TextureFormat::INDEXED)
+    {
+        // the colors numbered in the order of their first pixel
+        std::unordered_map<unsigned int, int> colorIndices;
+        for (int i = 0; i < size && int(colorIndices.size()) <= PALETTE_SIZE; i++)
+            colorIndices.insert({pixels[i], int(colorIndices.size())});
+        if (int(colorIndices.size()) <= PALETTE_SIZE)
+        {
+            palettes.resize(PALETTE_SIZE);
+            for (const std::pair<const unsigned int, int> &color : colorIndices)
+                palettes[color.second] = color.first;
+            indices.resize(size);
+            for (int i = 0; i < size; i++)
+                indices[i] = (unsigned char)colorIndices[pixels[i]];
+            this->format = TextureFormat::INDEXED;
+        }
+    }
+    generateShades();
+}
+
+void Texture::generateShades()
+{
+    int size = width * height;
+    // the table has the texture and its side shade, the only shades without fog
+    if (table && (format == TextureFormat::INDEXED || fogLevels == 0))
+    {
+        pixels = table;
+        storage.reset();
+    }
+    // only the texture itself is kept in the indexed format, its shades being in the palettes
+    else if (format == TextureFormat::INDEXED)
+        setStorage(std::vector<unsigned int>(pixels, pixels + size));
+    else
+    {
+        std::vector<unsigned int> shades(size * 2 * (fogLevels + 1));
+        std::copy(pixels, pixels + size, shades.begin());
+        shadeColors(shades, size, fogLevels);
+        setStorage(std::move(shades));
+    }
+    if (format == TextureFormat::INDEXED)
+    {
+        palettes.resize(PALETTE_SIZE * 2 * (fogLevels + 1));
+        shadeColors(palettes, PALETTE_SIZE, fogLevels);
+    }
+}
+
+void Texture::setStorage(std::vector<unsigned int> &&pixels)
+{
+    storage = std::make_shared<const std::vector<unsigned int>>(std::move(pixels));
+    this->pixels = storage->data();
+}
+
+unsigned int Texture::get(int x, int y) const
+{
+    return get(x, y, 0);
+}
+
+unsigned int Texture::get(int x, int y, int shade) const
+{
+    x &= width - 1;
+    y &= height - 1;
+    int index = isVertical ? y + x * height : x + y * width;
+    if (format == TextureFormat::INDEXED)
+        return palettes[shade * PALETTE_SIZE + indices[index]];
+    return pixels[shade * width * height + index];
+}
+
+int Texture::getWidth() const { return width; }
+int Texture::getHeight() const { return height; }
+bool Texture::isStoredVertically() const { return isVertical; }
+const unsigned int *Texture::getPixels(int shade) const { return pixels + shade * width * height; }
+TextureFormat Texture::getFormat() const { return format; }
+const unsigned char *Texture::getIndices() const { return indices.data(); }
+const unsigned int *Texture::getPalette(int shade) const { return &palettes[shade * PALETTE_SIZE]; }
+int Texture::getFogLevels() const { return fogLevels; }
+int Texture::getShade(int fogLevel, bool sideShade) { return fogLevel * 2 + (sideShade ? 1 : 0); }
+
+long Texture::getBytes() const
+{
+    int shades = getShade(fogLevels, true) + 1;
+    if (format == TextureFormat::INDEXED)
+        return long(width) * height + long(shades) * PALETTE_SIZE * sizeof(unsigned int);
+    return long(shades) * width * height * sizeof(unsigned int);
+}
@@ -0,0 +1,134 @@
+#include <ThreadPool.h>
+#include <pthread.h>
+
+ThreadPool::ThreadPool(int nbThreads, bool pinThreads)
+    : generation(0),
+      activeWorkers(0),
+      stopping(false),
+      body(nullptr),
+      count(0),
+      chunkSize(1),
+      nextIteration(0),
+      busyTime(nbThreads > 0 ? nbThreads : 1),
+      utilizationStart(std::chrono::steady_clock::now())
+{
+    for (std::atomic<long long> &time : busyTime)
+        time = 0;
+
+    int cores = std::thread::hardware_concurrency();
+    for (int i = 1; i < int(busyTime.size()); i++)
+    {
+        workers.push_back(std::thread(&ThreadPool::workerThreadFunction, this, i));
+        if (pinThreads && cores > 0)
+        {
+            // The calling thread is left free to move, the threads of the pool take the other cores first
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            CPU_SET(i % cores, &cpus);
+            pthread_setaffinity_np(workers.back().native_handle(), sizeof(cpus), &cpus);
+        }
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    loopStarted.notify_all();
+    for (std::thread &worker : workers)
+        worker.join();
+}
+
+void ThreadPool::parallelFor(int count, int chunkSize, const std::function<void(int, int)> &body)
+{
+    if (count <= 0)
+        return;
+
+    // Without other threads, or with a single chunk, waking the pool up costs more than it saves
+    if (workers.empty() || count <= chunkSize)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        body(0, count);
+        busyTime[0] += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->body = &body;
+        this->count = count;
+        this->chunkSize = chunkSize > 0 ? chunkSize : 1;
+        nextIteration = 0;
+        activeWorkers = workers.size();
+        generation++;
+    }
+    loopStarted.notify_all();
+
+    runChunks(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    loopEnded.wait(lock, [this]
+                   { return activeWorkers == 0; });
+}
+
+int ThreadPool::getThreadCount() const { return busyTime.size(); }
+
+std::vector<double> ThreadPool::getUtilization()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - utilizationStart).count();
+    utilizationStart = now;
+
+    std::vector<double> utilization(busyTime.size());
+    for (size_t i = 0; i < busyTime.size(); i++)
+        utilization[i] = elapsed > 0 ? busyTime[i].exchange(0) / elapsed : 0;
+    return utilization;
+}
+
+int ThreadPool::defaultThreadCount(const std::vector<std::string> &peerIps)
+{
+    int cores = std::thread::hardware_concurrency();
+    if (cores <= 0)
+        cores = 1;
+
+    // The players on the loopback interface run on this machine and render with their own threads
+    int localInstances = 1;
+    for (const std::string &ip : peerIps)
+        if (ip.compare(0, 4, "127.") == 0 || ip == "localhost")
+            localInstances++;
+
+    return cores / localInstances > 1 ? cores / localInstances : 1;
+}
+
+void ThreadPool::workerThreadFunction(int index)
+{
+    long seenGeneration = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            loopStarted.wait(lock, [this, seenGeneration]
+                             { return stopping || generation != seenGeneration; });
+            if (stopping)
+                return;
+            seenGeneration = generation;
+        }
+
+        runChunks(index);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--activeWorkers == 0)
+            loopEnded.notify_one();
+    }
+}
+
+void ThreadPool::runChunks(int index)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int begin;
+    while ((begin = nextIteration.fetch_add(chunkSize)) < count)
+        (*body)(begin, begin + chunkSize < count ? begin + chunkSize : count);
+    busyTime[index] += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
@@ -0,0 +1,121 @@
+#include <stdexcept>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <poll.h>
+
+#include <UDPReceiver.h>
+
+UDPReceiver::UDPReceiver(int port) : stillRunning(false), nextPlayerIdx(0), numPlayers(0)
+{
+    sockfd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sockfd < 0)
+        throw std::runtime_error("Failed to create socket");
+
+    struct timeval timeout;
+    timeout.tv_sec = 0;
+    timeout.tv_usec = 100000;
+
+    setsockopt(sockfd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = INADDR_ANY;
+
+    if (bind(sockfd, (sockaddr *)&addr, sizeof(addr)) < 0)
+        throw std::runtime_error("Failed to bind socket");
+}
+
+UDPReceiver::~UDPReceiver()
+{
+    stopThread();
+    close(sockfd);
+}
+
+void UDPReceiver::startThread(int nbPlayers)
+{
+    // If the thread is already running, or there is nobody to receive from, we don't start it
+    if (stillRunning || nbPlayers <= 0)
+        return;
+
+    numPlayers = nbPlayers;
+
+    // The snapshot must exist before the thread publishes to it
+    positions.reset(new RemotePositions(nbPlayers));
+
+    stillRunning = true;
+    thread = std::thread(&UDPReceiver::receiverThread, this);
+}
+
+void UDPReceiver::stopThread()
+{
+    if (!stillRunning)
+        return;
+
+    stillRunning = false;
+    if (thread.joinable())
+        thread.join();
+}
+
+void UDPReceiver::receiverThread()
+{
+    pollfd fd;
+    fd.fd = sockfd;
+    fd.events = POLLIN;
+
+    while (stillRunning)
+    {
+        // The receive calls do not wait, so the thread sleeps in poll, waking up regularly to check whether to stop
+        if (poll(&fd, 1, 100) <= 0)
+            continue;
+
+        for (UDPData data = receive(); data.valid; data = receive())
+        {
+            // If the player is not in the map, we add it
+            if (playerIdx.find(data.sender) == playerIdx.end())
+            {
+                playerIdx[data.sender] = nextPlayerIdx++;
+                nextPlayerIdx %= numPlayers;
+            }
+
+            // We publish the new position, the map itself is only modified by the rendering thread
+            positions->publish(playerIdx[data.sender], data.position.x(), data.position.y());
+        }
+    }
+}
+
+void UDPReceiver::updatePlayers(Map &map)
+{
+    if (!positions)
+        return;
+
+    // A single snapshot is read per frame so that all the sprites are drawn from consistent positions
+    const std::vector<Vector<double>> &snapshot = positions->acquire();
+    for (size_t i = 0; i < snapshot.size(); i++)
+        map.movePlayer(i, snapshot[i].x(), snapshot[i].y());
+}
+
+UDPData UDPReceiver::receive()
+{
+    socklen_t len = sizeof(addr);
+    int read = recvfrom(sockfd, buffer, bufferSize, MSG_DONTWAIT, (sockaddr *)&addr, &len);
+
+    if (read != bufferSize)
+        return {false, "", {0, 0}};
+
+    return {
+        true,
+        std::string(inet_ntoa(addr.sin_addr)) + std::to_string(addr.sin_port),
+        {buffer[0], buffer[1]}};
+}
+
+int UDPReceiver::receive(double *values, int maxValues, std::string &senderIp)
+{
+    socklen_t len = sizeof(addr);
+    int read = recvfrom(sockfd, values, maxValues * sizeof(double), MSG_DONTWAIT, (sockaddr *)&addr, &len);
+
+    if (read < 0 || read % sizeof(double) != 0)
+        return -1;
+
+    senderIp = inet_ntoa(addr.sin_addr);
+    return read / sizeof(double);
+}
@@ -28,4 +28,9 @@ void UDPSender::send(double x, double y)
     buffer[1] = y;
 
     sendto(sockfd, buffer, bufferSize, MSG_CONFIRM, (sockaddr *)&addr, sizeof(addr));
+}
+
+void UDPSender::send(const double *values, int nbValues)
+{
+    sendto(sockfd, values, nbValues * sizeof(double), MSG_CONFIRM, (sockaddr *)&addr, sizeof(addr));
 }
\ No newline at end of file
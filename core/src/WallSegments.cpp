@@ -0,0 +1,185 @@
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include <WallSegments.h>
+
+// The depth at which the segments crossing the camera plane are clipped, before their ends are projected.
+static const double NEAR_DEPTH = 1e-6;
+
+WallSegments::WallSegments(const Map &map)
+{
+    addFaces(map, 0);
+    addFaces(map, 1);
+}
+
+void WallSegments::addFaces(const Map &map, int side)
+{
+    const std::vector<int> &tiles = map.getTiles();
+    int width = map.getWidth();
+    int lines = side == 0 ? map.getWidth() : map.getHeight();
+    int length = side == 0 ? map.getHeight() : map.getWidth();
+    // whether the cell at a coordinate across the lines and a coordinate along them is a wall
+    auto isWall = [&](int across, int along)
+    { return side == 0 ? tiles[across + along * width] > 0 : tiles[along + across * width] > 0; };
+
+    for (int line = 1; line < lines; line++)
+        for (int wallOffset = -1; wallOffset <= 0; wallOffset++)
+        {
+            // the faces between the walls on one side of the line and the empty cells on the other side
+            int wallCell = line + wallOffset;
+            int emptyCell = line - 1 - wallOffset;
+            int begin = -1;
+            for (int along = 0; along <= length; along++)
+            {
+                bool face = along < length && isWall(wallCell, along) && !isWall(emptyCell, along);
+                if (face && begin < 0)
+                    begin = along;
+                else if (!face && begin >= 0)
+                {
+                    segments.push_back({side, line, begin, along, wallOffset});
+                    begin = -1;
+                }
+            }
+        }
+}
+
+void WallSegments::project(const RayFan &fan)
+{
+    projections.clear();
+    double invDet = 1.0 / (fan.camX * fan.dirY - fan.dirX * fan.camY);
+
+    for (int i = 0; i < int(segments.size()); i++)
+    {
+        const Segment &segment = segments[i];
+        // the faces are seen from the empty cells only, which include their line on the side of the larger coordinates
+        double position = segment.side == 0 ? fan.posX : fan.posY;
+        if (segment.wallOffset == 0 ? !(position < segment.line) : !(position >= segment.line))
+            continue;
+
+        // a player standing on the line sees the face at a distance of 0 in any column whose ray goes toward it
+        Projection projection;
+        projection.segment = i;
+        if (position == segment.line)
+        {
+            projection.minDepth = 0;
+            projection.xBegin = 0;
+            projection.xEnd = fan.screenWidth;
+            projections.push_back(projection);
+            continue;
+        }
+
+        // the ends of the segment relative to the player, in camera space as the sprites
+        double ends[2][2];
+        for (int end = 0; end < 2; end++)
+        {
+            double along = end == 0 ? segment.begin : segment.end;
+            double relativeX = (segment.side == 0 ? segment.line : along) - fan.posX;
+            double relativeY = (segment.side == 0 ? along : segment.line) - fan.posY;
+            ends[end][0] = invDet * (fan.dirY * relativeX - fan.dirX * relativeY);
+            ends[end][1] = invDet * (-fan.camY * relativeX + fan.camX * relativeY);
+        }
+        if (ends[0][1] <= NEAR_DEPTH && ends[1][1] <= NEAR_DEPTH)
+            continue;
+        // the part behind the camera plane is clipped
+        for (int end = 0; end < 2; end++)
+            if (ends[end][1] < NEAR_DEPTH)
+            {
+                const double *other = ends[1 - end];
+                double t = (NEAR_DEPTH - ends[end][1]) / (other[1] - ends[end][1]);
+                ends[end][0] += t * (other[0] - ends[end][0]);
+                ends[end][1] = NEAR_DEPTH;
+            }
+
+        // the camera x-coordinates of the ends, clamped so that those close to the camera plane stay in range
+        double cameraA = std::max(-2.0, std::min(2.0, ends[0][0] / ends[0][1]));
+        double cameraB = std::max(-2.0, std::min(2.0, ends[1][0] / ends[1][1]));
+        double left = std::min(cameraA, cameraB), right = std::max(cameraA, cameraB);
+        if (right < -1 || left > 1)
+            continue;
+
+        // one more column on each side, the rays deciding which columns the segment covers
+        projection.minDepth = std::min(ends[0][1], ends[1][1]);
+        projection.xBegin = std::max(0, int(std::floor((left + 1) * fan.screenWidth / 2)) - 1);
+        projection.xEnd = std::min(fan.screenWidth, int(std::ceil((right + 1) * fan.screenWidth / 2)) + 2);
+        projections.push_back(projection);
+    }
+
+    std::sort(projections.begin(), projections.end(), [](const Projection &a, const Projection &b)
+              { return a.minDepth < b.minDepth; });
+}
+
+int WallSegments::traceColumns(const RayFan &fan, int xBegin, int xEnd, RayHit *hits) const
+{
+    const double infinity = std::numeric_limits<double>::infinity();
+    for (int x = xBegin; x < xEnd; x++)
+        hits[x - xBegin].perpWallDist = infinity;
+    // the depth of the farthest face found in the range, the segments beyond it being hidden
+    double farthest = infinity;
+
+    for (const Projection &projection : projections)
+    {
+        if (projection.minDepth > farthest)
+            break;
+        int begin = std::max(projection.xBegin, xBegin);
+        int end = std::min(projection.xEnd, xEnd);
+        const Segment &segment = segments[projection.segment];
+        bool found = false;
+
+        for (int x = begin; x < end; x++)
+        {
+            RayHit &hit = hits[x - xBegin];
+            // the column already sees a face in front of the whole segment
+            if (hit.perpWallDist < projection.minDepth)
+                continue;
+            double cameraX = 2 * x / double(fan.screenWidth) - 1;
+            double rayX = fan.dirX + fan.camX * cameraX;
+            double rayY = fan.dirY + fan.camY * cameraX;
+            double rayAcross = segment.side == 0 ? rayX : rayY;
+            double rayAlong = segment.side == 0 ? rayY : rayX;
+            if (segment.wallOffset == 0 ? !(rayAcross > 0) : !(rayAcross < 0))
+                continue;
+
+            // the distance from the camera plane at which the ray crosses the line, as (mapX - posX + (1 - stepX) / 2)
+            // / rayDirX in the DDA
+            double perpWallDist = std::abs(segment.line - (segment.side == 0 ? fan.posX : fan.posY)) / std::abs(rayAcross);
+            // at equal distances, the ray went through the corner of two faces: the DDA steps in y first on ties
+            if (perpWallDist > hit.perpWallDist || (perpWallDist == hit.perpWallDist && !(segment.side == 1 && hit.side == 0)))
+                continue;
+            double along = (segment.side == 0 ? fan.posY : fan.posX) + perpWallDist * rayAlong;
+
+            // a ray through a corner of the grid crosses the line in y first, as the DDA on ties: it enters the cell
+            // before the corner when going down in y, and stays in the cell before it when going up in x (unless it
+            // starts at the corner). The ray may thus miss a segment it touches at an end.
+            int cell = int(std::floor(along));
+            if (cell == along && (segment.side == 0 ? rayAlong < 0 : rayAlong > 0 && perpWallDist > 0))
+                cell--;
+            if (cell < segment.begin || cell >= segment.end)
+                continue;
+            hit.rayX = rayX;
+            hit.rayY = rayY;
+            hit.mapX = segment.side == 0 ? segment.line + segment.wallOffset : cell;
+            hit.mapY = segment.side == 0 ? cell : segment.line + segment.wallOffset;
+            hit.side = segment.side;
+            hit.perpWallDist = perpWallDist;
+            found = true;
+        }
+
+        if (found)
+        {
+            farthest = 0;
+            for (int x = xBegin; x < xEnd; x++)
+                farthest = std::max(farthest, hits[x - xBegin].perpWallDist);
+        }
+    }
+
+    int missed = 0;
+    for (int x = xBegin; x < xEnd; x++)
+        if (hits[x - xBegin].perpWallDist == infinity)
+            missed++;
+    return missed;
+}
+
+int WallSegments::getSegmentCount() const { return int(segments.size()); }
+
+int WallSegments::getVisibleCount() const { return int(projections.size()); }
@@ -0,0 +1,219 @@
+#include <WindowManager.h>
+#include <stdexcept>
+#include <cstring>
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <poll.h>
+
+WindowManager::WindowManager(int width, int height) : pipeline(nullptr), presentRate(0), width(width), height(height), keysPressed(0), running(false)
+{
+    if (!(display = XOpenDisplay(NULL)))
+        throw std::runtime_error("Cannot connect to X server");
+
+    imgBuffer = (int *)malloc(width * height * sizeof(int));
+    memset(imgBuffer, 0, width * height * sizeof(int));
+
+    screen = DefaultScreen(display);
+
+    unsigned long black = BlackPixel(display, screen);
+
+    window = XCreateSimpleWindow(display,
+                                 RootWindow(display, screen),
+                                 0, 0,
+                                 width, height,
+                                 0,
+                                 black,
+                                 black);
+
+    XSelectInput(display, window, StructureNotifyMask | KeyPressMask | KeyReleaseMask | ExposureMask);
+    XMapWindow(display, window);
+    gc = XCreateGC(display, window, 0, NULL);
+
+    for (;;)
+    {
+        XEvent e;
+        XNextEvent(display, &e);
+        if (e.type == MapNotify)
+            break;
+    }
+
+    Visual *visual = DefaultVisual(display, screen);
+    img = XCreateImage(display,
+                       visual,
+                       DefaultDepth(display, screen),
+                       ZPixmap,
+                       0,
+                       (char *)imgBuffer,
+                       width, height,
+                       32,
+                       0);
+    if (!img)
+        throw std::runtime_error("Cannot create image");
+}
+
+WindowManager::~WindowManager()
+{
+    stopWindowThread();
+    XDestroyImage(img);
+    XFreeGC(display, gc);
+    XDestroyWindow(display, window);
+    XCloseDisplay(display);
+}
+
+void WindowManager::startWindowThread(FramePipeline &pipeline, double presentRate)
+{
+    // If the thread is not running, we start it
+    if (!running)
+    {
+        this->pipeline = &pipeline;
+        this->presentRate = presentRate;
+        running = true;
+        windowThread = std::thread(&WindowManager::windowThreadFunction, this);
+    }
+}
+
+void WindowManager::stopWindowThread()
+{   
+    // If the thread is not running, we don't need to stop it
+    if (running)
+    {
+        running = false;
+        // Wake the thread up if it is waiting for a frame or an event
+        pipeline->wakePresenter();
+
+        // If the thread is joinable, we join it
+        if (windowThread.joinable())
+        {
+            windowThread.join();
+        }
+    }
+}
+
+void WindowManager::windowThreadFunction()
+{
+    typedef std::chrono::steady_clock Clock;
+    Clock::duration interval = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(presentRate > 0 ? 1.0 / presentRate : 0.0));
+    Clock::time_point nextPresent = Clock::now();
+
+    pollfd fds[2];
+    fds[0].fd = ConnectionNumber(display);
+    fds[0].events = POLLIN;
+    fds[1].fd = pipeline->getFrameReadyFd();
+    fds[1].events = POLLIN;
+
+    Frame frame;
+    bool hasFrame = false;
+    while (running)
+    {
+        // Handle the events already received, and flush the requests before sleeping
+        updateInput();
+
+        if (!hasFrame)
+            hasFrame = pipeline->acquireFrame(frame);
+
+        int timeout = -1;
+        if (hasFrame)
+        {
+            Clock::time_point now = Clock::now();
+            if (now >= nextPresent)
+            {
+                updateDisplay(frame.pixels);
+                std::chrono::duration<double> elapsed = Clock::now() - now;
+                pipeline->releaseFrame(frame, elapsed.count());
+                hasFrame = false;
+
+                // Present on the next instant of the grid, skipping the instants missed
+                if (interval.count() > 0)
+                {
+                    nextPresent += interval;
+                    if (nextPresent <= now)
+                        nextPresent += interval * ((now - nextPresent) / interval + 1);
+                }
+                continue;
+            }
+            std::chrono::duration<double, std::milli> remaining = nextPresent - now;
+            timeout = int(std::ceil(remaining.count()));
+        }
+
+        // Sleep until an X event arrives, a frame is ready or the next frame is due
+        if (poll(fds, 2, timeout) > 0 && (fds[1].revents & POLLIN))
+            pipeline->clearFrameReady();
+    }
+}
+
+unsigned int WindowManager::getKeysPressed() { return keysPressed; }
+
+void WindowManager::updateDisplay(const DoubleBuffer &doubleBuffer)
+{
+    // The image keeps the last frame presented, so only the columns changed are copied and uploaded
+    for (const ColumnRange &columns : doubleBuffer.getChangedColumns())
+    {
+        if (columns.begin == 0 && columns.end == width)
+            doubleBuffer.upscaleBackBuffer(imgBuffer);
+        else
+            doubleBuffer.upscaleBackBuffer(imgBuffer, columns);
+        XPutImage(display, window, gc, img, columns.begin, 0, columns.begin, 0, columns.end - columns.begin, height);
+    }
+}
+
+void WindowManager::updateDisplay(const std::vector<int> &pixels)
+{
+    std::copy(pixels.begin(), pixels.end(), imgBuffer);
+
+    XPutImage(display, window, gc, img, 0, 0, 0, 0, width, height);
+    XFlush(display);
+}
+
+void WindowManager::updateInput()
+{
+    XEvent e;
+    while (XPending(display))
+    {
+        XNextEvent(display, &e);
+        switch (e.type)
+        {
+        case KeyPress:
+            keysPressed |= convertKey(XLookupKeysym(&e.xkey, 0));
+            break;
+        case KeyRelease:
+            keysPressed &= ~convertKey(XLookupKeysym(&e.xkey, 0));
+            break;
+        case Expose:
+            // The frames are only presented when they change, so the parts of the window uncovered are repainted
+            XPutImage(display, window, gc, img, e.xexpose.x, e.xexpose.y, e.xexpose.x, e.xexpose.y, e.xexpose.width,
+                      e.xexpose.height);
+            break;
+        }
+    }
+}
+
+void WindowManager::waitForInput(double timeout)
+{
+    XFlush(display);
+    if (XPending(display))
+        return;
+    pollfd fd;
+    fd.fd = ConnectionNumber(display);
+    fd.events = POLLIN;
+    poll(&fd, 1, int(std::ceil(timeout * 1000)));
+}
+
+unsigned int WindowManager::convertKey(KeySym key)
+{
+    switch (key)
+    {
+    case XK_Up:
+        return KEY_UP;
+    case XK_Down:
+        return KEY_DOWN;
+    case XK_Left:
+        return KEY_LEFT;
+    case XK_Right:
+        return KEY_RIGHT;
+    case XK_Escape:
+        return KEY_ESC;
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,447 @@
+#include <cmath>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <functional>
+#include <stdexcept>
+
+#include <Average.h>
+#include <Player.h>
+#include <Map.h>
+#include <WindowManager.h>
+#include <Raycaster.h>
+#include <UDPReceiver.h>
+#include <UDPSender.h>
+#include <RelayClient.h>
+#include <SendScheduler.h>
+#include <DoubleBuffer.h>
+#include <FrameGovernor.h>
+#include <FramePipeline.h>
+#include <Executor.h>
+#include <Strategies.h>
+#include <util.h>
+
+// The longest the main loop waits for input when nothing moved, instead of rendering the same frame again. The
+// positions received from the other players wait as long.
+const double IDLE_WAIT = 1.0 / 60;
+
+struct ProgramArguments
+{
+    int screenWidth;
+    int screenHeight;
+    std::string ipsPath;
+    double targetFps;
+    bool halfResolutionFloor;
+    ThreadingStrategy threading;
+    int nbThreads;
+    DisplayStrategy display;
+    int maxFramesInFlight;
+    ReceiveStrategy receive;
+    SendStrategy send;
+    double sendRate;
+    Traversal traversal;
+    WallEngine wallEngine;
+    int fogLevels;
+    double fogDistance;
+    TextureFormat textureFormat;
+    Reprojection reprojection;
+};
+
+void printUsage(const char *program)
+{
+    std::cerr << "Usage: " << program << " <screenWidth> <screenHeight> <ipsPath> [targetFps] [halfResolutionFloor] [options]" << std::endl;
+    std::cerr << "  screenWidth: The width of the screen." << std::endl;
+    std::cerr << "  screenHeight: The height of the screen." << std::endl;
+    std::cerr << "  ipsPath: The path to the file containing the IP addresses and ports of the players." << std::endl;
+    std::cerr << "  targetFps: The frame rate to keep, by pacing the frames and lowering the resolution down to 50% when" << std::endl;
+    std::cerr << "             they take too long. If 0 (default), the frames are neither paced nor scaled." << std::endl;
+    std::cerr << "  halfResolutionFloor: 1 to cast one floor and ceiling pixel out of four and interpolate the others (default 0)." << std::endl;
+    std::cerr << "Options, choosing how the work is spread over threads and computed:" << std::endl;
+    std::cerr << "  --threading none|openmp|pool: How the passes of the renderer are parallelized (default none)." << std::endl;
+    std::cerr << "  --threads n: The number of threads of the renderer (default: the cores, shared with the players on this machine)." << std::endl;
+    std::cerr << "  --display sync|threaded: Whether the main thread renders and presents the frames, or a render thread and a" << std::endl;
+    std::cerr << "             window thread do (default sync). With threaded, targetFps paces the presentation only." << std::endl;
+    std::cerr << "  --frames n: The maximum number of rendered frames waiting for presentation with a threaded display (default 2)." << std::endl;
+    std::cerr << "  --receive inline|thread: Whether the main thread or a receiver thread reads the positions (default inline)." << std::endl;
+    std::cerr << "  --send inline|thread: Whether the main thread sends the position every frame, or a scheduler thread sends" << std::endl;
+    std::cerr << "             it at a fixed rate (default inline)." << std::endl;
+    std::cerr << "  --send-rate r: The number of positions sent per second to each player by the scheduler thread, positive (default 60)." << std::endl;
+    std::cerr << "  --traversal scalar|adaptive: How the wall rays are cast, one by one, or every few columns, filling the" << std::endl;
+    std::cerr << "             runs of columns on the same wall (default scalar). The hits are the same." << std::endl;
+    std::cerr << "  --walls raycast|segments: How the walls are found, by casting a ray per column or by projecting the" << std::endl;
+    std::cerr << "             faces of the walls, faster on large open maps (default raycast)." << std::endl;
+    std::cerr << "  --fog-levels n: The number of fog levels generated for the textures, 0 for no fog (default 0)." << std::endl;
+    std::cerr << "  --fog-distance d: The distance at which the last fog level is reached (default 16)." << std::endl;
+    std::cerr << "  --textures direct|indexed: Whether the texels are 32-bit colors, or 8-bit indices in a palette per shade," << std::endl;
+    std::cerr << "             a quarter of the memory (default direct)." << std::endl;
+    std::cerr << "  --reprojection none|rotation: Whether the walls of the last frame are reused when the player only turns," << std::endl;
+    std::cerr << "             casting only the columns newly in view or at the edges of the walls (default none). The frames are" << std::endl;
+    std::cerr << "             the same." << std::endl;
+    std::cerr << "Example: " << program << " 1920 1080 ips.txt 60 1 --threading pool --display threaded" << std::endl;
+    exit(1);
+}
+
+ProgramArguments parseArgs(int argc, char *argv[])
+{
+    ProgramArguments args;
+    args.targetFps = 0;
+    args.halfResolutionFloor = false;
+    args.threading = ThreadingStrategy::NONE;
+    args.nbThreads = 0;
+    args.display = DisplayStrategy::SYNC;
+    args.maxFramesInFlight = 2;
+    args.receive = ReceiveStrategy::INLINE;
+    args.send = SendStrategy::INLINE;
+    args.sendRate = 60.0;
+    args.traversal = Traversal::SCALAR;
+    args.wallEngine = WallEngine::RAYCAST;
+    args.fogLevels = 0;
+    args.fogDistance = 16.0;
+    args.textureFormat = TextureFormat::DIRECT;
+    args.reprojection = Reprojection::NONE;
+
+    std::vector<std::string> positional;
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg.compare(0, 2, "--") != 0)
+            {
+                positional.push_back(arg);
+                continue;
+            }
+            if (i + 1 >= argc)
+                printUsage(argv[0]);
+            std::string value = argv[++i];
+            if (arg == "--threading")
+                args.threading = parseThreading(value);
+            else if (arg == "--threads")
+                args.nbThreads = std::stoi(value);
+            else if (arg == "--display")
+                args.display = parseDisplay(value);
+            else if (arg == "--frames")
+                args.maxFramesInFlight = std::stoi(value);
+            else if (arg == "--receive")
+                args.receive = parseReceive(value);
+            else if (arg == "--send")
+                args.send = parseSend(value);
+            else if (arg == "--send-rate")
+                args.sendRate = std::stod(value);
+            else if (arg == "--traversal")
+                args.traversal = parseTraversal(value);
+            else if (arg == "--walls")
+                args.wallEngine = parseWallEngine(value);
+            else if (arg == "--fog-levels")
+                args.fogLevels = std::stoi(value);
+            else if (arg == "--fog-distance")
+                args.fogDistance = std::stod(value);
+            else if (arg == "--textures")
+                args.textureFormat = parseTextureFormat(value);
+            else if (arg == "--reprojection")
+                args.reprojection = parseReprojection(value);
+            else
+                throw std::invalid_argument("Unknown option: " + arg);
+        }
+
+        if (positional.size() < 3 || positional.size() > 5)
+            printUsage(argv[0]);
+        args.screenWidth = std::stoi(positional[0]);
+        args.screenHeight = std::stoi(positional[1]);
+        args.ipsPath = positional[2];
+        args.targetFps = positional.size() >= 4 ? std::stod(positional[3]) : 0;
+        args.halfResolutionFloor = positional.size() >= 5 && std::stoi(positional[4]) != 0;
+
+        // The rates are turned into intervals between frames and between sends
+        if (!(args.targetFps >= 0) || std::isinf(args.targetFps))
+            throw std::invalid_argument("targetFps must be positive, or 0 for no pacing");
+        if (!(args.sendRate > 0) || std::isinf(args.sendRate))
+            throw std::invalid_argument("The send rate must be positive");
+    }
+    catch (const std::logic_error &e)
+    {
+        std::cerr << e.what() << std::endl;
+        printUsage(argv[0]);
+    }
+    return args;
+}
+
+int main(int argc, char *argv[])
+{
+    ProgramArguments args = parseArgs(argc, argv);
+    const int screenWidth = args.screenWidth;
+    const int screenHeight = args.screenHeight;
+
+    std::vector<std::unique_ptr<UDPSender>> udpSenders;
+    NetworkData data = parseIPs(args.ipsPath);
+    UDPReceiver udpReceiver(data.listeningPort);
+    for (auto ipPort : data.ipPorts)
+        udpSenders.push_back(std::unique_ptr<UDPSender>(new UDPSender(ipPort.first, ipPort.second)));
+    size_t nbPlayers = data.relay ? data.relayPlayers : udpSenders.size();
+
+    // With a relay, the position is only sent to the relay, which sends back the positions of all the players
+    std::unique_ptr<RelayClient> relayClient;
+    if (data.relay)
+        relayClient.reset(new RelayClient(udpReceiver, *udpSenders[0], data.listeningPort, nbPlayers));
+    if (relayClient && args.receive == ReceiveStrategy::THREAD)
+        throw std::runtime_error("The snapshots of a relay cannot be received by a receiver thread");
+
+    // Indexes used to identify other players
+    int nextPlayerIndex = 0;
+    std::map<std::string, int> playersIndexes; // Maps IP addresses and ports to player indexes
+
+    Map map = Map::generateMap(nbPlayers);
+    // The palettes and the shades are generated before the map is copied for the render thread
+    map.setTextureFormat(args.textureFormat);
+    map.setFogLevels(args.fogLevels);
+    std::cout << "Textures: " << 2 * (args.fogLevels + 1) << " shades, " << map.getTextureBytes() / 1024 << " KiB"
+              << (args.textureFormat == TextureFormat::INDEXED ? " indexed" : "") << std::endl;
+    Player player({22, 11.5}, {-1, 0}, {0, 0.66}, 5, 3, map);
+
+    // The renderer threads are shared with the other players running on this machine
+    std::vector<std::string> peerIps;
+    for (auto ipPort : data.ipPorts)
+        peerIps.push_back(ipPort.first);
+    int nbThreads = args.nbThreads > 0 ? args.nbThreads : ThreadPool::defaultThreadCount(peerIps);
+    // Pinning only helps when the threads have the cores to themselves
+    Executor executor(args.threading, nbThreads, nbThreads == int(std::thread::hardware_concurrency()));
+
+    WindowManager windowManager(screenWidth, screenHeight);
+
+    // The frames are rendered either here by the main thread, or by the render thread of the pipeline
+    std::unique_ptr<DoubleBuffer> doubleBuffer;
+    std::unique_ptr<Raycaster> raycaster;
+    std::unique_ptr<FramePipeline> pipeline;
+    if (args.display == DisplayStrategy::THREADED)
+    {
+        pipeline.reset(new FramePipeline(map, player, nbPlayers, screenWidth, screenHeight, args.maxFramesInFlight));
+        pipeline->getRaycaster().setExecutor(&executor);
+        pipeline->getRaycaster().setHalfResolutionFloor(args.halfResolutionFloor);
+        pipeline->getRaycaster().setTraversal(args.traversal);
+        pipeline->getRaycaster().setWallEngine(args.wallEngine);
+        pipeline->getRaycaster().setReprojection(args.reprojection);
+        pipeline->getRaycaster().setFogDistance(args.fogLevels > 0 ? args.fogDistance : 0);
+    }
+    else
+    {
+        doubleBuffer.reset(new DoubleBuffer(screenWidth, screenHeight));
+        raycaster.reset(new Raycaster(player, *doubleBuffer, map));
+        raycaster->setExecutor(&executor);
+        raycaster->setHalfResolutionFloor(args.halfResolutionFloor);
+        raycaster->setTraversal(args.traversal);
+        raycaster->setWallEngine(args.wallEngine);
+        raycaster->setReprojection(args.reprojection);
+        raycaster->setFogDistance(args.fogLevels > 0 ? args.fogDistance : 0);
+    }
+
+    // Sends the position to the relay, or to every player
+    std::function<void(double, double)> sendPosition = [&](double x, double y)
+    {
+        if (relayClient)
+            relayClient->send(x, y);
+        else
+            for (auto &udpSender : udpSenders)
+                udpSender->send(x, y);
+    };
+
+    // With a scheduler, a single thread sends the position at most sendRate times per second, and at least once per
+    // second so that the players which joined late still see us
+    std::unique_ptr<SendScheduler> sendScheduler;
+    if (args.send == SendStrategy::THREAD)
+    {
+        sendScheduler.reset(new SendScheduler(sendPosition, args.sendRate, 1.0));
+        sendScheduler->notifyPositionChanged(player.posX(), player.posY());
+        sendScheduler->startThread();
+    }
+
+    if (args.receive == ReceiveStrategy::THREAD)
+        udpReceiver.startThread(nbPlayers);
+
+    // The frame time must not jump with changes of the wall clock, so a monotonic clock is used
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point time = Clock::now(), oldTime;
+
+    Average fpsCounter(1.0);
+    std::cout << std::fixed << std::setprecision(2);
+    std::vector<double> utilization = executor.getUtilization();
+    Clock::time_point utilizationTime = time;
+
+    // The resolution is only adapted when the main thread renders; the pipeline paces the presentation instead
+    std::unique_ptr<FrameGovernor> governor;
+    Clock::duration frameBudget;
+    if (args.targetFps > 0 && !pipeline)
+    {
+        governor.reset(new FrameGovernor(1.0 / args.targetFps));
+        frameBudget = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / args.targetFps));
+    }
+    Clock::time_point frameStart = Clock::now();
+
+    if (pipeline)
+    {
+        // Start the render and window threads: the main thread runs the simulation stage of the pipeline
+        pipeline->start();
+        windowManager.startWindowThread(*pipeline, args.targetFps);
+    }
+
+    while (true)
+    {
+        // Only the changes since the last frame are drawn and presented, if any
+        bool frameDrawn = false;
+        if (!pipeline)
+        {
+            if (governor)
+            {
+                // Adapt the resolution to the time spent on the last frame, then wait for the end of its budget
+                std::chrono::duration<double> workTime = Clock::now() - frameStart;
+                doubleBuffer->setScale(governor->update(workTime.count()));
+                std::this_thread::sleep_until(frameStart + frameBudget);
+                frameStart = Clock::now();
+            }
+
+            frameDrawn = raycaster->renderChanges();
+            if (frameDrawn)
+                doubleBuffer->swap();
+        }
+
+        oldTime = time;
+        time = Clock::now();
+        std::chrono::duration<double> elapsed = time - oldTime;
+        double frameTime = elapsed.count();
+
+        fpsCounter.update(1.0 / frameTime);
+        std::cout << "\r" << std::to_string(int(fpsCounter.get())) << " FPS";
+        if (pipeline)
+        {
+            PipelineStats stats = pipeline->getStats();
+            std::cout << " | simulate " << stats.simulate * 1000 << " ms"
+                      << " | render " << stats.render * 1000 << " ms"
+                      << " | present " << stats.present * 1000 << " ms"
+                      << " | latency " << stats.latency * 1000 << " ms"
+                      << " (" << pipeline->getMaxFramesInFlight() << " in flight)";
+        }
+        else
+        {
+            // Pixel writes per pixel of the frame: 1 means no pixel is drawn twice, apart from the sprites
+            double overdraw = double(doubleBuffer->getPixelWrites()) / (doubleBuffer->getWidth() * doubleBuffer->getHeight());
+            std::cout << " | overdraw " << std::to_string(overdraw).substr(0, 4) << "x";
+            std::cout << " | walls " << raycaster->getRaysPerSecond() / 1e6 << " Mrays/s, "
+                      << raycaster->getDdaSteps() << " DDA steps";
+            if (args.reprojection != Reprojection::NONE)
+                std::cout << " (" << int(raycaster->getReprojectedFraction() * 100 + 0.5) << "% reprojected)";
+            std::cout << " | redrawn " << int(raycaster->getRedrawnFraction() * 100 + 0.5) << "%";
+            if (governor)
+                std::cout << " | scale " << int(doubleBuffer->getScale() * 100 + 0.5) << "%";
+        }
+
+        // Utilization of each thread of the pool, over the last second
+        if (time - utilizationTime > std::chrono::seconds(1))
+        {
+            utilization = executor.getUtilization();
+            utilizationTime = time;
+        }
+        if (!utilization.empty())
+        {
+            std::cout << " | threads";
+            for (double threadUtilization : utilization)
+                std::cout << " " << int(threadUtilization * 100) << "%";
+        }
+        std::cout << "  " << std::flush;
+
+        // With a threaded display, the window thread presents the frames and handles the input
+        if (!pipeline)
+        {
+            if (frameDrawn)
+                windowManager.updateDisplay(*doubleBuffer);
+            windowManager.updateInput();
+        }
+
+        bool playerMoved = false;
+        unsigned int keys = windowManager.getKeysPressed();
+        if (keys & WindowManager::KEY_UP)
+        {
+            player.move(frameTime);
+            playerMoved = true;
+        }
+        if (keys & WindowManager::KEY_DOWN)
+        {
+            player.move(-frameTime);
+            playerMoved = true;
+        }
+        if (keys & WindowManager::KEY_RIGHT)
+        {
+            player.turn(-frameTime);
+            playerMoved = true;
+        }
+        if (keys & WindowManager::KEY_LEFT)
+        {
+            player.turn(frameTime);
+            playerMoved = true;
+        }
+        if (keys & WindowManager::KEY_ESC)
+            break;
+
+        // Send the position, or record it for the scheduler, which sends it at its next tick
+        if (sendScheduler)
+        {
+            if (playerMoved)
+                sendScheduler->notifyPositionChanged(player.posX(), player.posY());
+        }
+        else
+            sendPosition(player.posX(), player.posY());
+
+        // Move the other players to the latest positions received
+        unsigned long spriteVersion = map.getSpriteVersion();
+        if (args.receive == ReceiveStrategy::THREAD)
+            udpReceiver.updatePlayers(map);
+        else if (relayClient)
+            relayClient->receive(map);
+        else
+        {
+            for (size_t i = 0; i < nbPlayers; i++)
+            {
+                UDPData data = udpReceiver.receive();
+                if (!data.valid)
+                    break;
+                // Update the player's index if it is the first time we receive data from them
+                if (playersIndexes.find(data.sender) == playersIndexes.end())
+                {
+                    playersIndexes[data.sender] = nextPlayerIndex++;
+                    nextPlayerIndex %= nbPlayers;
+                }
+                int index = playersIndexes[data.sender];
+                map.movePlayer(index, data.position.x(), data.position.y());
+            }
+        }
+
+        if (pipeline)
+        {
+            elapsed = Clock::now() - time;
+            pipeline->recordSimulate(elapsed.count());
+
+            // Hand the frame to the render thread, waiting while it renders the previous one
+            if (!pipeline->submit(player, map, time))
+                break;
+        }
+
+        // Nothing moved, so the next frame would be the same: wait for the input instead of spinning. The window
+        // thread reads the input with a threaded display, and the governor already waits for the end of each budget.
+        if (!governor && !playerMoved && map.getSpriteVersion() == spriteVersion)
+        {
+            if (pipeline)
+                std::this_thread::sleep_for(std::chrono::duration<double>(IDLE_WAIT));
+            else
+                windowManager.waitForInput(IDLE_WAIT);
+        }
+    }
+
+    if (pipeline)
+    {
+        windowManager.stopWindowThread();
+        pipeline->stop();
+    }
+
+    return 0;
+}
@@ -10,6 +10,8 @@ unsigned int rgb(int r, int g, int b)
 NetworkData parseIPs(std::string path)
 {
     NetworkData data;
+    data.relay = false;
+    data.relayPlayers = 0;
     std::ifstream f(path);
     if (!f.is_open())
         throw std::runtime_error("Failed to open file");
@@ -22,6 +24,18 @@ NetworkData parseIPs(std::string path)
     {
         std::getline(f, tmp, ' ');
         std::string ip = tmp;
+
+        // A relay replaces the list of players: relay <ip> <port> <nbPlayers>
+        if (ip == "relay")
+        {
+            data.relay = true;
+            std::getline(f, ip, ' ');
+            std::getline(f, tmp, ' ');
+            data.ipPorts.push_back({ip, std::stoi(tmp)});
+            std::getline(f, tmp);
+            data.relayPlayers = std::stoi(tmp);
+            continue;
+        }
      
         std::getline(f, tmp);
         int port = std::stoi(tmp);
@@ -0,0 +1,73 @@
+/**
+ * Stress test of RemotePositions, built with ThreadSanitizer by make test: a writer thread publishes a known sequence
+ * of positions while a reader thread acquires snapshots, and checks that each one is a state the writer published,
+ * never older than the one before it.
+ */
+
+#include <cstdio>
+#include <thread>
+
+#include <RemotePositions.h>
+
+static int const PLAYERS = 7;
+static int const PUBLISHES = 2000000;
+
+/**
+ * @brief Checks that a snapshot is the state after some publish: the writer moves player k % PLAYERS to (k, -k) in
+ * its k-th publish, so the latest publish seen gives the position expected of every player.
+ *
+ * @return The number of the latest publish seen, or -1 if the snapshot is torn.
+ */
+static long checkSnapshot(const std::vector<Vector<double>> &positions)
+{
+    long latest = 0;
+    for (const Vector<double> &position : positions)
+        if (position.x() > latest)
+            latest = long(position.x());
+    for (int i = 0; i < PLAYERS; i++)
+    {
+        // the last publish up to latest that moved player i, none if it is 0
+        long expected = latest - ((latest - i) % PLAYERS + PLAYERS) % PLAYERS;
+        if (expected <= 0)
+        {
+            if (positions[i].x() != -1 || positions[i].y() != -1)
+                return -1;
+        }
+        else if (positions[i].x() != expected || positions[i].y() != -expected)
+            return -1;
+    }
+    return latest;
+}
+
+int main()
+{
+    RemotePositions remotePositions(PLAYERS);
+
+    std::thread writer([&remotePositions]()
+                       {
+                           for (long k = 1; k <= PUBLISHES; k++)
+                               remotePositions.publish(k % PLAYERS, k, -k);
+                       });
+
+    long snapshots = 0, torn = 0, backwards = 0, previous = 0;
+    while (previous < PUBLISHES)
+    {
+        const std::vector<Vector<double>> &positions = remotePositions.acquire();
+        long latest = checkSnapshot(positions);
+        // the snapshot must not change until the next acquire
+        if (latest < 0 || checkSnapshot(positions) != latest)
+            torn++;
+        else if (latest < previous)
+            backwards++;
+        else
+            previous = latest;
+        snapshots++;
+        if (torn > 0)
+            break;
+    }
+    writer.join();
+
+    std::printf("%ld snapshots of %d publishes: %ld torn, %ld older than the previous one\n", snapshots, PUBLISHES,
+                torn, backwards);
+    return torn == 0 && backwards == 0 ? 0 : 1;
+}
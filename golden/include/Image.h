@@ -0,0 +1,62 @@
+#ifndef IMAGE_H
+#define IMAGE_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief A frame rendered headlessly, in the 0xRRGGBB format of the DoubleBuffer.
+ */
+struct Image
+{
+    int width;               // The width of the image.
+    int height;              // The height of the image.
+    std::vector<int> pixels; // The pixels of the image, row by row.
+
+    /**
+     * @brief Hashes the pixels of the image with FNV-1a.
+     *
+     * @return The 64-bit hash of the pixels.
+     */
+    uint64_t hash() const;
+
+    /**
+     * @brief Writes the image as a binary PPM file.
+     *
+     * @param path The path of the file.
+     * @throws std::runtime_error If the file cannot be written.
+     */
+    void writePPM(const std::string &path) const;
+
+    /**
+     * @brief Reads an image written by writePPM.
+     *
+     * @param path The path of the file.
+     * @return The image read.
+     * @throws std::runtime_error If the file cannot be read or is not a binary PPM file.
+     */
+    static Image readPPM(const std::string &path);
+};
+
+/**
+ * @brief The differences between an image and its reference.
+ */
+struct ImageDiff
+{
+    int maxDifference; // The largest difference of a color channel between the two images.
+    long differing;    // The number of pixels with a channel differing by more than the tolerance.
+};
+
+/**
+ * @brief Compares an image to its reference, channel by channel.
+ *
+ * @param image The image to check.
+ * @param reference The reference image, of the same size.
+ * @param tolerance The largest difference of a color channel accepted for a pixel.
+ * @return The differences between the images.
+ * @throws std::runtime_error If the images do not have the same size.
+ */
+ImageDiff compareImages(const Image &image, const Image &reference, int tolerance);
+
+#endif
@@ -0,0 +1,92 @@
+#include <Image.h>
+
+#include <fstream>
+#include <stdexcept>
+#include <cstdlib>
+
+uint64_t Image::hash() const
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (int pixel : pixels)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            hash ^= (pixel >> (8 * i)) & 0xFF;
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+void Image::writePPM(const std::string &path) const
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+        throw std::runtime_error("Cannot write " + path);
+
+    file << "P6\n" << width << " " << height << "\n255\n";
+    std::vector<char> row(3 * width);
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int pixel = pixels[y * width + x];
+            row[3 * x] = char((pixel >> 16) & 0xFF);
+            row[3 * x + 1] = char((pixel >> 8) & 0xFF);
+            row[3 * x + 2] = char(pixel & 0xFF);
+        }
+        file.write(row.data(), row.size());
+    }
+    if (!file)
+        throw std::runtime_error("Cannot write " + path);
+}
+
+Image Image::readPPM(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        throw std::runtime_error("Cannot read " + path);
+
+    std::string magic;
+    int maxValue;
+    Image image;
+    file >> magic >> image.width >> image.height >> maxValue;
+    if (!file || magic != "P6" || maxValue != 255 || image.width <= 0 || image.height <= 0)
+        throw std::runtime_error(path + " is not a binary PPM file");
+    file.get(); // The single whitespace before the pixels
+
+    image.pixels.resize(image.width * image.height);
+    std::vector<unsigned char> row(3 * image.width);
+    for (int y = 0; y < image.height; y++)
+    {
+        file.read(reinterpret_cast<char *>(row.data()), row.size());
+        for (int x = 0; x < image.width; x++)
+            image.pixels[y * image.width + x] = (row[3 * x] << 16) | (row[3 * x + 1] << 8) | row[3 * x + 2];
+    }
+    if (!file)
+        throw std::runtime_error(path + " is truncated");
+    return image;
+}
+
+ImageDiff compareImages(const Image &image, const Image &reference, int tolerance)
+{
+    if (image.width != reference.width || image.height != reference.height)
+        throw std::runtime_error("The images do not have the same size");
+
+    ImageDiff diff = {0, 0};
+    for (size_t i = 0; i < image.pixels.size(); i++)
+    {
+        int pixelDifference = 0;
+        for (int shift = 0; shift < 24; shift += 8)
+        {
+            int difference = std::abs(((image.pixels[i] >> shift) & 0xFF) - ((reference.pixels[i] >> shift) & 0xFF));
+            if (difference > pixelDifference)
+                pixelDifference = difference;
+        }
+        if (pixelDifference > diff.maxDifference)
+            diff.maxDifference = pixelDifference;
+        if (pixelDifference > tolerance)
+            diff.differing++;
+    }
+    return diff;
+}
@@ -0,0 +1,382 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <chrono>
+#include <poll.h>
+
+#include <Player.h>
+#include <Map.h>
+#include <DoubleBuffer.h>
+#include <Raycaster.h>
+#include <Strategies.h>
+#include <Executor.h>
+#include <FramePipeline.h>
+
+#include <Image.h>
+
+/**
+ * @brief A camera pose of the suite, and the positions of the other players at that time.
+ */
+struct Pose
+{
+    std::string name;       // The name of the pose, used in the hashes file and for the images.
+    double x, y;            // The position of the player.
+    double angle;           // The angle (degrees) from the starting direction (-1, 0) of the game.
+    double player0X, player0Y; // The position of the first other player.
+    double player1X, player1Y; // The position of the second other player.
+};
+
+// Each pose stresses a different part of the renderer: clipped walls, long corridors, overlapping sprites, the other
+// players, positions and directions aligned on the grid.
+const std::vector<Pose> POSES = {
+    {"start", 22.0, 11.5, 0.0, 20.5, 11.2, 18.0, 12.0},
+    {"corridor", 20.5, 1.5, -90.0, 20.5, 8.5, 20.5, 16.5},
+    {"wall", 22.8, 11.5, 180.0, -1.0, -1.0, -1.0, -1.0},
+    {"pillars", 21.5, 13.5, 33.7, 19.5, 11.5, 21.5, 10.5},
+    {"barrels", 19.0, 2.0, 9.5, 17.0, 1.5, 15.8, 2.5},
+    {"diagonal", 9.5, 9.5, 135.0, 11.5, 9.2, 9.5, 14.5},
+    {"aligned", 12.0, 12.0, 180.0, 12.5, 14.5, -1.0, -1.0},
+    {"close-sprite", 20.5, 11.6, 90.0, 20.5, 11.2, 20.0, 10.5},
+};
+
+// The sizes of the frames, the second one not a multiple of the chunks of the parallel loops
+const std::vector<std::pair<int, int>> SIZES = {{320, 240}, {317, 203}};
+
+// The angle (degrees) of the frame drawn before each pose with the rotation reprojection
+const double REPROJECTION_TURN = 2.5;
+
+// The number of frames of a sequence, and the distance moved by the other players between two frames of a sprite
+// sequence
+const int SEQUENCE_FRAMES = 4;
+const double SEQUENCE_SPRITE_STEP = 0.3;
+
+/**
+ * @brief The frames drawn before each pose, as the game loop draws them, only redrawing what changed.
+ */
+enum class Sequence
+{
+    NONE,  // The pose is drawn alone.
+    TURN,  // The player turns to the pose, the other players do not move.
+    SPRITE // The other players walk to their positions of the pose, the player does not move.
+};
+
+Sequence parseSequence(const std::string &name)
+{
+    if (name == "none")
+        return Sequence::NONE;
+    if (name == "turn")
+        return Sequence::TURN;
+    if (name == "sprite")
+        return Sequence::SPRITE;
+    throw std::invalid_argument("Unknown sequence " + name);
+}
+
+struct ProgramArguments
+{
+    std::string command;
+    std::string directory;
+    std::vector<std::pair<int, int>> sizes;
+    int tolerance;
+    ThreadingStrategy threading;
+    int nbThreads;
+    DisplayStrategy display;
+    Traversal traversal;
+    WallEngine wallEngine;
+    TextureFormat textureFormat;
+    Reprojection reprojection;
+    Sequence sequence;
+};
+
+void printUsage(const char *program)
+{
+    std::cerr << "Usage: " << program << " <check|update|compare> <directory> [options]" << std::endl;
+    std::cerr << "  check: Renders the poses and compares them to the references of the directory." << std::endl;
+    std::cerr << "  update: Renders the poses and writes them as the references of the directory." << std::endl;
+    std::cerr << "  compare: Renders the poses with the options and with the default strategies, and compares them. The" << std::endl;
+    std::cerr << "           failing frames are written to the directory." << std::endl;
+    std::cerr << "  directory: The directory of the references: hashes.txt, and an image per pose and size." << std::endl;
+    std::cerr << "Options:" << std::endl;
+    std::cerr << "  --size <w>x<h>: The size of the frames compared, instead of the sizes of the references (compare only)." << std::endl;
+    std::cerr << "  --tolerance <n>: If 0 (default), the hashes of the frames must match. Otherwise, the frames are" << std::endl;
+    std::cerr << "                   compared to the images, and each color channel may differ by up to this value." << std::endl;
+    std::cerr << "  --threading <none|openmp|pool>: The threading strategy of the renderer (default none)." << std::endl;
+    std::cerr << "  --threads <n>: The number of threads of the renderer (default 1)." << std::endl;
+    std::cerr << "  --display <sync|threaded>: Whether the frames are rendered here or by a FramePipeline (default sync)." << std::endl;
+    std::cerr << "  --traversal <scalar|adaptive>: How the rays of the walls are cast (default scalar)." << std::endl;
+    std::cerr << "  --walls <raycast|segments>: How the walls are found (default raycast)." << std::endl;
+    std::cerr << "  --textures <direct|indexed>: How the texels are stored (default direct)." << std::endl;
+    std::cerr << "  --reprojection <none|rotation>: Whether the walls of the last frame are reused. With rotation, the" << std::endl;
+    std::cerr << "                   pose turned a little is drawn first, without a threaded display (default none)." << std::endl;
+    std::cerr << "  --sequence <none|turn|sprite>: The frames drawn before each pose, without a threaded display, as the" << std::endl;
+    std::cerr << "                   game loop draws them: the player turning to the pose, or the other players walking" << std::endl;
+    std::cerr << "                   to their positions (default none)." << std::endl;
+    std::cerr << "Example: " << program << " check reference --threading pool --threads 4" << std::endl;
+}
+
+ProgramArguments parseArgs(int argc, char *argv[])
+{
+    if (argc < 3 || (std::string(argv[1]) != "check" && std::string(argv[1]) != "update" && std::string(argv[1]) != "compare"))
+    {
+        printUsage(argv[0]);
+        exit(1);
+    }
+
+    ProgramArguments args;
+    args.command = argv[1];
+    args.directory = argv[2];
+    args.tolerance = 0;
+    args.threading = ThreadingStrategy::NONE;
+    args.nbThreads = 1;
+    args.display = DisplayStrategy::SYNC;
+    args.traversal = Traversal::SCALAR;
+    args.wallEngine = WallEngine::RAYCAST;
+    args.textureFormat = TextureFormat::DIRECT;
+    args.reprojection = Reprojection::NONE;
+    args.sequence = Sequence::NONE;
+
+    try
+    {
+        for (int i = 3; i < argc; i += 2)
+        {
+            std::string option = argv[i];
+            if (i + 1 >= argc)
+                throw std::invalid_argument("Missing value for " + option);
+            std::string value = argv[i + 1];
+
+            if (option == "--size")
+            {
+                size_t separator = value.find('x');
+                if (separator == std::string::npos)
+                    throw std::invalid_argument("Invalid size " + value);
+                args.sizes.push_back({std::stoi(value.substr(0, separator)), std::stoi(value.substr(separator + 1))});
+            }
+            else if (option == "--tolerance")
+                args.tolerance = std::stoi(value);
+            else if (option == "--threading")
+                args.threading = parseThreading(value);
+            else if (option == "--threads")
+                args.nbThreads = std::stoi(value);
+            else if (option == "--display")
+                args.display = parseDisplay(value);
+            else if (option == "--traversal")
+                args.traversal = parseTraversal(value);
+            else if (option == "--walls")
+                args.wallEngine = parseWallEngine(value);
+            else if (option == "--textures")
+                args.textureFormat = parseTextureFormat(value);
+            else if (option == "--reprojection")
+                args.reprojection = parseReprojection(value);
+            else if (option == "--sequence")
+                args.sequence = parseSequence(value);
+            else
+                throw std::invalid_argument("Unknown option " + option);
+        }
+    }
+    catch (const std::logic_error &e)
+    {
+        std::cerr << e.what() << std::endl;
+        printUsage(argv[0]);
+        exit(1);
+    }
+    if (args.sizes.empty())
+        args.sizes = SIZES;
+    return args;
+}
+
+/**
+ * @brief Renders a pose, either here or through a FramePipeline as the game does with the threaded display.
+ */
+Image render(const Pose &pose, int width, int height, Executor &executor, const ProgramArguments &args)
+{
+    Map map = Map::generateMap(2);
+    map.movePlayer(0, pose.player0X, pose.player0Y);
+    map.movePlayer(1, pose.player1X, pose.player1Y);
+    map.setTextureFormat(args.textureFormat);
+
+    double angle = pose.angle * M_PI / 180.0;
+    double c = std::cos(angle), s = std::sin(angle);
+    Player player({pose.x, pose.y}, {-c, -s}, {0.66 * s, -0.66 * c}, 5.0, 3.0, map);
+
+    Image image;
+    image.width = width;
+    image.height = height;
+
+    if (args.display == DisplayStrategy::THREADED)
+    {
+        FramePipeline pipeline(map, player, 2, width, height, 1);
+        pipeline.getRaycaster().setExecutor(&executor);
+        pipeline.getRaycaster().setTraversal(args.traversal);
+        pipeline.getRaycaster().setWallEngine(args.wallEngine);
+        pipeline.start();
+        pipeline.submit(player, map, std::chrono::steady_clock::now());
+
+        // Waits for the frame as the window thread does
+        Frame frame;
+        pollfd fd;
+        fd.fd = pipeline.getFrameReadyFd();
+        fd.events = POLLIN;
+        while (!pipeline.acquireFrame(frame))
+        {
+            poll(&fd, 1, 100);
+            pipeline.clearFrameReady();
+        }
+        image.pixels = frame.pixels;
+        pipeline.releaseFrame(frame, 0.0);
+        pipeline.stop();
+        return image;
+    }
+
+    DoubleBuffer doubleBuffer(width, height);
+    Raycaster raycaster(player, doubleBuffer, map);
+    raycaster.setExecutor(&executor);
+    raycaster.setTraversal(args.traversal);
+    raycaster.setWallEngine(args.wallEngine);
+    raycaster.setReprojection(args.reprojection);
+    if (args.sequence != Sequence::NONE)
+    {
+        // The frames are drawn and swapped as the game loop does, the last one at the pose
+        for (int k = SEQUENCE_FRAMES - 1; k >= 0; k--)
+        {
+            if (args.sequence == Sequence::TURN)
+            {
+                double turned = angle + k * REPROJECTION_TURN * M_PI / 180.0;
+                double tc = std::cos(turned), ts = std::sin(turned);
+                player.setPose({pose.x, pose.y}, {-tc, -ts}, {0.66 * ts, -0.66 * tc});
+            }
+            else
+            {
+                map.movePlayer(0, pose.player0X + k * SEQUENCE_SPRITE_STEP, pose.player0Y);
+                map.movePlayer(1, pose.player1X, pose.player1Y - k * SEQUENCE_SPRITE_STEP);
+            }
+            if (raycaster.renderChanges())
+                doubleBuffer.swap();
+        }
+        image.pixels = doubleBuffer.getBackBuffer();
+        return image;
+    }
+    if (args.reprojection == Reprojection::ROTATION)
+    {
+        // The pose turned a little is drawn first, so that the walls of the pose are reprojected from it
+        double turned = angle + REPROJECTION_TURN * M_PI / 180.0;
+        double tc = std::cos(turned), ts = std::sin(turned);
+        player.setPose({pose.x, pose.y}, {-tc, -ts}, {0.66 * ts, -0.66 * tc});
+        raycaster.render();
+        player.setPose({pose.x, pose.y}, {-c, -s}, {0.66 * s, -0.66 * c});
+    }
+    raycaster.render();
+    doubleBuffer.swap();
+    image.pixels = doubleBuffer.getBackBuffer();
+    return image;
+}
+
+std::string imageName(const Pose &pose, int width, int height)
+{
+    return pose.name + "-" + std::to_string(width) + "x" + std::to_string(height);
+}
+
+std::map<std::string, std::string> readHashes(const std::string &path)
+{
+    std::ifstream file(path);
+    if (!file)
+        throw std::runtime_error("Cannot read " + path);
+
+    std::map<std::string, std::string> hashes;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+        std::istringstream stream(line);
+        std::string name, hash;
+        stream >> name >> hash;
+        hashes[name] = hash;
+    }
+    return hashes;
+}
+
+std::string formatHash(uint64_t hash)
+{
+    std::ostringstream stream;
+    stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return stream.str();
+}
+
+int main(int argc, char *argv[])
+{
+    ProgramArguments args = parseArgs(argc, argv);
+    Executor executor(args.threading, args.nbThreads, false);
+    const std::string hashesPath = args.directory + "/hashes.txt";
+
+    if (args.command == "update")
+    {
+        std::ofstream hashes(hashesPath);
+        if (!hashes)
+            throw std::runtime_error("Cannot write " + hashesPath);
+        hashes << "# Hashes of the golden frames, see golden/Makefile" << std::endl;
+        for (const Pose &pose : POSES)
+        {
+            for (const std::pair<int, int> &size : SIZES)
+            {
+                Image image = render(pose, size.first, size.second, executor, args);
+                std::string name = imageName(pose, size.first, size.second);
+                image.writePPM(args.directory + "/" + name + ".ppm");
+                hashes << name << " " << formatHash(image.hash()) << std::endl;
+            }
+        }
+        return 0;
+    }
+
+    // The compared frames are rendered with the default strategies, the way the references are
+    ProgramArguments reference = parseArgs(3, argv);
+    Executor referenceExecutor(reference.threading, reference.nbThreads, false);
+    const bool compare = args.command == "compare";
+
+    std::map<std::string, std::string> hashes;
+    if (!compare && args.tolerance == 0)
+        hashes = readHashes(hashesPath);
+
+    int failures = 0;
+    for (const Pose &pose : POSES)
+    {
+        for (const std::pair<int, int> &size : args.sizes)
+        {
+            Image image = render(pose, size.first, size.second, executor, args);
+            std::string name = imageName(pose, size.first, size.second);
+            bool passed;
+
+            std::cout << std::left << std::setw(28) << name;
+            if (!compare && args.tolerance == 0)
+            {
+                std::string hash = formatHash(image.hash());
+                passed = hashes.count(name) && hashes[name] == hash;
+                std::cout << hash << (passed ? " ok" : " FAILED (expected " + (hashes.count(name) ? hashes[name] : std::string("none")) + ")");
+            }
+            else
+            {
+                Image expected = compare ? render(pose, size.first, size.second, referenceExecutor, reference)
+                                         : Image::readPPM(args.directory + "/" + name + ".ppm");
+                ImageDiff diff = compareImages(image, expected, args.tolerance);
+                passed = diff.differing == 0;
+                std::cout << "max difference " << diff.maxDifference << ", " << diff.differing << " pixels over tolerance"
+                          << (passed ? " ok" : " FAILED");
+            }
+            std::cout << std::endl;
+
+            // The failing frame is kept next to the references, to be inspected or diffed
+            if (!passed)
+            {
+                image.writePPM(args.directory + "/" + name + ".failed.ppm");
+                failures++;
+            }
+        }
+    }
+
+    std::cout << failures << " of " << POSES.size() * args.sizes.size() << " frames differ" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,78 @@
+#ifndef INTERESTGRID_H
+#define INTERESTGRID_H
+
+#include <vector>
+#include <cstdint>
+
+#include <Map.h>
+
+/**
+ * @brief The InterestGrid class tells whether two players are relevant to each other, i.e. whether one could see the other.
+ *
+ * The visibility between two free cells of the map is computed by tracing lines of sight between sample points of the
+ * two cells. The cells seen from a cell are computed the first time a player stands in it, and stored as a bitset.
+ * Two players are relevant to each other if their cells see each other, or if they are close enough to turn around a
+ * corner and meet before the next update.
+ */
+class InterestGrid
+{
+public:
+    // The maximum number of cells of the map, for which the bitsets of all the cells take 32 MiB
+    static const int MAX_CELLS = 128 * 128;
+
+    /**
+     * @brief Constructs an InterestGrid object for a map.
+     *
+     * @param map The map of the game.
+     * @param nearDistance The distance under which two players are always relevant to each other.
+     * @throws std::invalid_argument If the map has more than MAX_CELLS cells.
+     */
+    InterestGrid(const Map &map, double nearDistance);
+
+    /**
+     * @brief Checks whether two players are relevant to each other.
+     *
+     * @param x1 The x-coordinate of the first player.
+     * @param y1 The y-coordinate of the first player.
+     * @param x2 The x-coordinate of the second player.
+     * @param y2 The y-coordinate of the second player.
+     * @return True if the players could see each other, false otherwise.
+     */
+    bool relevant(double x1, double y1, double x2, double y2) const;
+
+private:
+    const Map &map;                                   // The map of the game.
+    int width, height;                                // The width and height of the map.
+    double nearDistance;                              // The distance under which two players are always relevant to each other.
+    mutable std::vector<std::vector<uint64_t>> seen;  // The bitset of the cells seen from each cell, empty until computed.
+
+    /**
+     * @brief Returns the bitset of the cells seen from a cell, computing it on the first call.
+     *
+     * @param a The index of the cell.
+     * @return The bitset, where cell b is bit b % 64 of word b / 64.
+     */
+    const std::vector<uint64_t> &seenFrom(int a) const;
+
+    /**
+     * @brief Checks whether the segment between two points crosses no wall.
+     *
+     * @param x1 The x-coordinate of the first point.
+     * @param y1 The y-coordinate of the first point.
+     * @param x2 The x-coordinate of the second point.
+     * @param y2 The y-coordinate of the second point.
+     * @return True if no wall is crossed, false otherwise.
+     */
+    bool lineOfSight(double x1, double y1, double x2, double y2) const;
+
+    /**
+     * @brief Checks whether any point of a cell sees any point of another cell, using a few sample points per cell.
+     *
+     * @param a The index of the first cell.
+     * @param b The index of the second cell.
+     * @return True if the cells see each other, false otherwise.
+     */
+    bool cellsSeeEachOther(int a, int b) const;
+};
+
+#endif
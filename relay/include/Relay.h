@@ -0,0 +1,95 @@
+#ifndef RELAY_H
+#define RELAY_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <UDPReceiver.h>
+#include <UDPSender.h>
+#include <Snapshot.h>
+#include <Map.h>
+#include <InterestGrid.h>
+
+/**
+ * @brief The statistics of a relay run.
+ */
+struct RelayStats
+{
+    double elapsed;   // The duration (s) of the run.
+    int clients;      // The number of clients seen.
+    long packetsIn;   // The number of positions received from the clients.
+    long packetsOut;  // The number of snapshots sent to the clients.
+    long bytesOut;    // The number of bytes sent to the clients.
+};
+
+/**
+ * @brief The Relay class gathers the positions of all the players and sends them back in one snapshot per tick.
+ *
+ * Each client sends its position to the relay only, so its upload does not depend on the number of players, and
+ * receives a single datagram per tick instead of one per player. The relay learns the clients from their packets.
+ *
+ * With interest management, a client only receives every tick the positions of the players it could see, the
+ * others being sent at a lower rate.
+ */
+class Relay
+{
+public:
+    /**
+     * @brief Constructs a Relay object.
+     *
+     * @param port The port on which the relay listens.
+     * @param tickRate The number of snapshots sent per second to each client.
+     * @param distantRate If not zero, enables interest management: the positions of the players that cannot see each
+     * other are only sent this many times per second.
+     */
+    Relay(int port, double tickRate, double distantRate);
+
+    /**
+     * @brief Runs the relay.
+     *
+     * @param duration The duration (s) of the run. If zero, the relay runs forever and prints its statistics every second.
+     * @return The statistics of the run.
+     */
+    RelayStats run(double duration);
+
+private:
+    /**
+     * @brief A client of the relay.
+     */
+    struct Client
+    {
+        int id;                            // The identifier of the client, sent in the snapshots.
+        std::unique_ptr<UDPSender> sender; // The sender to the listening port of the client.
+        double x, y;                       // The last position of the client.
+    };
+
+    UDPReceiver receiver;                 // The receiver of the positions.
+    double tickRate;                      // The number of snapshots sent per second to each client.
+    std::map<std::string, Client> clients; // Maps IP addresses and listening ports to clients.
+    std::vector<double> buffer;           // The buffer in which the packets are received and the snapshots encoded.
+    RelayStats stats;                     // The statistics of the run.
+    long tick;                            // The number of ticks since the start of the run.
+
+    Map map;                               // The map of the game, used to know which players can see each other.
+    std::unique_ptr<InterestGrid> interest; // The visibility between the cells of the map, if interest management is enabled.
+    int distantInterval;                   // The number of ticks between two updates of a player that cannot be seen.
+
+    /**
+     * @brief Receives all the pending positions.
+     */
+    void receive();
+
+    /**
+     * @brief Sends the snapshot of all the positions to every client.
+     */
+    void broadcast();
+
+    /**
+     * @brief Sends to every client a snapshot of the positions of the players relevant to it.
+     */
+    void broadcastRelevant();
+};
+
+#endif
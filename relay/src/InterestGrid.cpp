@@ -0,0 +1,104 @@
+#include <cmath>
+#include <stdexcept>
+
+#include <InterestGrid.h>
+
+InterestGrid::InterestGrid(const Map &map, double nearDistance)
+    : map(map),
+      width(map.getWidth()),
+      height(map.getHeight()),
+      nearDistance(nearDistance)
+{
+    if (width * height > MAX_CELLS)
+        throw std::invalid_argument("The map is too large for interest management");
+    seen.resize(width * height);
+}
+
+bool InterestGrid::relevant(double x1, double y1, double x2, double y2) const
+{
+    double dx = x2 - x1, dy = y2 - y1;
+    if (dx * dx + dy * dy < nearDistance * nearDistance)
+        return true;
+
+    int cellX1 = int(x1), cellY1 = int(y1), cellX2 = int(x2), cellY2 = int(y2);
+
+    // Positions outside the map (e.g. not received yet) are always sent
+    if (cellX1 < 0 || cellX1 >= width || cellY1 < 0 || cellY1 >= height ||
+        cellX2 < 0 || cellX2 >= width || cellY2 < 0 || cellY2 >= height)
+        return true;
+
+    int b = cellX2 + cellY2 * width;
+    return (seenFrom(cellX1 + cellY1 * width)[b / 64] >> (b % 64)) & 1;
+}
+
+const std::vector<uint64_t> &InterestGrid::seenFrom(int a) const
+{
+    std::vector<uint64_t> &row = seen[a];
+    if (!row.empty())
+        return row;
+
+    int cells = width * height;
+    row.assign((cells + 63) / 64, 0);
+    if (map.hasWall(a % width, a / width))
+        return row;
+    for (int b = 0; b < cells; b++)
+    {
+        if (map.hasWall(b % width, b / width))
+            continue;
+        // Visibility is symmetric, so the pairs already traced from the other cell are reused
+        bool v = seen[b].empty() ? cellsSeeEachOther(a, b) : (seen[b][a / 64] >> (a % 64)) & 1;
+        if (v)
+            row[b / 64] |= uint64_t(1) << (b % 64);
+    }
+    return row;
+}
+
+bool InterestGrid::lineOfSight(double x1, double y1, double x2, double y2) const
+{
+    // Same DDA traversal as the raycaster, stopped at the end of the segment
+    double rayX = x2 - x1, rayY = y2 - y1;
+    int mapX = int(x1), mapY = int(y1);
+    int endX = int(x2), endY = int(y2);
+
+    double deltaDistX = (rayX == 0) ? 1e30 : std::abs(1 / rayX);
+    double deltaDistY = (rayY == 0) ? 1e30 : std::abs(1 / rayY);
+    int stepX = rayX < 0 ? -1 : 1;
+    int stepY = rayY < 0 ? -1 : 1;
+    double sideDistX = (rayX < 0 ? x1 - mapX : mapX + 1.0 - x1) * deltaDistX;
+    double sideDistY = (rayY < 0 ? y1 - mapY : mapY + 1.0 - y1) * deltaDistY;
+
+    while (mapX != endX || mapY != endY)
+    {
+        if (sideDistX < sideDistY)
+        {
+            // The distances are in units of the segment length, past 1 the end of the segment was reached
+            if (sideDistX > 1)
+                break;
+            sideDistX += deltaDistX;
+            mapX += stepX;
+        }
+        else
+        {
+            if (sideDistY > 1)
+                break;
+            sideDistY += deltaDistY;
+            mapY += stepY;
+        }
+        if (map.hasWall(mapX, mapY))
+            return false;
+    }
+    return true;
+}
+
+bool InterestGrid::cellsSeeEachOther(int a, int b) const
+{
+    // The center and four points close to the corners of each cell
+    static const double samples[5][2] = {{0.5, 0.5}, {0.05, 0.05}, {0.95, 0.05}, {0.05, 0.95}, {0.95, 0.95}};
+
+    int ax = a % width, ay = a / width, bx = b % width, by = b / width;
+    for (const double *sa : samples)
+        for (const double *sb : samples)
+            if (lineOfSight(ax + sa[0], ay + sa[1], bx + sb[0], by + sb[1]))
+                return true;
+    return false;
+}
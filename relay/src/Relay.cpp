@@ -0,0 +1,145 @@
+#include <chrono>
+#include <thread>
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+#include <Relay.h>
+
+Relay::Relay(int port, double tickRate, double distantRate)
+    : receiver(port),
+      tickRate(tickRate),
+      buffer(Snapshot::MAX_VALUES),
+      stats({0.0, 0, 0, 0, 0}),
+      tick(0),
+      map(Map::generateMap(0)),
+      distantInterval(1)
+{
+    if (distantRate > 0)
+    {
+        // Players closer than 2 cells may meet around a corner before their next update
+        interest.reset(new InterestGrid(map, 2.0));
+        distantInterval = std::max(1, int(std::round(tickRate / distantRate)));
+    }
+}
+
+RelayStats Relay::run(double duration)
+{
+    std::chrono::steady_clock::duration tickInterval =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / tickRate));
+    std::chrono::time_point<std::chrono::steady_clock> start = std::chrono::steady_clock::now(), nextTick = start, nextPrint = start;
+    RelayStats printed = stats;
+
+    while (duration <= 0 || stats.elapsed < duration)
+    {
+        receive();
+        if (interest)
+            broadcastRelevant();
+        else
+            broadcast();
+        tick++;
+
+        std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now();
+        stats.elapsed = std::chrono::duration<double>(now - start).count();
+
+        if (duration <= 0 && now >= nextPrint)
+        {
+            std::cout << "\r" << stats.clients << " clients, "
+                      << stats.packetsIn - printed.packetsIn << " pkt/s in, "
+                      << stats.packetsOut - printed.packetsOut << " pkt/s out, "
+                      << (stats.bytesOut - printed.bytesOut) / 1024 << " KB/s out" << std::flush;
+            printed = stats;
+            nextPrint += std::chrono::seconds(1);
+        }
+
+        // Skip the ticks that were missed instead of sending them in a burst
+        nextTick += tickInterval;
+        if (nextTick < now)
+            nextTick = now;
+        std::this_thread::sleep_until(nextTick);
+    }
+
+    return stats;
+}
+
+void Relay::receive()
+{
+    std::string senderIp;
+    int nbValues;
+    while ((nbValues = receiver.receive(buffer.data(), buffer.size(), senderIp)) >= 0)
+    {
+        // A client sends its position and the port on which it listens
+        if (nbValues != 3)
+            continue;
+        stats.packetsIn++;
+
+        int listeningPort = int(buffer[2]);
+        std::string key = senderIp + ":" + std::to_string(listeningPort);
+
+        auto it = clients.find(key);
+        if (it == clients.end())
+        {
+            if (int(clients.size()) >= Snapshot::MAX_ENTRIES)
+                continue;
+            Client client = {int(clients.size()), std::unique_ptr<UDPSender>(new UDPSender(senderIp, listeningPort)), 0, 0};
+            it = clients.insert(std::make_pair(key, std::move(client))).first;
+            stats.clients = clients.size();
+        }
+        it->second.x = buffer[0];
+        it->second.y = buffer[1];
+    }
+}
+
+void Relay::broadcast()
+{
+    if (clients.empty())
+        return;
+
+    Snapshot snapshot;
+    snapshot.recipient = -1;
+    snapshot.tick = tick;
+    snapshot.entries.reserve(clients.size());
+    for (auto &it : clients)
+        snapshot.entries.push_back({it.second.id, it.second.x, it.second.y});
+
+    // The snapshot is the same for every client, only the recipient changes
+    int nbValues = snapshot.encode(buffer.data());
+    for (auto &it : clients)
+    {
+        buffer[0] = it.second.id;
+        it.second.sender->send(buffer.data(), nbValues);
+        stats.packetsOut++;
+        stats.bytesOut += nbValues * sizeof(double);
+    }
+}
+
+void Relay::broadcastRelevant()
+{
+    Snapshot snapshot;
+    snapshot.tick = tick;
+    snapshot.entries.reserve(clients.size());
+
+    for (auto &recipient : clients)
+    {
+        const Client &r = recipient.second;
+        snapshot.recipient = r.id;
+        snapshot.entries.clear();
+
+        for (auto &other : clients)
+        {
+            const Client &o = other.second;
+            if (o.id == r.id)
+                continue;
+
+            // The updates of the distant players are spread over the ticks so that the snapshots keep the same size
+            if (interest->relevant(r.x, r.y, o.x, o.y) || (tick + o.id) % distantInterval == 0)
+                snapshot.entries.push_back({o.id, o.x, o.y});
+        }
+
+        // A snapshot is sent even if it is empty, so that the client can still detect lost snapshots
+        int nbValues = snapshot.encode(buffer.data());
+        r.sender->send(buffer.data(), nbValues);
+        stats.packetsOut++;
+        stats.bytesOut += nbValues * sizeof(double);
+    }
+}
@@ -0,0 +1,64 @@
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+#include <Relay.h>
+
+struct ProgramArguments
+{
+    int port;
+    double tickRate;
+    double duration;
+    double distantRate;
+};
+
+void printUsage(const char *program)
+{
+    std::cerr << "Usage: " << program << " <port> [tickRate] [duration] [distantRate]" << std::endl;
+    std::cerr << "  port: The port on which the relay listens." << std::endl;
+    std::cerr << "  tickRate: The number of snapshots sent per second to each client, positive (default: 30)." << std::endl;
+    std::cerr << "  duration: The duration in seconds of the run, after which the statistics are printed (default: 0, forever)." << std::endl;
+    std::cerr << "  distantRate: If not zero, the positions of the players that cannot see each other are only sent this many times per second (default: 0)." << std::endl;
+    std::cerr << "Example: " << program << " 30000 30 0 1" << std::endl;
+    exit(1);
+}
+
+ProgramArguments parseArgs(int argc, char *argv[])
+{
+    if (argc < 2 || argc > 5)
+        printUsage(argv[0]);
+
+    ProgramArguments args;
+    try
+    {
+        args.port = std::stoi(argv[1]);
+        args.tickRate = argc > 2 ? std::stod(argv[2]) : 30.0;
+        args.duration = argc > 3 ? std::stod(argv[3]) : 0.0;
+        args.distantRate = argc > 4 ? std::stod(argv[4]) : 0.0;
+
+        // The interval between two ticks is 1 / tickRate
+        if (!(args.tickRate > 0) || std::isinf(args.tickRate))
+            throw std::invalid_argument("The tick rate must be positive");
+        if (!(args.duration >= 0) || !(args.distantRate >= 0) || std::isinf(args.distantRate))
+            throw std::invalid_argument("The duration and the distant rate must not be negative");
+    }
+    catch (const std::logic_error &e)
+    {
+        std::cerr << e.what() << std::endl;
+        printUsage(argv[0]);
+    }
+    return args;
+}
+
+int main(int argc, char *argv[])
+{
+    ProgramArguments args = parseArgs(argc, argv);
+
+    Relay relay(args.port, args.tickRate, args.distantRate);
+    RelayStats stats = relay.run(args.duration);
+
+    // The swarm launcher reads the statistics from the standard output
+    std::cout << "relay " << stats.elapsed << " " << stats.clients << " " << stats.packetsIn << " "
+              << stats.packetsOut << " " << stats.bytesOut << std::endl;
+    return 0;
+}
@@ -1 +0,0 @@
-#include <PositionSender.h>
\ No newline at end of file
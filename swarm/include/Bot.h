@@ -0,0 +1,96 @@
+#ifndef BOT_H
+#define BOT_H
+
+#include <vector>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <Player.h>
+#include <Map.h>
+#include <DoubleBuffer.h>
+#include <Raycaster.h>
+#include <UDPReceiver.h>
+#include <UDPSender.h>
+#include <RelayClient.h>
+#include <util.h>
+#include <BotStats.h>
+
+/**
+ * @brief A headless client that walks a scripted path and exchanges its position with the other players.
+ *
+ * The bot runs the same loop as the game (render, move, send, receive) with the same networking and rendering code,
+ * but renders into a DoubleBuffer that is never displayed and replaces the keyboard by a scripted path.
+ */
+class Bot
+{
+public:
+    /**
+     * @brief Constructs a Bot object.
+     *
+     * @param index The index of the bot in the swarm, which determines its starting position and its path.
+     * @param network The network data of the bot, as parsed by parseIPs.
+     * @param screenWidth The width of the frames rendered by the bot.
+     * @param screenHeight The height of the frames rendered by the bot.
+     */
+    Bot(int index, const NetworkData &network, int screenWidth, int screenHeight);
+
+    /**
+     * @brief Runs the bot and measures its network and rendering statistics.
+     *
+     * The bot sends its position during the given duration, then keeps receiving for a short time so that the packets
+     * still in flight are counted.
+     *
+     * @param duration The time (s) during which the bot sends its position.
+     * @param sendRate The number of packets sent per second to each peer. If zero, the position is sent every frame.
+     * @param frameRate The maximum number of frames rendered per second. If zero, the frame rate is not limited.
+     * @return The statistics of the run.
+     */
+    BotStats run(double duration, double sendRate, double frameRate);
+
+private:
+    int index;                                         // The index of the bot in the swarm.
+    int listeningPort;                                 // The port on which the bot listens.
+    UDPReceiver udpReceiver;                           // The receiver of the other players' positions.
+    std::vector<std::unique_ptr<UDPSender>> udpSenders; // The senders to the other players.
+    std::unique_ptr<RelayClient> relayClient;          // The client of the relay, if a relay is used.
+    size_t nbPlayers;                                  // The number of other players.
+    Map map;                                           // The map of the game.
+    Player player;                                     // The player controlled by the bot.
+    DoubleBuffer doubleBuffer;                         // The buffer in which the frames are rendered.
+    Raycaster raycaster;                               // The renderer.
+
+    int nextPlayerIndex;                       // The index given to the next new player.
+    std::map<std::string, int> playersIndexes; // Maps IP addresses and ports to player indexes.
+
+    /**
+     * @brief Moves the player along the scripted path.
+     *
+     * @param time The time (s) since the start of the run.
+     * @param frameTime The duration (s) of the last frame.
+     */
+    void walk(double time, double frameTime);
+
+    /**
+     * @brief Sends the position of the player to the other players, or to the relay.
+     */
+    void send();
+
+    /**
+     * @brief Receives the pending positions of the other players and moves their sprites.
+     *
+     * @return The number of packets received (snapshots when a relay is used).
+     */
+    int receive();
+
+    /**
+     * @brief Finds a starting position for a bot, spreading the bots over the free cells of the map.
+     *
+     * @param map The map of the game.
+     * @param index The index of the bot.
+     * @return The starting position, at the center of a free cell.
+     */
+    static Vector<double> startPosition(const Map &map, int index);
+};
+
+#endif
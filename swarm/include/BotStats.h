@@ -0,0 +1,41 @@
+#ifndef BOTSTATS_H
+#define BOTSTATS_H
+
+#include <string>
+
+/**
+ * @brief The statistics measured by a bot during a swarm run.
+ *
+ * A bot prints its statistics on a single line of its standard output, which is then parsed back by the swarm launcher.
+ */
+struct BotStats
+{
+    int port;             // The port on which the bot listened.
+    double duration;      // The time (s) during which the bot sent its position.
+    double runTime;       // The total time (s) of the run, including the time spent receiving after the last send.
+    long frames;          // The number of frames rendered while sending.
+    long sent;            // The number of packets sent to each peer (or to the relay).
+    long received;        // The number of packets received from all the peers (or snapshots received from the relay).
+    long receivedSending; // The number of those packets received while sending.
+    long lost;            // The number of snapshots lost, or -1 if unknown (without a relay).
+    double latencySum;    // The sum of the receive-to-render latencies (s) of the received packets.
+    double latencyMax;    // The maximum receive-to-render latency (s).
+    double cpuTime;       // The CPU time (s) used by the bot, user and system.
+
+    /**
+     * @brief Converts the statistics to a single line of text.
+     *
+     * @return The statistics as text.
+     */
+    std::string toString() const;
+
+    /**
+     * @brief Parses the statistics from a line produced by toString.
+     *
+     * @param line The line to parse.
+     * @return The parsed statistics.
+     */
+    static BotStats parse(const std::string &line);
+};
+
+#endif
@@ -0,0 +1,171 @@
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <sys/resource.h>
+
+#include <Bot.h>
+
+Bot::Bot(int index, const NetworkData &network, int screenWidth, int screenHeight)
+    : index(index),
+      listeningPort(network.listeningPort),
+      udpReceiver(network.listeningPort),
+      nbPlayers(network.relay ? network.relayPlayers : network.ipPorts.size()),
+      map(Map::generateMap(nbPlayers)),
+      player(startPosition(map, index), {-1, 0}, {0, 0.66}, 5, 3, map),
+      doubleBuffer(screenWidth, screenHeight),
+      raycaster(player, doubleBuffer, map),
+      nextPlayerIndex(0)
+{
+    for (auto ipPort : network.ipPorts)
+        udpSenders.push_back(std::unique_ptr<UDPSender>(new UDPSender(ipPort.first, ipPort.second)));
+
+    if (network.relay)
+        relayClient.reset(new RelayClient(udpReceiver, *udpSenders[0], listeningPort, nbPlayers));
+}
+
+BotStats Bot::run(double duration, double sendRate, double frameRate)
+{
+    // Time during which the bot keeps receiving after it stopped sending
+    const double drainTime = 0.5;
+
+    BotStats stats = {listeningPort, duration, 0.0, 0, 0, 0, 0, -1, 0.0, 0.0, 0.0};
+
+    std::chrono::time_point<std::chrono::steady_clock> start = std::chrono::steady_clock::now(), time = start, oldTime;
+    std::chrono::time_point<std::chrono::steady_clock> nextFrame = start, nextSend = start;
+
+    // Packets read from the socket but not rendered yet, and when they were read
+    int pendingPackets = 0;
+    std::chrono::time_point<std::chrono::steady_clock> pendingTime;
+
+    while (true)
+    {
+        raycaster.castWalls();
+        raycaster.castFloorCeiling();
+        raycaster.castSprites();
+
+        doubleBuffer.swap();
+
+        oldTime = time;
+        time = std::chrono::steady_clock::now();
+        double frameTime = std::chrono::duration<double>(time - oldTime).count();
+        double elapsed = std::chrono::duration<double>(time - start).count();
+
+        // The frame rate is measured over the same window as the packet rates
+        if (elapsed < duration)
+            stats.frames++;
+
+        // The positions received before this frame are now rendered
+        if (pendingPackets > 0)
+        {
+            double latency = std::chrono::duration<double>(time - pendingTime).count();
+            stats.latencySum += latency * pendingPackets;
+            stats.latencyMax = std::max(stats.latencyMax, latency);
+            pendingPackets = 0;
+        }
+
+        if (elapsed > duration + drainTime)
+        {
+            stats.runTime = elapsed;
+            break;
+        }
+
+        if (elapsed < duration)
+        {
+            walk(elapsed, frameTime);
+
+            if (sendRate <= 0 || time >= nextSend)
+            {
+                send();
+                stats.sent++;
+                if (sendRate > 0)
+                    nextSend += std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / sendRate));
+            }
+        }
+
+        // Receive other players' positions and update them
+        pendingPackets = receive();
+        pendingTime = std::chrono::steady_clock::now();
+        stats.received += pendingPackets;
+        if (std::chrono::duration<double>(pendingTime - start).count() < duration)
+            stats.receivedSending += pendingPackets;
+
+        if (frameRate > 0)
+        {
+            nextFrame += std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / frameRate));
+            std::this_thread::sleep_until(nextFrame);
+        }
+    }
+
+    if (relayClient)
+        stats.lost = relayClient->getLostSnapshots();
+
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    stats.cpuTime = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6 +
+                    usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+
+    return stats;
+}
+
+void Bot::walk(double time, double frameTime)
+{
+    // The path is a sequence of 2 second segments: walk straight ahead, then turn for a quarter of the segment.
+    // The walls stop the player, and the turning direction alternates so that the bots spread over the map.
+    const double segment = 2.0;
+    int segmentIndex = int(time / segment);
+    double segmentTime = time - segmentIndex * segment;
+
+    if (segmentTime < 0.75 * segment)
+        player.move(frameTime);
+    else
+        player.turn((index + segmentIndex) % 2 == 0 ? frameTime : -frameTime);
+}
+
+void Bot::send()
+{
+    if (relayClient)
+    {
+        relayClient->send(player.posX(), player.posY());
+        return;
+    }
+
+    // Send position to other players
+    for (auto &udpSender : udpSenders)
+        udpSender->send(player.posX(), player.posY());
+}
+
+int Bot::receive()
+{
+    if (relayClient)
+        return relayClient->receive(map);
+
+    int received = 0;
+    for (size_t i = 0; i < nbPlayers; i++)
+    {
+        UDPData data = udpReceiver.receive();
+        if (!data.valid)
+            break;
+        // Update the player's index if it is the first time we receive data from them
+        if (playersIndexes.find(data.sender) == playersIndexes.end())
+        {
+            playersIndexes[data.sender] = nextPlayerIndex++;
+            nextPlayerIndex %= nbPlayers;
+        }
+        int index = playersIndexes[data.sender];
+        map.movePlayer(index, data.position.x(), data.position.y());
+        received++;
+    }
+    return received;
+}
+
+Vector<double> Bot::startPosition(const Map &map, int index)
+{
+    std::vector<Vector<double>> freeCells;
+    for (int y = 0; y < map.getHeight(); y++)
+        for (int x = 0; x < map.getWidth(); x++)
+            if (!map.hasWall(x, y))
+                freeCells.push_back({x + 0.5, y + 0.5});
+
+    // A prime stride spreads consecutive bots over distant cells
+    return freeCells[(size_t(index) * 37) % freeCells.size()];
+}
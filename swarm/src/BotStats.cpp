@@ -0,0 +1,44 @@
+#include <sstream>
+#include <stdexcept>
+
+#include <BotStats.h>
+
+std::string BotStats::toString() const
+{
+    std::ostringstream out;
+    out << "stats"
+        << " " << port
+        << " " << duration
+        << " " << runTime
+        << " " << frames
+        << " " << sent
+        << " " << received
+        << " " << receivedSending
+        << " " << lost
+        << " " << latencySum
+        << " " << latencyMax
+        << " " << cpuTime;
+    return out.str();
+}
+
+BotStats BotStats::parse(const std::string &line)
+{
+    std::istringstream in(line);
+    std::string tag;
+    BotStats stats;
+    in >> tag
+       >> stats.port
+       >> stats.duration
+       >> stats.runTime
+       >> stats.frames
+       >> stats.sent
+       >> stats.received
+       >> stats.receivedSending
+       >> stats.lost
+       >> stats.latencySum
+       >> stats.latencyMax
+       >> stats.cpuTime;
+    if (!in || tag != "stats")
+        throw std::runtime_error("Invalid bot statistics: " + line);
+    return stats;
+}
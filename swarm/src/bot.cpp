@@ -0,0 +1,61 @@
+#include <iostream>
+#include <string>
+
+#include <Bot.h>
+#include <util.h>
+
+struct ProgramArguments
+{
+    int index;
+    std::string ipsPath;
+    double duration;
+    double sendRate;
+    double frameRate;
+    int screenWidth;
+    int screenHeight;
+};
+
+ProgramArguments parseArgs(int argc, char *argv[])
+{
+    if (argc != 6 && argc != 8)
+    {
+        std::cerr << "Usage: " << argv[0] << " <index> <ipsPath> <duration> <sendRate> <frameRate> [screenWidth screenHeight]" << std::endl;
+        std::cerr << "  index: The index of the bot, which determines its starting position and its path." << std::endl;
+        std::cerr << "  ipsPath: The path to the file containing the IP addresses and ports of the players." << std::endl;
+        std::cerr << "  duration: The time in seconds during which the bot sends its position." << std::endl;
+        std::cerr << "  sendRate: The number of packets sent per second to each player (0: every frame)." << std::endl;
+        std::cerr << "  frameRate: The maximum number of frames rendered per second (0: unlimited)." << std::endl;
+        std::cerr << "  screenWidth, screenHeight: The size of the frames rendered (default: 320 240)." << std::endl;
+        std::cerr << "The bot prints \"ready\" once it listens, then starts when it reads a line (or the end) of its standard input." << std::endl;
+        std::cerr << "Example: " << argv[0] << " 0 ips.txt 10 60 60 < /dev/null" << std::endl;
+        exit(1);
+    }
+
+    ProgramArguments args;
+    args.index = std::stoi(argv[1]);
+    args.ipsPath = argv[2];
+    args.duration = std::stod(argv[3]);
+    args.sendRate = std::stod(argv[4]);
+    args.frameRate = std::stod(argv[5]);
+    args.screenWidth = argc == 8 ? std::stoi(argv[6]) : 320;
+    args.screenHeight = argc == 8 ? std::stoi(argv[7]) : 240;
+    return args;
+}
+
+int main(int argc, char *argv[])
+{
+    ProgramArguments args = parseArgs(argc, argv);
+
+    Bot bot(args.index, parseIPs(args.ipsPath), args.screenWidth, args.screenHeight);
+
+    // The launcher starts all the bots together once they all listen, so that no packet is sent to a closed port
+    std::cout << "ready" << std::endl;
+    std::string line;
+    std::getline(std::cin, line);
+
+    BotStats stats = bot.run(args.duration, args.sendRate, args.frameRate);
+
+    // The launcher reads the statistics from the standard output
+    std::cout << stats.toString() << std::endl;
+    return 0;
+}
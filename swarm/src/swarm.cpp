@@ -0,0 +1,275 @@
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <cstdio>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <BotStats.h>
+
+struct ProgramArguments
+{
+    int nbInstances;
+    double duration;
+    double sendRate;
+    double frameRate;
+    int basePort;
+    double relayTickRate;
+    double distantRate;
+    std::string botPath;
+    std::string relayPath;
+};
+
+ProgramArguments parseArgs(int argc, char *argv[])
+{
+    if (argc < 2 || argc > 8)
+    {
+        std::cerr << "Usage: " << argv[0] << " <nbInstances> [duration] [sendRate] [frameRate] [basePort] [relayTickRate] [distantRate]" << std::endl;
+        std::cerr << "  nbInstances: The number of bots to launch on 127.0.0.1 (at least 2)." << std::endl;
+        std::cerr << "  duration: The time in seconds during which the bots send their position (default: 10)." << std::endl;
+        std::cerr << "  sendRate: The number of packets sent per second by a bot to each other bot (default: 60, 0: every frame)." << std::endl;
+        std::cerr << "  frameRate: The maximum number of frames rendered per second by a bot (default: 60, 0: unlimited)." << std::endl;
+        std::cerr << "  basePort: The port of the first bot, the others use the following ports (default: 20000)." << std::endl;
+        std::cerr << "  relayTickRate: If not zero, the bots go through a relay listening on basePort - 1, which sends this many snapshots per second (default: 0)." << std::endl;
+        std::cerr << "  distantRate: If not zero, the relay only sends this many times per second the positions of the players that cannot see each other (default: 0)." << std::endl;
+        std::cerr << "Example: " << argv[0] << " 16 10 60 60 20000 30 1" << std::endl;
+        exit(1);
+    }
+
+    ProgramArguments args;
+    args.nbInstances = std::stoi(argv[1]);
+    args.duration = argc > 2 ? std::stod(argv[2]) : 10.0;
+    args.sendRate = argc > 3 ? std::stod(argv[3]) : 60.0;
+    args.frameRate = argc > 4 ? std::stod(argv[4]) : 60.0;
+    args.basePort = argc > 5 ? std::stoi(argv[5]) : 20000;
+    args.relayTickRate = argc > 6 ? std::stod(argv[6]) : 0.0;
+    args.distantRate = argc > 7 ? std::stod(argv[7]) : 0.0;
+
+    // The bot executable is expected next to the launcher, and the relay in its own directory
+    std::string self = argv[0];
+    size_t slash = self.find_last_of('/');
+    std::string directory = slash == std::string::npos ? "." : self.substr(0, slash);
+    args.botPath = directory + "/bot";
+    args.relayPath = directory + "/../relay/relay";
+
+    if (args.nbInstances < 2)
+    {
+        std::cerr << "At least 2 instances are needed." << std::endl;
+        exit(1);
+    }
+    return args;
+}
+
+/**
+ * @brief Writes the network configuration of a bot in the format read by parseIPs: its listening port on the first line,
+ * followed by the address and port of every other bot, or by the relay.
+ */
+std::string writeConfig(const std::string &directory, int index, int nbInstances, int basePort, bool relay)
+{
+    std::string path = directory + "/ips" + std::to_string(index) + ".txt";
+    std::ofstream f(path);
+    if (!f.is_open())
+        throw std::runtime_error("Failed to create file " + path);
+
+    // parseIPs reads until the end of the file, so there must be no trailing newline
+    f << basePort + index;
+    if (relay)
+        f << "\nrelay 127.0.0.1 " << basePort - 1 << " " << nbInstances - 1;
+    else
+        for (int i = 0; i < nbInstances; i++)
+            if (i != index)
+                f << "\n127.0.0.1 " << basePort + i;
+    return path;
+}
+
+/**
+ * @brief Launches a program whose standard output, and optionally standard input, are redirected to pipes.
+ *
+ * @param arguments The path of the program followed by its arguments.
+ * @param output Set to the read end of the output pipe.
+ * @param input If not NULL, set to the write end of the input pipe.
+ * @return The process identifier of the program.
+ */
+pid_t launch(const std::vector<std::string> &arguments, FILE **output, FILE **input = NULL)
+{
+    int fds[2], inputFds[2];
+    if (pipe(fds) < 0 || (input && pipe(inputFds) < 0))
+        throw std::runtime_error("Failed to create pipe");
+
+    pid_t pid = fork();
+    if (pid < 0)
+        throw std::runtime_error("Failed to fork");
+    if (pid == 0)
+    {
+        dup2(fds[1], STDOUT_FILENO);
+        close(fds[0]);
+        close(fds[1]);
+        if (input)
+        {
+            dup2(inputFds[0], STDIN_FILENO);
+            close(inputFds[0]);
+            close(inputFds[1]);
+        }
+        std::vector<char *> argv;
+        for (const std::string &argument : arguments)
+            argv.push_back(const_cast<char *>(argument.c_str()));
+        argv.push_back(NULL);
+        execv(argv[0], argv.data());
+        perror("execv");
+        _exit(1);
+    }
+    close(fds[1]);
+    *output = fdopen(fds[0], "r");
+    if (input)
+    {
+        close(inputFds[0]);
+        *input = fdopen(inputFds[1], "w");
+    }
+    return pid;
+}
+
+/**
+ * @brief Waits for a program launched by launch and reads its output.
+ *
+ * @param pid The process identifier of the program.
+ * @param output The read end of the pipe of the program.
+ * @return The output of the program.
+ */
+std::string wait(pid_t pid, FILE *output)
+{
+    std::string text;
+    char buffer[256];
+    while (fgets(buffer, sizeof(buffer), output))
+        text += buffer;
+    fclose(output);
+
+    int status;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        throw std::runtime_error("Program " + std::to_string(pid) + " failed");
+    return text;
+}
+
+int main(int argc, char *argv[])
+{
+    ProgramArguments args = parseArgs(argc, argv);
+    const int n = args.nbInstances;
+
+    char directoryTemplate[] = "/tmp/swarmXXXXXX";
+    if (!mkdtemp(directoryTemplate))
+        throw std::runtime_error("Failed to create the configuration directory");
+    std::string directory = directoryTemplate;
+
+    const bool relay = args.relayTickRate > 0;
+
+    std::vector<std::string> configs;
+    for (int i = 0; i < n; i++)
+        configs.push_back(writeConfig(directory, i, n, args.basePort, relay));
+
+    // The relay runs a little longer than the bots so that it serves them until the end
+    pid_t relayPid = 0;
+    FILE *relayOutput = NULL;
+    if (relay)
+    {
+        relayPid = launch({args.relayPath, std::to_string(args.basePort - 1), std::to_string(args.relayTickRate),
+                           std::to_string(args.duration + 1.0), std::to_string(args.distantRate)},
+                          &relayOutput);
+        usleep(100000);
+    }
+
+    // Launch all the bots, each one writing its statistics to a pipe
+    std::vector<pid_t> pids(n);
+    std::vector<FILE *> outputs(n), inputs(n);
+    for (int i = 0; i < n; i++)
+        pids[i] = launch({args.botPath, std::to_string(i), configs[i], std::to_string(args.duration),
+                          std::to_string(args.sendRate), std::to_string(args.frameRate)},
+                         &outputs[i], &inputs[i]);
+
+    // Start the bots together once they all listen, so that every packet sent can be received and the send windows match
+    char buffer[64];
+    for (int i = 0; i < n; i++)
+        if (!fgets(buffer, sizeof(buffer), outputs[i]) || std::string(buffer) != "ready\n")
+            throw std::runtime_error("Bot " + std::to_string(i) + " failed to start");
+    for (int i = 0; i < n; i++)
+    {
+        fputs("start\n", inputs[i]);
+        fclose(inputs[i]);
+    }
+
+    std::vector<BotStats> stats;
+    for (int i = 0; i < n; i++)
+        stats.push_back(BotStats::parse(wait(pids[i], outputs[i])));
+
+    // relay <elapsed> <clients> <packetsIn> <packetsOut> <bytesOut>
+    double relayElapsed = 0;
+    long relayPacketsOut = 0, relayBytesOut = 0;
+    if (relay)
+    {
+        std::istringstream relayStats(wait(relayPid, relayOutput));
+        std::string tag;
+        int clients;
+        long packetsIn;
+        relayStats >> tag >> relayElapsed >> clients >> packetsIn >> relayPacketsOut >> relayBytesOut;
+    }
+
+    for (const std::string &config : configs)
+        unlink(config.c_str());
+    rmdir(directory.c_str());
+
+    // Every bot sends each of its packets to all the others, so a bot should receive everything the others sent.
+    // With a relay, the bots count the snapshots they missed themselves.
+    // The rates are measured over the send window. The packets still in flight at its end are received during the drain,
+    // and only count towards the loss.
+    long totalSent = 0;
+    for (const BotStats &s : stats)
+        totalSent += s.sent;
+    const int destinations = relay ? 1 : n - 1;
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "port      FPS   tx pkt/s   rx pkt/s   loss %   latency ms (mean/max)   CPU %" << std::endl;
+
+    double totalRx = 0, totalLoss = 0, totalLatency = 0, maxLatency = 0, totalCpu = 0;
+    for (const BotStats &s : stats)
+    {
+        long expected = relay ? s.received + s.lost : totalSent - s.sent;
+        double loss = expected > 0 ? 100.0 * (expected - s.received) / expected : 0.0;
+        double latency = s.received > 0 ? 1000.0 * s.latencySum / s.received : 0.0;
+        double cpu = 100.0 * s.cpuTime / s.runTime;
+
+        std::cout << std::setw(5) << s.port
+                  << std::setw(8) << s.frames / s.duration
+                  << std::setw(11) << s.sent * destinations / s.duration
+                  << std::setw(11) << s.receivedSending / s.duration
+                  << std::setw(9) << loss
+                  << std::setw(13) << latency << " / " << std::setw(7) << 1000.0 * s.latencyMax
+                  << std::setw(11) << cpu << std::endl;
+
+        totalRx += s.receivedSending / s.duration;
+        totalLoss += loss;
+        totalLatency += latency;
+        maxLatency = std::max(maxLatency, 1000.0 * s.latencyMax);
+        totalCpu += cpu;
+    }
+
+    // A position sent to a peer is 2 doubles, and 3 doubles when sent to the relay (with the listening port)
+    double uploadBytes = 0;
+    for (const BotStats &s : stats)
+        uploadBytes += double(s.sent) * destinations * (relay ? 3 : 2) * sizeof(double) / s.duration;
+    std::cout << "traffic: " << uploadBytes / 1024 << " KB/s from the bots";
+    if (relay)
+        std::cout << ", " << relayBytesOut / relayElapsed / 1024 << " KB/s from the relay ("
+                  << relayPacketsOut / relayElapsed << " pkt/s)";
+    std::cout << std::endl;
+
+    std::cout << "instances: " << n
+              << ", total rx pkt/s: " << totalRx
+              << ", mean loss: " << totalLoss / n << " %"
+              << ", mean latency: " << totalLatency / n << " ms (max " << maxLatency << " ms)"
+              << ", total CPU: " << totalCpu << " %" << std::endl;
+    return 0;
+}